@@ -0,0 +1,225 @@
+#include "Account.h"
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+	// std::atomic<double> has no fetch_add before c++20
+	void atomicAdd(std::atomic<double>& value, double delta)
+	{
+		auto expected = value.load(std::memory_order_relaxed);
+		while (!value.compare_exchange_weak(expected, expected + delta, std::memory_order_relaxed))
+		{
+		}
+	}
+}
+
+SymbolBook::SymbolBook(std::string ticker) :
+	ticker_(ticker),
+	fillSequence_(0),
+	shares_(0),
+	averagePrice_(0),
+	realizedProfit_(0),
+	pendingBuyShares_(0),
+	pendingSellShares_(0)
+{
+}
+
+const std::string& SymbolBook::ticker() const
+{
+	return ticker_;
+}
+
+int SymbolBook::shares() const
+{
+	return shares_.load(std::memory_order_relaxed);
+}
+
+double SymbolBook::averagePrice() const
+{
+	return averagePrice_.load(std::memory_order_relaxed);
+}
+
+double SymbolBook::realizedProfit() const
+{
+	return realizedProfit_.load(std::memory_order_relaxed);
+}
+
+SymbolExposure SymbolBook::exposure() const
+{
+	SymbolExposure symbolExposure{ ticker_, 0, 0, 0 };
+	for (;;)
+	{
+		const auto sequence = fillSequence_.load(std::memory_order_acquire);
+		if (sequence % 2 != 0)
+		{
+			continue;
+		}
+
+		symbolExposure.shares = shares_.load(std::memory_order_relaxed);
+		symbolExposure.averagePrice = averagePrice_.load(std::memory_order_relaxed);
+		symbolExposure.realizedProfit = realizedProfit_.load(std::memory_order_relaxed);
+
+		// the loads above may not be moved after the second read of the sequence
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (fillSequence_.load(std::memory_order_relaxed) == sequence)
+		{
+			return symbolExposure;
+		}
+	}
+}
+
+Account::Account() :
+	buyingPower_(0),
+	grossExposure_(0),
+	netExposure_(0),
+	realizedProfit_(0)
+{
+}
+
+Account::~Account()
+{
+}
+
+SymbolBook& Account::book(const std::string& ticker)
+{
+	auto& tickerShard = shard(ticker);
+	std::lock_guard<std::mutex> lock(tickerShard.shardMtx);
+	auto& symbolBook = tickerShard.books[ticker];
+	if (symbolBook == nullptr)
+	{
+		symbolBook = std::make_unique<SymbolBook>(ticker);
+	}
+	return *symbolBook;
+}
+
+void Account::fill(SymbolBook& symbolBook, int signedShares, double avgFillPrice)
+{
+	if (signedShares == 0)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(symbolBook.fillMtx_);
+
+	const int shares = symbolBook.shares_.load(std::memory_order_relaxed);
+	const double averagePrice = symbolBook.averagePrice_.load(std::memory_order_relaxed);
+	const int newShares = shares + signedShares;
+	double newAveragePrice = averagePrice;
+	double realizedProfit = 0;
+
+	// adding to the position (or opening a new one). average in the new shares
+	if (shares == 0 || (shares > 0) == (signedShares > 0))
+	{
+		newAveragePrice = (averagePrice * abs(shares) + avgFillPrice * abs(signedShares)) / abs(newShares);
+	}
+	// reducing the position. realize the profit of the covered shares. if the fill flips
+	// the position, the remaining shares are opened at the fill price
+	else
+	{
+		const int closedShares = abs(signedShares) < abs(shares) ? abs(signedShares) : abs(shares);
+		realizedProfit = (avgFillPrice - averagePrice) * closedShares * (shares > 0 ? 1 : -1);
+
+		if (newShares == 0)
+		{
+			newAveragePrice = 0;
+		}
+		else if ((newShares > 0) != (shares > 0))
+		{
+			newAveragePrice = avgFillPrice;
+		}
+	}
+
+	// the book is written between two increments of its sequence, see SymbolBook::exposure. the
+	// stores may not be moved before the first one
+	const auto sequence = symbolBook.fillSequence_.load(std::memory_order_relaxed);
+	symbolBook.fillSequence_.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	symbolBook.shares_.store(newShares, std::memory_order_relaxed);
+	symbolBook.averagePrice_.store(newAveragePrice, std::memory_order_relaxed);
+	if (realizedProfit != 0)
+	{
+		symbolBook.realizedProfit_.store(symbolBook.realizedProfit_.load(std::memory_order_relaxed) + realizedProfit, std::memory_order_relaxed);
+	}
+	symbolBook.fillSequence_.store(sequence + 2, std::memory_order_release);
+
+	if (realizedProfit != 0)
+	{
+		atomicAdd(realizedProfit_, realizedProfit);
+	}
+
+	// only the delta of this book is applied to the aggregate cache
+	atomicAdd(grossExposure_, abs(newShares) * newAveragePrice - abs(shares) * averagePrice);
+	atomicAdd(netExposure_, newShares * newAveragePrice - shares * averagePrice);
+}
+
+void Account::fill(const std::string& ticker, int signedShares, double avgFillPrice)
+{
+	fill(book(ticker), signedShares, avgFillPrice);
+}
+
+void Account::setBuyingPower(double buyingPower)
+{
+	buyingPower_.store(buyingPower, std::memory_order_relaxed);
+}
+
+double Account::buyingPower() const
+{
+	return buyingPower_.load(std::memory_order_relaxed);
+}
+
+double Account::availableBuyingPower() const
+{
+	return buyingPower() - grossExposure();
+}
+
+double Account::grossExposure() const
+{
+	return grossExposure_.load(std::memory_order_relaxed);
+}
+
+double Account::netExposure() const
+{
+	return netExposure_.load(std::memory_order_relaxed);
+}
+
+double Account::realizedProfit() const
+{
+	return realizedProfit_.load(std::memory_order_relaxed);
+}
+
+AccountSummary Account::summary() const
+{
+	AccountSummary accountSummary;
+	accountSummary.buyingPower = buyingPower();
+	accountSummary.grossExposure = grossExposure();
+	accountSummary.netExposure = netExposure();
+	accountSummary.realizedProfit = realizedProfit();
+	accountSummary.availableBuyingPower = accountSummary.buyingPower - accountSummary.grossExposure;
+	return accountSummary;
+}
+
+std::vector<SymbolExposure> Account::exposures() const
+{
+	std::vector<SymbolExposure> symbolExposures;
+	for (const auto& tickerShard : shards_)
+	{
+		std::lock_guard<std::mutex> lock(tickerShard.shardMtx);
+		for (const auto& symbolBook : tickerShard.books)
+		{
+			symbolExposures.push_back(symbolBook.second->exposure());
+		}
+	}
+	return symbolExposures;
+}
+
+Account::Shard& Account::shard(const std::string& ticker)
+{
+	return shards_[std::hash<std::string>()(ticker) % NUM_SHARDS];
+}
+
+Account& GetAccount()
+{
+	static Account account;
+	return account;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Common.h"
+#include "OrderRateLimiter.h"
+
+// snapshot of the aggregate state of the account. exposures are computed at cost
+// (shares * average price) so that they only change when a fill comes in.
+struct AccountSummary
+{
+	double buyingPower;
+	double availableBuyingPower;
+	double grossExposure;
+	double netExposure;
+	double realizedProfit;
+};
+
+// snapshot of a single symbol book in the account
+struct SymbolExposure
+{
+	std::string ticker;
+	int shares;
+	double averagePrice;
+	double realizedProfit;
+};
+
+//
+// Book of a single symbol in the account. It holds the net position of every algorithm instance
+// trading this symbol. Fields are atomics so that any strategy thread can read them without taking
+// a lock. Writers (fills) are serialized per symbol by the Account.
+//
+// A fill changes the shares, average price and realized profit together. exposure reads them as of
+// one fill: the fill makes fillSequence_ odd while it writes them, and the reader reads again if the
+// sequence was odd or changed while it read.
+//
+class SymbolBook
+{
+public:
+	explicit SymbolBook(std::string ticker);
+
+	const std::string& ticker() const;
+	int shares() const;
+	double averagePrice() const;
+	double realizedProfit() const;
+
+	// shares, average price and realized profit as of the same fill
+	SymbolExposure exposure() const;
+
+private:
+	friend class Account;
+	friend class RiskGate;
+
+	const std::string ticker_;
+
+	// only serializes fills of this symbol. readers never take it
+	std::mutex fillMtx_;
+	std::atomic<unsigned int> fillSequence_;
+	std::atomic<int> shares_;
+	std::atomic<double> averagePrice_;
+	std::atomic<double> realizedProfit_;
+
+	// per symbol order throttle used by the risk gate
+	OrderRateLimiter orderRate_;
+
+	// shares of the orders accepted by the risk gate that are not filled yet. sells are negative
+	std::atomic<int> pendingBuyShares_;
+	std::atomic<int> pendingSellShares_;
+};
+
+//
+// Account is shared by every BaseAlgorithm instance in the process. Each LocalBroker owns a Portfolio
+// which tracks the positions of its own algorithm instance. Account sits on top of those and keeps
+// a combined view of all the symbols being traded so that a whole watch list can be run under one
+// risk budget.
+//
+// Symbol books are sharded by ticker so that looking up a book only locks its shard. The aggregate
+// values are cached in atomics and updated with the delta of each fill, so a fill is O(1) and reading
+// the aggregates never takes a lock.
+//
+class Account
+{
+public:
+	Account();
+	~Account();
+	Account(const Account& other) = delete;
+	Account& operator=(const Account& other) = delete;
+
+	// returns the book of the ticker. creates an empty book if the ticker has never been traded.
+	// the reference stays valid for the lifetime of the account
+	SymbolBook& book(const std::string& ticker);
+
+	// applies a fill to the book. positive shares for buys and negative shares for sells
+	void fill(SymbolBook& symbolBook, int signedShares, double avgFillPrice);
+	void fill(const std::string& ticker, int signedShares, double avgFillPrice);
+
+	// buying power is not tracked by the local broker. whoever owns the risk budget sets it.
+	// a buying power of 0 means that it is not limited.
+	void setBuyingPower(double buyingPower);
+	double buyingPower() const;
+	double availableBuyingPower() const;
+
+	double grossExposure() const;
+	double netExposure() const;
+	double realizedProfit() const;
+	AccountSummary summary() const;
+
+	// copies every book. only locks one shard at a time
+	std::vector<SymbolExposure> exposures() const;
+
+private:
+	static const size_t NUM_SHARDS = 16;
+
+	struct Shard
+	{
+		mutable std::mutex shardMtx;
+		std::unordered_map<std::string, std::unique_ptr<SymbolBook>> books;
+	};
+	std::array<Shard, NUM_SHARDS> shards_;
+
+	// aggregate cache
+	std::atomic<double> buyingPower_;
+	std::atomic<double> grossExposure_;
+	std::atomic<double> netExposure_;
+	std::atomic<double> realizedProfit_;
+
+	Shard& shard(const std::string& ticker);
+};
+
+// process wide account. every local broker records its fills here
+Account& GetAccount();
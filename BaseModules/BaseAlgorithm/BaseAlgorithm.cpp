@@ -33,6 +33,20 @@ public:
 	void reducePosition(PositionId posId, int numShares);
 	Position getPosition(PositionId posId);
 
+// account functions
+public:
+	AccountSummary accountSummary();
+	SymbolExposure accountExposure(std::string ticker);
+	void setAccountBuyingPower(double buyingPower);
+
+// risk gate functions
+public:
+	void setRiskLimits(const RiskLimits& limits);
+	void engageKillSwitch();
+	void releaseKillSwitch();
+
+	FeedIndicators& feedIndicators(int timeFrameSeconds);
+
 private:
 	std::string ticker_;
 
@@ -74,6 +88,9 @@ BaseAlgorithm::BaseAlgorithmImpl::BaseAlgorithmImpl(BaseAlgorithm* parentIn, std
 		ticker_ = input;
 	}
 
+	// the feed sends its ticks to the gui once for all the algorithms on it
+	plotData->ticks = localBroker.chartTicks();
+
 	callbackHandle = localBroker.registerListener([this](const Tick& tick)
 	{
 		this->tickHandler(tick);
@@ -125,8 +142,7 @@ PositionId BaseAlgorithm::BaseAlgorithmImpl::longMarket(std::string ticker, int
 		pPosition.shares = numShares;
 		pPosition.profit = 0;
 
-		std::lock_guard<std::mutex> lock(plotData->plotDataMtx);
-		plotData->annotations.push_back(std::make_shared<Annotation::Label>(labelText, time, avgFillPrice));
+		plotData->annotations.push(std::make_shared<Annotation::Label>(labelText, time, avgFillPrice));
 	});	
 }
 
@@ -145,8 +161,7 @@ PositionId BaseAlgorithm::BaseAlgorithmImpl::shortMarket(std::string ticker, int
 		pPosition.averagePrice = avgFillPrice;
 		pPosition.shares = -abs(numShares);
 		pPosition.profit = 0;
-		std::lock_guard<std::mutex> lock(plotData->plotDataMtx);
-		plotData->annotations.push_back(std::make_shared<Annotation::Label>(labelText, time, avgFillPrice));
+		plotData->annotations.push(std::make_shared<Annotation::Label>(labelText, time, avgFillPrice));
 	});
 }
 
@@ -181,9 +196,8 @@ void BaseAlgorithm::BaseAlgorithmImpl::closePosition(PositionId posId)
 			lineAnnotation->color_ = { 0, 255, 0 };
 		}
 
-		std::lock_guard<std::mutex> lock(plotData->plotDataMtx);
-		plotData->annotations.push_back(labelAnnotation);
-		plotData->annotations.push_back(lineAnnotation);
+		plotData->annotations.push(labelAnnotation);
+		plotData->annotations.push(lineAnnotation);
 	});
 
 }
@@ -222,9 +236,8 @@ void BaseAlgorithm::BaseAlgorithmImpl::reducePosition(PositionId posId, int numS
 			pPosition.averagePrice = avgFillPrice;
 			pPosition.profit = cPosition.profit;
 
-			std::lock_guard<std::mutex> lock(plotData->plotDataMtx);
-			plotData->annotations.push_back(labelAnnotation);
-			plotData->annotations.push_back(lineAnnotation);
+			plotData->annotations.push(labelAnnotation);
+			plotData->annotations.push(lineAnnotation);
 		});
 	}
 	
@@ -235,18 +248,44 @@ Position BaseAlgorithm::BaseAlgorithmImpl::getPosition(PositionId posId)
 	return localBroker.getPosition(posId);
 }
 
+AccountSummary BaseAlgorithm::BaseAlgorithmImpl::accountSummary()
+{
+	return GetAccount().summary();
+}
+
+SymbolExposure BaseAlgorithm::BaseAlgorithmImpl::accountExposure(std::string ticker)
+{
+	return GetAccount().book(ticker).exposure();
+}
+
+void BaseAlgorithm::BaseAlgorithmImpl::setAccountBuyingPower(double buyingPower)
+{
+	GetAccount().setBuyingPower(buyingPower);
+}
+
+void BaseAlgorithm::BaseAlgorithmImpl::setRiskLimits(const RiskLimits& limits)
+{
+	GetRiskGate().setLimits(limits);
+}
+
+void BaseAlgorithm::BaseAlgorithmImpl::engageKillSwitch()
+{
+	GetRiskGate().engageKillSwitch();
+}
+
+void BaseAlgorithm::BaseAlgorithmImpl::releaseKillSwitch()
+{
+	GetRiskGate().releaseKillSwitch();
+}
+
+FeedIndicators& BaseAlgorithm::BaseAlgorithmImpl::feedIndicators(int timeFrameSeconds)
+{
+	return localBroker.feedIndicators(timeFrameSeconds);
+}
+
 void BaseAlgorithm::BaseAlgorithmImpl::tickHandler(const Tick & tick)
 {
 	parent->tickHandler(tick);
-
-	// in case if gui is sometimes slow and is holding the lock, we don't want to block this thread
-	// therefore, if we fail to retrieve the lock immediately, we push the data into a secondary buffer.
-	// when we successfully get the lock, we simply have to move the data into plotData. this will allow
-	// the algorithm to be more overall responsive .
-	std::unique_lock<std::mutex> lock(plotData->plotDataMtx);
-	PlotData& plotDataRef = *plotData;
-	//this is the only thread that accesses buffer no synchronization needed
-	plotData->ticks.push_back(tick);
 }
 
 BaseAlgorithm::BaseAlgorithm(std::string input, std::shared_ptr<InteractiveBrokersClient> ibApiPtr, bool live):
@@ -319,6 +358,41 @@ Position BaseAlgorithm::getPosition(PositionId posId)
 	return impl_->getPosition(posId);
 }
 
+AccountSummary BaseAlgorithm::accountSummary()
+{
+	return impl_->accountSummary();
+}
+
+SymbolExposure BaseAlgorithm::accountExposure(std::string ticker)
+{
+	return impl_->accountExposure(ticker);
+}
+
+void BaseAlgorithm::setAccountBuyingPower(double buyingPower)
+{
+	impl_->setAccountBuyingPower(buyingPower);
+}
+
+void BaseAlgorithm::setRiskLimits(const RiskLimits& limits)
+{
+	impl_->setRiskLimits(limits);
+}
+
+void BaseAlgorithm::engageKillSwitch()
+{
+	impl_->engageKillSwitch();
+}
+
+void BaseAlgorithm::releaseKillSwitch()
+{
+	impl_->releaseKillSwitch();
+}
+
+FeedIndicators& BaseAlgorithm::feedIndicators(int timeFrameSeconds)
+{
+	return impl_->feedIndicators(timeFrameSeconds);
+}
+
 std::string BaseAlgorithm::ticker()
 {
 	return impl_->ticker();
@@ -2,6 +2,9 @@
 
 #include <string>
 #include "Common.h"
+#include "Account.h"
+#include "FeedIndicators.h"
+#include "RiskGate.h"
 #include "PlotData.h"
 
 #ifdef BASEALGORITHM_EXPORTS
@@ -112,6 +115,22 @@ protected:
 	void reducePosition(PositionId posId, int numShares);
 	Position getPosition(PositionId posId);
 
+	// account api. the account is shared by every algorithm instance in the process
+	// so these reflect the combined positions of all the tickers being traded
+	AccountSummary accountSummary();
+	SymbolExposure accountExposure(std::string ticker);
+	void setAccountBuyingPower(double buyingPower);
+
+	// risk gate api. limits and the kill switch apply to every algorithm instance in the process
+	void setRiskLimits(const RiskLimits& limits);
+	void engageKillSwitch();
+	void releaseKillSwitch();
+
+	// indicators on the closed candles of timeFrameSeconds of the feed, shared with every algorithm
+	// on it. when tickHandler sees a candle of the same time frame close, they have taken it already.
+	// the handles added are released before the algorithm is destroyed
+	FeedIndicators& feedIndicators(int timeFrameSeconds);
+
 	virtual void tickHandler(const Tick& tick) = 0;
 
 	std::string ticker();
@@ -14,4 +14,5 @@ using TickListener = std::function<void(const Tick& tick)>;
 using CallbackHandle = int;
 const CallbackHandle INVALID_CALLBACK_HANDLE = -1;
 
-using PositionId = int;
\ No newline at end of file
+using PositionId = int;
+const PositionId INVALID_POSITION_ID = -1;
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <mutex>
+#include "../CandleMaker/CandleMaker.h"
+#include "../Indicators/IndicatorEngine.h"
+
+//
+// Indicators on the closed candles of a feed, shared by every algorithm on it. An algorithm adding an
+// indicator another one on the feed already has gets the same node, see IndicatorEngine, so it is
+// computed once per candle however many algorithms read it.
+//
+// The feed gives each tick to takeTick before its listeners. When a listener sees a candle of the same
+// time frame close, the engine has already taken it and value reads the indicators as of that candle.
+// The nodes are added and released by the algorithms on their own threads, so every call locks.
+//
+class FeedIndicators
+{
+public:
+	explicit FeedIndicators(int timeFrameSeconds) :
+		candleMaker_(timeFrameSeconds)
+	{
+	}
+
+	FeedIndicators(const FeedIndicators& other) = delete;
+	FeedIndicators& operator=(const FeedIndicators& other) = delete;
+
+	// same as the IndicatorEngine functions of the same name. each handle is given back to release
+	template<typename T, typename... Args>
+	IndicatorEngine::Handle add(IndicatorEngine::Series input, Args... args)
+	{
+		std::lock_guard<std::mutex> lock(engineMtx_);
+		return engine_.add<T>(input, args...);
+	}
+
+	template<typename T, typename... Args>
+	IndicatorEngine::Handle addOnCandle(Args... args)
+	{
+		std::lock_guard<std::mutex> lock(engineMtx_);
+		return engine_.addOnCandle<T>(args...);
+	}
+
+	template<typename T, typename... Args>
+	IndicatorEngine::Handle addOnPair(IndicatorEngine::Series first, IndicatorEngine::Series second, Args... args)
+	{
+		std::lock_guard<std::mutex> lock(engineMtx_);
+		return engine_.addOnPair<T>(first, second, args...);
+	}
+
+	void release(const IndicatorEngine::Handle& handle)
+	{
+		std::lock_guard<std::mutex> lock(engineMtx_);
+		engine_.release(handle);
+	}
+
+	double value(IndicatorEngine::Series series) const
+	{
+		std::lock_guard<std::mutex> lock(engineMtx_);
+		return engine_.value(series);
+	}
+
+	// called by the feed with every tick it broadcasts
+	void takeTick(const Tick& tick)
+	{
+		std::lock_guard<std::mutex> lock(engineMtx_);
+		candleMaker_.addTick(tick);
+
+		Candlestick candle;
+		while (candleMaker_.popClosedCandle(candle))
+		{
+			engine_.update(SamplePoint{ candle.open, candle.high, candle.low, candle.close, static_cast<double>(candle.volume) }, true);
+		}
+	}
+
+private:
+	mutable std::mutex engineMtx_;
+	CandleMaker candleMaker_;
+	IndicatorEngine engine_;
+};
@@ -1,10 +1,14 @@
 #include "LocalBroker.h"
 #include <algorithm>
+#include <iostream>
 
 LocalBroker::LocalBroker(std::string input, std::shared_ptr<InteractiveBrokersClient> ibApi, bool live) :
 	ibApi_(ibApi),
-	tickSource_(input, ibApi),
-	liveTrade_(live)
+	tickSource_(GetSymbolFeedRegistry().acquire(input, ibApi)),
+	account_(GetAccount()),
+	riskGate_(GetRiskGate()),
+	liveTrade_(live),
+	activeTickListenerHandle(INVALID_CALLBACK_HANDLE)
 {
 	// if live option is turned on but invalid conection is provided
 	// then we can't trade live.
@@ -23,15 +27,21 @@ LocalBroker::~LocalBroker()
 {
 	unregisterListener(activeTickListenerHandle);
 
-	for (auto& handle : activeFillNotificationListenersHandles)
+	for (auto& order : activeOrderHandles_)
 	{
-		ibApi_->unregisterFillNotification(handle);
+		ibApi_->unregisterFillNotification(order.first);
+
+		// the order can't be filled into this broker anymore
+		if (order.second != nullptr)
+		{
+			releaseReservation(*order.second);
+		}
 	}
 }
 
 void LocalBroker::run()
 {
-	tickSource_.run();
+	tickSource_->run();
 }
 
 bool LocalBroker::valid()
@@ -44,21 +54,29 @@ PositionId LocalBroker::longMarket(std::string ticker, int numShares, std::funct
 	//validate number of shares
 	numShares = abs(numShares);
 
+	auto reservation = passRiskGate(ticker, numShares, tickSource_->lastPrice());
+	if (reservation == nullptr)
+	{
+		return INVALID_POSITION_ID;
+	}
+
 	auto newPosId = portfolio_.newPosition(ticker);
 
 	// this lambda captures the state of the current context
 	// when this is called as a callback later, it will have
 	// the context to dispatch to the caller
-	auto fillPositionNotification = [this, newPosId, fillNotification, numShares](double price, time_t time) 
+	auto fillPositionNotification = [this, ticker, newPosId, fillNotification, numShares, reservation](double price, time_t time)
 	{
 		portfolio_.fillPosition(newPosId, price, numShares, time);
+		account_.fill(ticker, numShares, price);
+		releaseReservation(*reservation);
 		fillNotification(price, time);
 	};
 
 	if (liveTrade_)
 	{
 		// submit through ib and register fillPosition as the callback
-		activeFillNotificationListenersHandles.push_back(ibApi_->longMarket(ticker, numShares, fillPositionNotification));
+		trackOrder(ibApi_->longMarket(ticker, numShares, fillPositionNotification), reservation);
 	}
 	else
 	{
@@ -67,7 +85,7 @@ PositionId LocalBroker::longMarket(std::string ticker, int numShares, std::funct
 		// before the posId is returned back to them. this is fine because the posId is not
 		// given as part of the callback argument anyway and would not provide any useful 
 		// information
-		fillPositionNotification(tickSource_.lastTick().price, tickSource_.lastTick().time);
+		fillPositionNotification(tickSource_->lastTick().price, tickSource_->lastTick().time);
 	}
 
 	return newPosId;
@@ -78,21 +96,29 @@ PositionId LocalBroker::longLimit(std::string ticker, double limitPrice, int num
 	//validate number of shares
 	numShares = abs(numShares);
 
+	auto reservation = passRiskGate(ticker, numShares, limitPrice);
+	if (reservation == nullptr)
+	{
+		return INVALID_POSITION_ID;
+	}
+
 	auto newPosId = portfolio_.newPosition(ticker);
 
 	// this lambda captures the state of the current context
 	// when this is called as a callback later, it will have
 	// the context to dispatch to the caller
-	auto fillPositionNotification = [this, newPosId, fillNotification, numShares](double price, time_t time)
+	auto fillPositionNotification = [this, ticker, newPosId, fillNotification, numShares, reservation](double price, time_t time)
 	{
 		portfolio_.fillPosition(newPosId, price, numShares, time);
+		account_.fill(ticker, numShares, price);
+		releaseReservation(*reservation);
 		fillNotification(price, time);
 	};
 
 	if (liveTrade_)
 	{
 		// submit through ib and register fillPosition as the callback
-		activeFillNotificationListenersHandles.push_back(ibApi_->longLimit(ticker, limitPrice, numShares, fillPositionNotification));
+		trackOrder(ibApi_->longLimit(ticker, limitPrice, numShares, fillPositionNotification), reservation);
 	}
 	else
 	{
@@ -101,7 +127,7 @@ PositionId LocalBroker::longLimit(std::string ticker, double limitPrice, int num
 		// before the posId is returned back to them. this is fine because the posId is not
 		// given as part of the callback argument anyway and would not provide any useful 
 		// information
-		fillPositionNotification(tickSource_.lastTick().price, tickSource_.lastTick().time);
+		fillPositionNotification(tickSource_->lastTick().price, tickSource_->lastTick().time);
 	}
 
 	return newPosId;
@@ -112,6 +138,12 @@ PositionId LocalBroker::shortMarket(std::string ticker, int numShares, std::func
 	//validate number of shares
 	numShares = abs(numShares);
 
+	auto reservation = passRiskGate(ticker, -numShares, tickSource_->lastPrice());
+	if (reservation == nullptr)
+	{
+		return INVALID_POSITION_ID;
+	}
+
 	auto newPosId = portfolio_.newPosition(ticker);
 
 	// this lambda captures the state of the current context
@@ -120,13 +152,15 @@ PositionId LocalBroker::shortMarket(std::string ticker, int numShares, std::func
 	auto fillPositionNotification = [=](double price, time_t time)
 	{
 		portfolio_.fillPosition(newPosId, price, -numShares, time);
+		account_.fill(ticker, -numShares, price);
+		releaseReservation(*reservation);
 		fillNotification(price, time);
 	};
 
 	if (liveTrade_)
 	{
 		// submit through ib and register fillPosition as the callback
-		activeFillNotificationListenersHandles.push_back(ibApi_->shortMarket(ticker, numShares, fillPositionNotification));
+		trackOrder(ibApi_->shortMarket(ticker, numShares, fillPositionNotification), reservation);
 	}
 	else
 	{
@@ -135,7 +169,7 @@ PositionId LocalBroker::shortMarket(std::string ticker, int numShares, std::func
 		// before the posId is returned back to them. this is fine because the posId is not
 		// given as part of the callback argument anyway and would not provide any useful 
 		// information
-		fillPositionNotification(tickSource_.lastTick().price, tickSource_.lastTick().time);
+		fillPositionNotification(tickSource_->lastTick().price, tickSource_->lastTick().time);
 	}
 
 	return newPosId;
@@ -146,6 +180,12 @@ PositionId LocalBroker::shortLimit(std::string ticker, double limitPrice, int nu
 	//validate number of shares
 	numShares = abs(numShares);
 
+	auto reservation = passRiskGate(ticker, -numShares, limitPrice);
+	if (reservation == nullptr)
+	{
+		return INVALID_POSITION_ID;
+	}
+
 	auto newPosId = portfolio_.newPosition(ticker);
 
 	// this lambda captures the state of the current context
@@ -154,13 +194,15 @@ PositionId LocalBroker::shortLimit(std::string ticker, double limitPrice, int nu
 	auto fillPositionNotification = [=](double price, time_t time)
 	{
 		portfolio_.fillPosition(newPosId, price, -numShares, time);
+		account_.fill(ticker, -numShares, price);
+		releaseReservation(*reservation);
 		fillNotification(price, time);
 	};
 
 	if (liveTrade_)
 	{
 		// submit through ib and register fillPosition as the callback
-		activeFillNotificationListenersHandles.push_back(ibApi_->shortLimit(ticker, limitPrice, numShares, fillPositionNotification));
+		trackOrder(ibApi_->shortLimit(ticker, limitPrice, numShares, fillPositionNotification), reservation);
 	}
 	else
 	{
@@ -169,7 +211,7 @@ PositionId LocalBroker::shortLimit(std::string ticker, double limitPrice, int nu
 		// before the posId is returned back to them. this is fine because the posId is not
 		// given as part of the callback argument anyway and would not provide any useful 
 		// information
-		fillPositionNotification(tickSource_.lastTick().price, tickSource_.lastTick().time);
+		fillPositionNotification(tickSource_->lastTick().price, tickSource_->lastTick().time);
 	}
 
 	return newPosId;
@@ -184,9 +226,15 @@ void LocalBroker::reducePosition(PositionId posId, int numShares, std::function<
 	// only submit orders as all or none
 	auto reducePositionFillNotification = [this, posId, fillNotification, numShares](double price, time_t time)
 	{
+		// the account sees the reduction as a fill in the opposite direction of the position
+		const auto& position = portfolio_.getPosition(posId);
+		const auto reducedShares = abs(numShares) < abs(position.shares) ? abs(numShares) : abs(position.shares);
+		account_.fill(position.ticker, position.shares > 0 ? -reducedShares : reducedShares, price);
+
 		portfolio_.reducePosition(posId, price, numShares);
 		fillNotification(price, time);
 	};
+
 	if (liveTrade_)
 	{
 		auto currentPosition = getPosition(posId);
@@ -194,19 +242,19 @@ void LocalBroker::reducePosition(PositionId posId, int numShares, std::function<
 		// long. use ShortMarket to reduce the shares
 		if (currentPosition.shares > 0)
 		{
-			activeFillNotificationListenersHandles.push_back(ibApi_->shortMarket(currentPosition.ticker, abs(numShares), reducePositionFillNotification));
+			trackOrder(ibApi_->shortMarket(currentPosition.ticker, abs(numShares), reducePositionFillNotification), nullptr);
 		}
 		// else this is a short. use long to reduce the shares
 		else if (currentPosition.shares < 0)
 		{
-			activeFillNotificationListenersHandles.push_back(ibApi_->longMarket(currentPosition.ticker, abs(numShares), reducePositionFillNotification));
+			trackOrder(ibApi_->longMarket(currentPosition.ticker, abs(numShares), reducePositionFillNotification), nullptr);
 		}
 	}
 	//if not live trading, then all market positions are filled instantly at the last seen price
 	else
 	{
 		// autofill
-		reducePositionFillNotification(tickSource_.lastTick().price, tickSource_.lastTick().time);
+		reducePositionFillNotification(tickSource_->lastTick().price, tickSource_->lastTick().time);
 	}
 }
 
@@ -217,13 +265,23 @@ Position LocalBroker::getPosition(PositionId posId)
 
 CallbackHandle LocalBroker::registerListener(TickListener callback)
 {
-	activeTickListenerHandle = tickSource_.registerListener(callback);
+	activeTickListenerHandle = tickSource_->registerListener(callback);
 	return activeTickListenerHandle;
 }
 
 void LocalBroker::unregisterListener(CallbackHandle handle)
 {
-	tickSource_.unregisterCallback(handle);
+	tickSource_->unregisterCallback(handle);
+}
+
+std::shared_ptr<PlotTickRing> LocalBroker::chartTicks() const
+{
+	return tickSource_->chartTicks();
+}
+
+FeedIndicators& LocalBroker::feedIndicators(int timeFrameSeconds)
+{
+	return tickSource_->indicators(timeFrameSeconds);
 }
 
 void LocalBroker::closePosition(PositionId posId, std::function<void(double, time_t)> fillNotification)
@@ -233,6 +291,9 @@ void LocalBroker::closePosition(PositionId posId, std::function<void(double, tim
 	// the context to dispatch to the caller
 	auto closePositionFillNotification = [this, posId, fillNotification](double price, time_t time)
 	{
+		const auto& position = portfolio_.getPosition(posId);
+		account_.fill(position.ticker, -position.shares, price);
+
 		portfolio_.closePosition(posId, price, time);
 		fillNotification(price, time);
 	};
@@ -244,12 +305,12 @@ void LocalBroker::closePosition(PositionId posId, std::function<void(double, tim
 		// long. use ShortMarket to close the position
 		if (currentPosition.shares > 0)
 		{
-			activeFillNotificationListenersHandles.push_back(ibApi_->shortMarket(currentPosition.ticker, abs(currentPosition.shares), closePositionFillNotification));
+			trackOrder(ibApi_->shortMarket(currentPosition.ticker, abs(currentPosition.shares), closePositionFillNotification), nullptr);
 		}
 		// else this is a short. use long to close the position
 		else if (currentPosition.shares < 0)
 		{
-			activeFillNotificationListenersHandles.push_back(ibApi_->longMarket(currentPosition.ticker, abs(currentPosition.shares), closePositionFillNotification));
+			trackOrder(ibApi_->longMarket(currentPosition.ticker, abs(currentPosition.shares), closePositionFillNotification), nullptr);
 		}
 
 	}
@@ -257,6 +318,84 @@ void LocalBroker::closePosition(PositionId posId, std::function<void(double, tim
 	else
 	{
 		// autofill
-		closePositionFillNotification(tickSource_.lastTick().price, tickSource_.lastTick().time);
+		closePositionFillNotification(tickSource_->lastTick().price, tickSource_->lastTick().time);
+	}
+}
+
+LocalBroker::OrderReservation::OrderReservation(SymbolBook& book, int shares) :
+	symbolBook(book),
+	signedShares(shares),
+	released(false)
+{
+}
+
+std::shared_ptr<LocalBroker::OrderReservation> LocalBroker::passRiskGate(const std::string& ticker, int signedShares, double price)
+{
+	// orders cancelled since the last one give their shares back before this one is checked
+	retireOrders();
+
+	auto& book = symbolBook(ticker);
+	auto check = riskGate_.checkOrder(book, signedShares, price);
+	if (check != RiskCheck::ACCEPTED)
+	{
+		std::cout << "Risk gate rejected " << signedShares << " shares of " << ticker << " at " << price << ": " << riskCheckToString(check) << std::endl;
+		return nullptr;
+	}
+	return std::make_shared<OrderReservation>(book, signedShares);
+}
+
+void LocalBroker::releaseReservation(OrderReservation& reservation)
+{
+	if (!reservation.released.exchange(true))
+	{
+		riskGate_.releaseOrder(reservation.symbolBook, reservation.signedShares);
+	}
+}
+
+SymbolBook& LocalBroker::symbolBook(const std::string& ticker)
+{
+	// orders are placed from the algorithm thread only. caching the book here
+	// keeps the account's shard lock off the order path
+	auto& cachedBook = symbolBooks_[ticker];
+	if (cachedBook == nullptr)
+	{
+		cachedBook = &account_.book(ticker);
+	}
+	return *cachedBook;
+}
+
+void LocalBroker::trackOrder(int orderHandle, std::shared_ptr<OrderReservation> reservation)
+{
+	retireOrders();
+
+	if (ibApi_->isOrderActive(orderHandle))
+	{
+		activeOrderHandles_[orderHandle] = reservation;
+	}
+	// already filled, or never got in
+	else if (reservation != nullptr)
+	{
+		releaseReservation(*reservation);
+	}
+}
+
+void LocalBroker::retireOrders()
+{
+	// orders are retired by the ib client once they are filled or cancelled. drop the
+	// retired handles here so that only the orders still in flight are kept around. a
+	// filled order has already released its shares, so this only frees the cancelled ones
+	for (auto order = activeOrderHandles_.begin(); order != activeOrderHandles_.end();)
+	{
+		if (ibApi_->isOrderActive(order->first))
+		{
+			++order;
+			continue;
+		}
+
+		if (order->second != nullptr)
+		{
+			releaseReservation(*order->second);
+		}
+		order = activeOrderHandles_.erase(order);
 	}
 }
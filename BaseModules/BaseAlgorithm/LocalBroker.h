@@ -3,9 +3,12 @@
 #include "../InteractiveBrokersApi/CommonDefs.h"
 #include "../InteractiveBrokersClient/InteractiveBrokersClient.h"
 #include "Common.h"
+#include "Account.h"
 #include "Portfolio.h"
-#include "TickBroadcast.h"
+#include "RiskGate.h"
+#include "SymbolFeedRegistry.h"
 
+#include <atomic>
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -25,6 +28,12 @@ public:
 	CallbackHandle registerListener(TickListener callback);
 	void unregisterListener(CallbackHandle handle);
 
+	// ticks of the feed for the charts, shared with every other local broker on the input
+	std::shared_ptr<PlotTickRing> chartTicks() const;
+
+	// indicators on the candles of the feed, shared the same way
+	FeedIndicators& feedIndicators(int timeFrameSeconds);
+
 // order api
 public:
 	//basic order api. Parent will use these to implement their own local stoploss handler. This provides more flexibility
@@ -38,9 +47,36 @@ public:
 
 private:
 	std::shared_ptr<InteractiveBrokersClient> ibApi_;
-	TickBroadcast tickSource_;
+
+	// the feed of the input, shared with every other local broker on it
+	std::shared_ptr<TickBroadcast> tickSource_;
 
 	Portfolio portfolio_;
+
+	// process wide account shared with every other local broker
+	Account& account_;
+
+	// every order opening or adding to a position is checked by the risk gate on the calling
+	// thread before it is submitted. orders reducing a position are never held back
+	RiskGate& riskGate_;
+
+	// shares an accepted order holds against the position limit. released once, by whichever
+	// comes first of its fill on the ib thread and its retirement seen on the algorithm thread
+	struct OrderReservation
+	{
+		OrderReservation(SymbolBook& book, int shares);
+
+		SymbolBook& symbolBook;
+		const int signedShares;
+		std::atomic<bool> released;
+	};
+
+	// returns nullptr if the order is rejected
+	std::shared_ptr<OrderReservation> passRiskGate(const std::string& ticker, int signedShares, double price);
+	void releaseReservation(OrderReservation& reservation);
+
+	std::unordered_map<std::string, SymbolBook*> symbolBooks_;
+	SymbolBook& symbolBook(const std::string& ticker);
 	const bool liveTrade_; 
 	bool valid_;
 
@@ -49,5 +85,11 @@ private:
 	// the parent class will go out of scope before ib api. when ib api 
 	// tries to delete the std::function, seg fault.
 	int activeTickListenerHandle;
-	std::list<int> activeFillNotificationListenersHandles;
+
+	// orders still in flight and what they reserved, nullptr for the orders reducing a position
+	std::unordered_map<int, std::shared_ptr<OrderReservation>> activeOrderHandles_;
+	void trackOrder(int orderHandle, std::shared_ptr<OrderReservation> reservation);
+
+	// releases the reservations of the orders ib has retired without a fill, eg. cancelled
+	void retireOrders();
 };
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+
+//
+// Token bucket used by the risk gate to throttle order submission. It is implemented as a generic
+// cell rate algorithm so that the whole bucket is a single atomic: the theoretical arrival time of
+// the next order. Rate and burst are passed in by the caller so that the same limiter can be shared
+// by limits that are reconfigured at run time.
+//
+class OrderRateLimiter
+{
+public:
+	OrderRateLimiter() :
+		theoreticalArrivalNs_(0)
+	{
+	}
+
+	// returns true if an order arriving at nowNs fits in the bucket. intervalNs is the time
+	// between orders at the sustained rate and burst is the number of orders allowed back to back
+	bool tryAcquire(long long nowNs, long long intervalNs, int burst)
+	{
+		const long long toleranceNs = intervalNs * (burst > 1 ? burst - 1 : 0);
+		auto theoreticalArrivalNs = theoreticalArrivalNs_.load(std::memory_order_relaxed);
+		long long nextArrivalNs;
+		do
+		{
+			const auto arrivalNs = theoreticalArrivalNs > nowNs ? theoreticalArrivalNs : nowNs;
+			if (arrivalNs - nowNs > toleranceNs)
+			{
+				return false;
+			}
+			nextArrivalNs = arrivalNs + intervalNs;
+		} while (!theoreticalArrivalNs_.compare_exchange_weak(theoreticalArrivalNs, nextArrivalNs, std::memory_order_relaxed));
+
+		return true;
+	}
+
+	// whether tryAcquire would succeed now, without taking anything from the bucket
+	bool canAcquire(long long nowNs, long long intervalNs, int burst) const
+	{
+		const long long toleranceNs = intervalNs * (burst > 1 ? burst - 1 : 0);
+		const auto theoreticalArrivalNs = theoreticalArrivalNs_.load(std::memory_order_relaxed);
+		const auto arrivalNs = theoreticalArrivalNs > nowNs ? theoreticalArrivalNs : nowNs;
+		return arrivalNs - nowNs <= toleranceNs;
+	}
+
+	// returns a token taken by tryAcquire for an order that was not sent after all
+	void giveBack(long long intervalNs)
+	{
+		theoreticalArrivalNs_.fetch_sub(intervalNs, std::memory_order_relaxed);
+	}
+
+private:
+	std::atomic<long long> theoreticalArrivalNs_;
+};
@@ -1,16 +1,222 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include <list>
+#include <vector>
 #include "Common.h"
 
-// plot data structure shared with the gui. plot data is stored in this format.
-// the gui is provided an address to the plot data struct and notified upon 
-// new data
+//
+// Tick as sent to the gui. A single tick has the same open, high, low and close. When the gui falls
+// too far behind, consecutive ticks are conflated into one of these instead: the open, high, low and
+// close of the run, the total size and notional and the number of ticks it stands for. sequence is
+// the order of the first tick of the run.
+//
+struct PlotTick
+{
+    time_t firstTime;
+    time_t time;
+    double open;
+    double high;
+    double low;
+    double close;
+    long long size;
+    double notional;
+    int count;
+    unsigned long long sequence;
+};
+
+//
+// Bounded single producer, single consumer ring of ticks between the algorithm thread and the gui.
+// Neither side ever waits on the other. When the ring is full, the algorithm conflates the ticks
+// into a run held aside in a mailbox rather than blocking. The run goes into the ring ahead of any
+// later tick as soon as there is room, or the gui takes it directly from the mailbox on its next
+// drain, so no tick is lost and the ticks are read in order.
+//
+class PlotTickRing
+{
+public:
+    static const size_t CAPACITY = 8192;
+
+    PlotTickRing() :
+        head_(0),
+        tail_(0),
+        mailbox_(nullptr),
+        sequence_(0),
+        run_(0),
+        runPosted_(false)
+    {
+    }
+
+    PlotTickRing(const PlotTickRing&) = delete;
+    PlotTickRing& operator=(const PlotTickRing&) = delete;
+
+    //
+    // algorithm thread only
+    //
+    void push(const Tick& tick)
+    {
+        auto run = mailbox_.exchange(nullptr, std::memory_order_acq_rel);
+        if (run != nullptr)
+        {
+            // a conflated run is waiting, it has to go into the ring before this tick
+            if (!publish(*run))
+            {
+                conflate(*run, tick);
+                mailbox_.store(run, std::memory_order_release);
+                return;
+            }
+        }
+        else if (runPosted_)
+        {
+            // the gui took the run and may still be copying it, the next run goes in the other slot
+            run_ ^= 1;
+        }
+        runPosted_ = false;
+
+        PlotTick plotTick{ tick.time, tick.time, tick.price, tick.price, tick.price, tick.price, tick.size, tick.price * tick.size, 1, ++sequence_ };
+        if (!publish(plotTick))
+        {
+            runs_[run_] = plotTick;
+            mailbox_.store(&runs_[run_], std::memory_order_release);
+            runPosted_ = true;
+        }
+    }
+
+    //
+    // gui thread only. appends every tick available, oldest first
+    //
+    size_t drain(std::vector<PlotTick>& ticks)
+    {
+        auto first = ticks.size();
+
+        // the run is taken before the ring is read. every tick older than it is already in the ring
+        auto run = mailbox_.exchange(nullptr, std::memory_order_acq_rel);
+        PlotTick runTick;
+        if (run != nullptr)
+        {
+            runTick = *run;
+        }
+
+        auto tail = tail_.load(std::memory_order_relaxed);
+        auto head = head_.load(std::memory_order_acquire);
+        for (; tail != head; ++tail)
+        {
+            ticks.push_back(ticks_[tail % CAPACITY]);
+        }
+        tail_.store(tail, std::memory_order_release);
+
+        if (run != nullptr)
+        {
+            auto position = std::find_if(ticks.begin() + first, ticks.end(), [&runTick](const PlotTick& plotTick)
+            {
+                return plotTick.sequence > runTick.sequence;
+            });
+            ticks.insert(position, runTick);
+        }
+        return ticks.size() - first;
+    }
+
+private:
+    bool publish(const PlotTick& plotTick)
+    {
+        auto head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == CAPACITY)
+        {
+            return false;
+        }
+        ticks_[head % CAPACITY] = plotTick;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    static void conflate(PlotTick& run, const Tick& tick)
+    {
+        run.time = tick.time;
+        run.high = std::max(run.high, tick.price);
+        run.low = std::min(run.low, tick.price);
+        run.close = tick.price;
+        run.size += tick.size;
+        run.notional += tick.price * tick.size;
+        ++run.count;
+    }
+
+    std::array<PlotTick, CAPACITY> ticks_;
+    std::atomic<size_t> head_;
+    std::atomic<size_t> tail_;
+
+    // the run being conflated. it alternates between two slots so that a new run never overwrites
+    // the one the gui may still be copying out of the mailbox
+    std::array<PlotTick, 2> runs_;
+    std::atomic<PlotTick*> mailbox_;
+    unsigned long long sequence_;
+    size_t run_;
+    bool runPosted_;
+};
+
+//
+// Annotations from the algorithm to the gui. Any thread may push, only the gui takes them. A push
+// is a single compare and swap and never waits on the gui.
+//
+class AnnotationQueue
+{
+public:
+    AnnotationQueue() :
+        head_(nullptr)
+    {
+    }
+
+    ~AnnotationQueue()
+    {
+        takeAll();
+    }
+
+    AnnotationQueue(const AnnotationQueue&) = delete;
+    AnnotationQueue& operator=(const AnnotationQueue&) = delete;
+
+    void push(std::shared_ptr<Annotation::IAnnotation> annotation)
+    {
+        auto node = new Node{ std::move(annotation), head_.load(std::memory_order_relaxed) };
+        while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    //
+    // gui thread only. every annotation pushed so far, oldest first
+    //
+    std::vector<std::shared_ptr<Annotation::IAnnotation>> takeAll()
+    {
+        std::vector<std::shared_ptr<Annotation::IAnnotation>> annotations;
+        auto node = head_.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr)
+        {
+            annotations.push_back(std::move(node->annotation));
+            auto next = node->next;
+            delete node;
+            node = next;
+        }
+        std::reverse(annotations.begin(), annotations.end());
+        return annotations;
+    }
+
+private:
+    struct Node
+    {
+        std::shared_ptr<Annotation::IAnnotation> annotation;
+        Node* next;
+    };
+
+    std::atomic<Node*> head_;
+};
+
+// plot data structure shared with the gui. the algorithm thread pushes into it and
+// the gui drains it on its refresh timer, neither of them locks. the ticks are the ones
+// of the algorithm's feed, the same ring for every algorithm on the input, so the gui
+// drains it once for all of them
 struct PlotData
 {
-    std::mutex plotDataMtx;
-    std::list<Tick> ticks;
-    std::list<std::shared_ptr<Annotation::IAnnotation>> annotations;
+    std::shared_ptr<PlotTickRing> ticks;
+    AnnotationQueue annotations;
 };
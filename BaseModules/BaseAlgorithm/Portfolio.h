@@ -5,7 +5,8 @@
 #include "Common.h"
 
 // Portfolio contains many different trade positions of a SINGLE stock
-// Each position is identified by the position id. 
+// Each position is identified by the position id. The combined view of every
+// stock traded in the process is kept by Account.
 class Portfolio
 {
 public:
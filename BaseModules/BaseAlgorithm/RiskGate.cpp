@@ -0,0 +1,199 @@
+#include "RiskGate.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+	long long rateToIntervalNs(double ordersPerSecond)
+	{
+		return ordersPerSecond > 0 ? static_cast<long long>(1e9 / ordersPerSecond) : 0;
+	}
+
+	double intervalNsToRate(long long intervalNs)
+	{
+		return intervalNs > 0 ? 1e9 / intervalNs : 0;
+	}
+}
+
+RiskGate::RiskGate() :
+	killSwitch_(false),
+	maxOrderShares_(0),
+	maxPositionShares_(0),
+	maxOrderNotional_(0),
+	orderIntervalNs_(0),
+	orderBurst_(0),
+	symbolOrderIntervalNs_(0),
+	symbolOrderBurst_(0)
+{
+}
+
+void RiskGate::setLimits(const RiskLimits& limits)
+{
+	maxOrderShares_.store(limits.maxOrderShares, std::memory_order_relaxed);
+	maxPositionShares_.store(limits.maxPositionShares, std::memory_order_relaxed);
+	maxOrderNotional_.store(limits.maxOrderNotional, std::memory_order_relaxed);
+	orderIntervalNs_.store(rateToIntervalNs(limits.maxOrdersPerSecond), std::memory_order_relaxed);
+	orderBurst_.store(limits.orderBurst, std::memory_order_relaxed);
+	symbolOrderIntervalNs_.store(rateToIntervalNs(limits.maxSymbolOrdersPerSecond), std::memory_order_relaxed);
+	symbolOrderBurst_.store(limits.symbolOrderBurst, std::memory_order_relaxed);
+}
+
+RiskLimits RiskGate::limits() const
+{
+	RiskLimits riskLimits;
+	riskLimits.maxOrderShares = maxOrderShares_.load(std::memory_order_relaxed);
+	riskLimits.maxPositionShares = maxPositionShares_.load(std::memory_order_relaxed);
+	riskLimits.maxOrderNotional = maxOrderNotional_.load(std::memory_order_relaxed);
+	riskLimits.maxOrdersPerSecond = intervalNsToRate(orderIntervalNs_.load(std::memory_order_relaxed));
+	riskLimits.orderBurst = orderBurst_.load(std::memory_order_relaxed);
+	riskLimits.maxSymbolOrdersPerSecond = intervalNsToRate(symbolOrderIntervalNs_.load(std::memory_order_relaxed));
+	riskLimits.symbolOrderBurst = symbolOrderBurst_.load(std::memory_order_relaxed);
+	return riskLimits;
+}
+
+void RiskGate::engageKillSwitch()
+{
+	killSwitch_.store(true, std::memory_order_relaxed);
+}
+
+void RiskGate::releaseKillSwitch()
+{
+	killSwitch_.store(false, std::memory_order_relaxed);
+}
+
+bool RiskGate::killSwitchEngaged() const
+{
+	return killSwitch_.load(std::memory_order_relaxed);
+}
+
+RiskCheck RiskGate::checkOrder(SymbolBook& symbolBook, int signedShares, double price)
+{
+	if (killSwitch_.load(std::memory_order_relaxed))
+	{
+		return RiskCheck::KILL_SWITCH;
+	}
+
+	// a non positive size is as much of a bug as an oversized one. eg. sizing an order
+	// with 100 / riskPerShare when riskPerShare is 0 or negative
+	const int maxOrderShares = maxOrderShares_.load(std::memory_order_relaxed);
+	if (signedShares == 0 || (maxOrderShares > 0 && abs(signedShares) > maxOrderShares))
+	{
+		return RiskCheck::ORDER_SIZE;
+	}
+
+	// eg. a market order sent before the first tick
+	if (!(price > 0))
+	{
+		return RiskCheck::NO_PRICE;
+	}
+
+	const double orderNotional = std::fabs(signedShares * price);
+	const double maxOrderNotional = maxOrderNotional_.load(std::memory_order_relaxed);
+	if (maxOrderNotional > 0 && orderNotional > maxOrderNotional)
+	{
+		return RiskCheck::NOTIONAL_LIMIT;
+	}
+
+	// buying power is shared by every algorithm in the process through the account
+	auto& account = GetAccount();
+	if (account.buyingPower() > 0 && orderNotional > account.availableBuyingPower())
+	{
+		return RiskCheck::BUYING_POWER;
+	}
+
+	// the shares are reserved before the position is checked so that two orders checked at the
+	// same time can't both pass on the same room under the limit
+	auto& pendingShares = signedShares > 0 ? symbolBook.pendingBuyShares_ : symbolBook.pendingSellShares_;
+	const int pendingAfter = pendingShares.fetch_add(signedShares, std::memory_order_relaxed) + signedShares;
+	const int maxPositionShares = maxPositionShares_.load(std::memory_order_relaxed);
+	if (maxPositionShares > 0 && abs(symbolBook.shares() + pendingAfter) > maxPositionShares)
+	{
+		pendingShares.fetch_sub(signedShares, std::memory_order_relaxed);
+		return RiskCheck::POSITION_LIMIT;
+	}
+
+	const auto rateCheck = checkOrderRate(symbolBook);
+	if (rateCheck != RiskCheck::ACCEPTED)
+	{
+		pendingShares.fetch_sub(signedShares, std::memory_order_relaxed);
+	}
+	return rateCheck;
+}
+
+void RiskGate::releaseOrder(SymbolBook& symbolBook, int signedShares)
+{
+	auto& pendingShares = signedShares > 0 ? symbolBook.pendingBuyShares_ : symbolBook.pendingSellShares_;
+	pendingShares.fetch_sub(signedShares, std::memory_order_relaxed);
+}
+
+RiskCheck RiskGate::checkOrderRate(SymbolBook& symbolBook)
+{
+	const long long orderIntervalNs = orderIntervalNs_.load(std::memory_order_relaxed);
+	const long long symbolOrderIntervalNs = symbolOrderIntervalNs_.load(std::memory_order_relaxed);
+	if (orderIntervalNs == 0 && symbolOrderIntervalNs == 0)
+	{
+		return RiskCheck::ACCEPTED;
+	}
+
+	using namespace std::chrono;
+	const long long nowNs = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+
+	const int symbolOrderBurst = symbolOrderBurst_.load(std::memory_order_relaxed);
+
+	// neither bucket is charged for an order the other one rejects. the symbol bucket is looked
+	// at first, then the process wide one is charged, then the symbol one. if another order on the
+	// symbol took its last token in between, the process wide token is given back
+	if (symbolOrderIntervalNs > 0 && !symbolBook.orderRate_.canAcquire(nowNs, symbolOrderIntervalNs, symbolOrderBurst))
+	{
+		return RiskCheck::SYMBOL_ORDER_RATE;
+	}
+
+	if (orderIntervalNs > 0 && !orderRate_.tryAcquire(nowNs, orderIntervalNs, orderBurst_.load(std::memory_order_relaxed)))
+	{
+		return RiskCheck::ORDER_RATE;
+	}
+
+	if (symbolOrderIntervalNs > 0 && !symbolBook.orderRate_.tryAcquire(nowNs, symbolOrderIntervalNs, symbolOrderBurst))
+	{
+		if (orderIntervalNs > 0)
+		{
+			orderRate_.giveBack(orderIntervalNs);
+		}
+		return RiskCheck::SYMBOL_ORDER_RATE;
+	}
+
+	return RiskCheck::ACCEPTED;
+}
+
+const char* riskCheckToString(RiskCheck check)
+{
+	switch (check)
+	{
+	case RiskCheck::ACCEPTED:
+		return "accepted";
+	case RiskCheck::KILL_SWITCH:
+		return "kill switch engaged";
+	case RiskCheck::ORDER_SIZE:
+		return "order size limit";
+	case RiskCheck::NO_PRICE:
+		return "no price";
+	case RiskCheck::POSITION_LIMIT:
+		return "position limit";
+	case RiskCheck::NOTIONAL_LIMIT:
+		return "order notional limit";
+	case RiskCheck::BUYING_POWER:
+		return "insufficient buying power";
+	case RiskCheck::ORDER_RATE:
+		return "order rate limit";
+	case RiskCheck::SYMBOL_ORDER_RATE:
+		return "symbol order rate limit";
+	}
+	return "unknown";
+}
+
+RiskGate& GetRiskGate()
+{
+	static RiskGate riskGate;
+	return riskGate;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include "Account.h"
+#include "OrderRateLimiter.h"
+
+// limits enforced by the risk gate. a limit of 0 means that it is not enforced
+struct RiskLimits
+{
+	int maxOrderShares;
+	int maxPositionShares;
+	double maxOrderNotional;
+
+	// order rate limits for the whole process and for each symbol
+	double maxOrdersPerSecond;
+	int orderBurst;
+	double maxSymbolOrdersPerSecond;
+	int symbolOrderBurst;
+};
+
+enum class RiskCheck
+{
+	ACCEPTED,
+	KILL_SWITCH,
+	ORDER_SIZE,
+	NO_PRICE,
+	POSITION_LIMIT,
+	NOTIONAL_LIMIT,
+	BUYING_POWER,
+	ORDER_RATE,
+	SYMBOL_ORDER_RATE
+};
+
+//
+// Pre-trade risk checks evaluated on the calling thread before an order is handed to interactive
+// brokers (or filled locally when paper trading). Everything the gate reads is an atomic so an order
+// never waits on a lock to be checked.
+//
+// Orders opening or adding to a position go through every check. Orders reducing a position are never
+// checked so that positions can always be flattened, even with the kill switch engaged or the order
+// rate used up.
+//
+// An accepted order reserves its shares on the symbol book until it is filled or retired, so orders
+// sent faster than they fill can't add up past the position limit. The caller releases them.
+//
+class RiskGate
+{
+public:
+	RiskGate();
+	RiskGate(const RiskGate& other) = delete;
+	RiskGate& operator=(const RiskGate& other) = delete;
+
+	void setLimits(const RiskLimits& limits);
+	RiskLimits limits() const;
+
+	// kill switch rejects all orders opening or adding to a position
+	void engageKillSwitch();
+	void releaseKillSwitch();
+	bool killSwitchEngaged() const;
+
+	// price is the limit price or, for a market order, the last price. an order without a price
+	// can't be valued and is rejected
+	RiskCheck checkOrder(SymbolBook& symbolBook, int signedShares, double price);
+
+	// gives back the shares reserved by an accepted order once it is filled or retired
+	void releaseOrder(SymbolBook& symbolBook, int signedShares);
+
+private:
+	std::atomic<bool> killSwitch_;
+
+	std::atomic<int> maxOrderShares_;
+	std::atomic<int> maxPositionShares_;
+	std::atomic<double> maxOrderNotional_;
+
+	std::atomic<long long> orderIntervalNs_;
+	std::atomic<int> orderBurst_;
+	std::atomic<long long> symbolOrderIntervalNs_;
+	std::atomic<int> symbolOrderBurst_;
+
+	OrderRateLimiter orderRate_;
+
+	RiskCheck checkOrderRate(SymbolBook& symbolBook);
+};
+
+const char* riskCheckToString(RiskCheck check);
+
+// process wide risk gate shared by every local broker
+RiskGate& GetRiskGate();
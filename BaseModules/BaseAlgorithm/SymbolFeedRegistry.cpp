@@ -0,0 +1,33 @@
+#include "SymbolFeedRegistry.h"
+
+std::shared_ptr<TickBroadcast> SymbolFeedRegistry::acquire(const std::string& input, std::shared_ptr<InteractiveBrokersClient> ibApi)
+{
+	std::lock_guard<std::mutex> lock(feedsMtx_);
+
+	auto feed = feeds_[input].lock();
+	if (feed == nullptr || !feed->joinable())
+	{
+		// drop the entries of the feeds that were released before making a new one
+		for (auto it = feeds_.begin(); it != feeds_.end();)
+		{
+			if (it->first != input && it->second.expired())
+			{
+				it = feeds_.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		feed = std::make_shared<TickBroadcast>(input, ibApi);
+		feeds_[input] = feed;
+	}
+	return feed;
+}
+
+SymbolFeedRegistry& GetSymbolFeedRegistry()
+{
+	static SymbolFeedRegistry symbolFeedRegistry;
+	return symbolFeedRegistry;
+}
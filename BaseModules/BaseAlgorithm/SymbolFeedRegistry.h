@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "TickBroadcast.h"
+
+//
+// Process wide registry of tick feeds, one for each input: a recorded tick file or a ticker streamed
+// from interactive brokers. Every local broker on the same input shares its feed, so the file is read
+// and parsed once, or the stream requested once, however many algorithms and charts run on it. Each
+// tick is then only paid for once, plus one call to every algorithm listening.
+//
+// A feed is created by the first local broker asking for it and destroyed with the last one holding
+// it. Opening the same input again after that starts a new feed, and so does opening a recorded file
+// whose feed already started playing: a backtest run again plays the file from its beginning, the
+// earlier feed goes on for the brokers that hold it.
+//
+class SymbolFeedRegistry
+{
+public:
+	SymbolFeedRegistry() = default;
+	SymbolFeedRegistry(const SymbolFeedRegistry& other) = delete;
+	SymbolFeedRegistry& operator=(const SymbolFeedRegistry& other) = delete;
+
+	// feed of the input, created if no one holds it. throws if a new feed can't be created
+	std::shared_ptr<TickBroadcast> acquire(const std::string& input, std::shared_ptr<InteractiveBrokersClient> ibApi);
+
+private:
+	std::mutex feedsMtx_;
+
+	// the registry doesn't keep a feed alive, its local brokers do
+	std::unordered_map<std::string, std::weak_ptr<TickBroadcast>> feeds_;
+};
+
+// process wide feed registry shared by every local broker
+SymbolFeedRegistry& GetSymbolFeedRegistry();
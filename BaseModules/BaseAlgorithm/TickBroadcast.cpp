@@ -6,12 +6,16 @@
 #include "TickBroadcast.h"
 
 TickBroadcast::TickBroadcast(std::string input, std::shared_ptr<InteractiveBrokersClient> ibApiPtr) :
+	uniqueCallbackHandles_(0),
+	chartTicks_(std::make_shared<PlotTickRing>()),
 	input_(input),
 	ibApi_(ibApiPtr),
 	threadCancellationToken_(false),
+	running_(false),
 	dataStreamHandle_(-1),
 	finished_(false),
-	realTimeStream_(false)
+	realTimeStream_(false),
+	lastPrice_(0)
 {
 	if (input.find(".tickdat") != std::string::npos)
 	{
@@ -50,14 +54,45 @@ bool TickBroadcast::finished() const
 	return finished_;
 }
 
+bool TickBroadcast::joinable() const
+{
+	return realTimeStream_ || !running_;
+}
+
 Tick TickBroadcast::lastTick() const
 {
 	std::lock_guard<std::mutex> tickLock(tickMtx_);
 	return lastTick_;
 }
 
+double TickBroadcast::lastPrice() const
+{
+	return lastPrice_.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<PlotTickRing> TickBroadcast::chartTicks() const
+{
+	return chartTicks_;
+}
+
+FeedIndicators& TickBroadcast::indicators(int timeFrameSeconds)
+{
+	std::lock_guard<std::mutex> lock(indicatorsMtx_);
+	auto& feedIndicators = indicators_[timeFrameSeconds];
+	if (feedIndicators == nullptr)
+	{
+		feedIndicators.reset(new FeedIndicators(timeFrameSeconds));
+	}
+	return *feedIndicators;
+}
+
 void TickBroadcast::run()
 {	
+	if (running_.exchange(true))
+	{
+		return;
+	}
+
 	//
 	// Check if it's a recorded data input for backtesting
 	//
@@ -189,8 +224,17 @@ void TickBroadcast::broadcastTick(const Tick & tick)
 		std::unique_lock<std::mutex> tickLock(tickMtx_);
 		//save the tick before broadcasting
 		lastTick_ = tick;
+		lastPrice_.store(tick.price, std::memory_order_relaxed);
 		tickLock.unlock();
 
+		// the indicators take the tick first so that the listeners read them as of the candle it closes
+		std::unique_lock<std::mutex> indicatorsLock(indicatorsMtx_);
+		for (auto& feedIndicators : indicators_)
+		{
+			feedIndicators.second->takeTick(tick);
+		}
+		indicatorsLock.unlock();
+
 		//dispatch the tick to the registered callbacks under a lock
 		std::lock_guard<std::mutex> lock(callbackListMtx_);
 		for (auto& fn : listeners_)
@@ -202,5 +246,8 @@ void TickBroadcast::broadcastTick(const Tick & tick)
 
 			fn.second(lastTick_);
 		}
+
+		// never waits on the gui. if the gui is behind, the tick is conflated with the ones it hasn't taken yet
+		chartTicks_->push(lastTick_);
 	}
 }
@@ -6,6 +6,8 @@
 #include <mutex>
 #include <unordered_map>
 #include "Common.h"
+#include "FeedIndicators.h"
+#include "PlotData.h"
 
 class TickBroadcast
 {
@@ -16,14 +18,29 @@ public:
 	CallbackHandle registerListener(TickListener callback);
 	void unregisterCallback(CallbackHandle handle);
 	bool finished() const;
+
+	// whether another local broker may join the feed. a stream can be joined any time, a recorded
+	// file only before it starts playing, so that every algorithm on it is given the whole file
+	bool joinable() const;
 	Tick lastTick() const;
 
+	// price of the last tick without copying the whole tick under the lock
+	double lastPrice() const;
+
 	// we want the data source to start running when the parent has set up everything
 	// if we don't have a run function, the ticks would be fired before the parent 
 	// has a chance to construct everything else. this would cause loss of data in the case
-	// of playback mode
+	// of playback mode. a feed shared by several local brokers starts on the first call
 	void run();
 
+	// every tick broadcast, for the charts. the ring has a single reader however many
+	// algorithms listen to the feed
+	std::shared_ptr<PlotTickRing> chartTicks() const;
+
+	// indicators on the candles of timeFrameSeconds of the feed, made by the first algorithm
+	// asking for them and kept as long as the feed. see FeedIndicators
+	FeedIndicators& indicators(int timeFrameSeconds);
+
 private:
 	void broadcastTick(const Tick& tick);
 	void readTickFile(void);
@@ -32,11 +49,19 @@ private:
 	// tick is written from another thread. protect with lock 
 	mutable std::mutex tickMtx_;
 	Tick lastTick_;
+	std::atomic<double> lastPrice_;
 
 	std::mutex callbackListMtx_;
 	CallbackHandle uniqueCallbackHandles_;
 	std::unordered_map<CallbackHandle, TickListener> listeners_;
 
+	// pushed after the listeners so a chart gets a tick with what the algorithms made of it
+	std::shared_ptr<PlotTickRing> chartTicks_;
+
+	// given every tick before the listeners
+	std::mutex indicatorsMtx_;
+	std::unordered_map<int, std::unique_ptr<FeedIndicators>> indicators_;
+
 	std::string input_;
 	bool realTimeStream_;
 
@@ -48,6 +73,7 @@ private:
 	// thread must be created after and destroyed before the callbacks
 	std::atomic<bool> threadCancellationToken_;
 	std::thread readTickDataThread_;
+	std::atomic<bool> running_;
 
 	bool valid_;
 	bool finished_; //finished doesn't need to be atomic since the tickHandler thread runs on the same thread as readTickFile thread
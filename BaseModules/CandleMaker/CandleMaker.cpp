@@ -1,5 +1,6 @@
 #include <ctime>
 #include "CandleMaker.h"
+#include "CandleRing.h"
 
 class CandleMaker::CandleMakerImpl
 {
@@ -18,15 +19,17 @@ public:
 	
 	//
 	// Has outstanding closed candles. Caller can retrieve them by calling getClosedCandles().
-	// Calling getClosedCanddles will clear the candle buffer.
+	// Calling getClosedCandles or popClosedCandle removes them from the buffer.
 	//
 	bool hasClosedCandles();
 
 	//
 	// Retrieve candles
 	//
+	bool popClosedCandle(Candlestick& candle);
+	const Candlestick& currentCandle();
+	void setCandleClosedCallback(std::function<void(const Candlestick&)> callback);
 	std::vector<Candlestick> getClosedCandles();
-	Candlestick getCurrentCandle();
 
 private:
 	//
@@ -65,10 +68,17 @@ private:
 	//
 	void aggregateCandle(const Tick& newTick);
 
-	std::vector<Candlestick> closedCandles;
+	CandleRing closedCandles;
+
+	//
+	// price times size of the ticks in the current candle. wap is updated from it with each tick
+	//
+	double notional;
 
 };
 
+static_assert(CandleMaker::CLOSED_CANDLE_CAPACITY == CandleRing::CAPACITY, "CandleMaker must report the capacity of its ring");
+
 
 CandleMaker::CandleMaker(int timeFrameSeconds) :
 	impl_(new CandleMakerImpl(timeFrameSeconds))
@@ -85,6 +95,21 @@ void CandleMaker::addTick(const Tick & newTick)
 	impl_->addTick(newTick);
 }
 
+bool CandleMaker::popClosedCandle(Candlestick& candle)
+{
+	return impl_->popClosedCandle(candle);
+}
+
+const Candlestick& CandleMaker::currentCandle()
+{
+	return impl_->currentCandle();
+}
+
+void CandleMaker::setCandleClosedCallback(std::function<void(const Candlestick&)> callback)
+{
+	impl_->setCandleClosedCallback(callback);
+}
+
 std::vector<Candlestick> CandleMaker::getClosedCandles()
 {
 	return impl_->getClosedCandles();
@@ -92,11 +117,13 @@ std::vector<Candlestick> CandleMaker::getClosedCandles()
 
 Candlestick CandleMaker::getCurrentCandle()
 {
-	return impl_->getCurrentCandle();
+	return impl_->currentCandle();
 }
 
 CandleMaker::CandleMakerImpl::CandleMakerImpl(int timeFrameSeconds) :
-	timeFrame(timeFrameSeconds)
+	timeFrame(timeFrameSeconds),
+	aggregatedCandle(),
+	notional(0)
 {
 	beginAggregation = false;
 	periodIndexInit = false;
@@ -133,7 +160,7 @@ void CandleMaker::CandleMakerImpl::addTick(const Tick & newTick)
 			if (beginAggregation)
 			{
 				//push the current candle to the closed candles
-				closedCandles.push_back(aggregatedCandle);
+				closedCandles.push(aggregatedCandle);
 			}
 			//create a new candle
 			aggregatedCandle.open = newTick.price;
@@ -141,7 +168,10 @@ void CandleMaker::CandleMakerImpl::addTick(const Tick & newTick)
 			aggregatedCandle.high = newTick.price;
 			aggregatedCandle.close = newTick.price;
 			aggregatedCandle.volume = newTick.size;
+			aggregatedCandle.wap = newTick.price;
+			aggregatedCandle.count = 1;
 			aggregatedCandle.time = newTick.time - (newTick.time % timeFrame); // candle time should align with the nearest timeframe
+			notional = newTick.price * newTick.size;
 
 			beginAggregation = true;
 
@@ -160,18 +190,34 @@ bool CandleMaker::CandleMakerImpl::hasClosedCandles()
 	return closedCandles.size() > 0;
 }
 
-std::vector<Candlestick> CandleMaker::CandleMakerImpl::getClosedCandles()
+bool CandleMaker::CandleMakerImpl::popClosedCandle(Candlestick& candle)
 {
-	auto retClosedCandles = std::move(closedCandles);
-	closedCandles.clear();
-	return retClosedCandles;
+	return closedCandles.pop(candle);
 }
 
-Candlestick CandleMaker::CandleMakerImpl::getCurrentCandle()
+const Candlestick& CandleMaker::CandleMakerImpl::currentCandle()
 {
 	return aggregatedCandle;
 }
 
+void CandleMaker::CandleMakerImpl::setCandleClosedCallback(std::function<void(const Candlestick&)> callback)
+{
+	closedCandles.setClosedCallback(callback);
+}
+
+std::vector<Candlestick> CandleMaker::CandleMakerImpl::getClosedCandles()
+{
+	std::vector<Candlestick> retClosedCandles;
+	retClosedCandles.reserve(closedCandles.size());
+
+	Candlestick candle;
+	while (closedCandles.pop(candle))
+	{
+		retClosedCandles.push_back(candle);
+	}
+	return retClosedCandles;
+}
+
 void CandleMaker::CandleMakerImpl::aggregateCandle(const Tick& newTick)
 {
 	aggregatedCandle.close = newTick.price;
@@ -181,5 +227,9 @@ void CandleMaker::CandleMakerImpl::aggregateCandle(const Tick& newTick)
 		aggregatedCandle.high = newTick.price;
 
 	aggregatedCandle.volume += newTick.size;
+	aggregatedCandle.count++;
+	notional += newTick.price * newTick.size;
+	if (aggregatedCandle.volume > 0)
+		aggregatedCandle.wap = notional / aggregatedCandle.volume;
 }
 
@@ -38,7 +38,23 @@ public:
 	void addTick(const Tick& newTick);
 
 	//
-	// Retrieve candles
+	// Retrieve candles without allocating. Closed candles are kept in a fixed size ring
+	// until they are popped. If more than CLOSED_CANDLE_CAPACITY candles are left unread,
+	// the oldest ones are overwritten. The reference to the current candle stays valid for
+	// the lifetime of the CandleMaker and is updated by addTick.
+	//
+	static const size_t CLOSED_CANDLE_CAPACITY = 256;
+	bool popClosedCandle(Candlestick& candle);
+	const Candlestick& currentCandle();
+
+	//
+	// Called from addTick with every candle as soon as it closes. Closed candles are
+	// still added to the ring.
+	//
+	void setCandleClosedCallback(std::function<void(const Candlestick&)> callback);
+
+	//
+	// Retrieve candles. Drains the ring of closed candles into a vector
 	//
 	std::vector<Candlestick> getClosedCandles();
 	Candlestick getCurrentCandle();
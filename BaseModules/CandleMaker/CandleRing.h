@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <functional>
+#include "CandleMaker.h"
+
+//
+// Fixed size ring of closed candles shared by the candle makers. Pushing and popping only copy
+// a candle and move a cursor, nothing is allocated once the maker is constructed. If the reader
+// falls behind by more than CAPACITY candles, the oldest candles are overwritten.
+//
+class CandleRing
+{
+public:
+	static const size_t CAPACITY = 256;
+
+	CandleRing() :
+		head_(0),
+		tail_(0)
+	{
+	}
+
+	void push(const Candlestick& candle)
+	{
+		candles_[head_ % CAPACITY] = candle;
+		++head_;
+		if (head_ - tail_ > CAPACITY)
+		{
+			tail_ = head_ - CAPACITY;
+		}
+
+		if (closedCallback_)
+		{
+			closedCallback_(candle);
+		}
+	}
+
+	bool pop(Candlestick& candle)
+	{
+		if (tail_ == head_)
+		{
+			return false;
+		}
+		candle = candles_[tail_ % CAPACITY];
+		++tail_;
+		return true;
+	}
+
+	size_t size() const
+	{
+		return head_ - tail_;
+	}
+
+	void setClosedCallback(std::function<void(const Candlestick&)> callback)
+	{
+		closedCallback_ = callback;
+	}
+
+private:
+	std::array<Candlestick, CAPACITY> candles_;
+	size_t head_;
+	size_t tail_;
+
+	std::function<void(const Candlestick&)> closedCallback_;
+};
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <stdexcept>
+#include "EventCandleMaker.h"
+#include "CandleRing.h"
+
+class EventCandleMaker::EventCandleMakerImpl
+{
+public:
+	EventCandleMakerImpl(BarType barType, double threshold);
+	~EventCandleMakerImpl();
+
+	//
+	// updates the EventCandleMaker by adding a tick
+	//
+	void addTick(const Tick& newTick);
+
+	//
+	// Retrieve candles
+	//
+	bool popClosedCandle(Candlestick& candle);
+	const Candlestick& currentCandle();
+	void setCandleClosedCallback(std::function<void(const Candlestick&)> callback);
+	std::vector<Candlestick> getClosedCandles();
+
+private:
+	BarType barType;
+	double threshold;
+
+	//
+	// true once the first tick has started a candle
+	//
+	bool beginAggregation;
+
+	//
+	// the current candle is complete. it is closed by the next tick
+	//
+	bool thresholdReached;
+
+	Candlestick aggregatedCandle;
+
+	//
+	// price times size of the ticks in the current candle. wap is updated from it with each tick
+	//
+	double notional;
+
+	CandleRing closedCandles;
+
+private:
+	//
+	// starts a new candle with the tick
+	//
+	void beginCandle(const Tick& newTick);
+
+	//
+	// Aggregates the current candle when a new price tick comes in.
+	//
+	void aggregateCandle(const Tick& newTick);
+
+	//
+	// checks the volume, tick and dollar thresholds after the candle is updated
+	//
+	bool isThresholdReached() const;
+};
+
+EventCandleMaker::EventCandleMaker(BarType barType, double threshold) :
+	impl_(new EventCandleMakerImpl(barType, threshold))
+{
+}
+
+EventCandleMaker::~EventCandleMaker()
+{
+	delete impl_;
+}
+
+void EventCandleMaker::addTick(const Tick & newTick)
+{
+	impl_->addTick(newTick);
+}
+
+bool EventCandleMaker::popClosedCandle(Candlestick& candle)
+{
+	return impl_->popClosedCandle(candle);
+}
+
+const Candlestick& EventCandleMaker::currentCandle()
+{
+	return impl_->currentCandle();
+}
+
+void EventCandleMaker::setCandleClosedCallback(std::function<void(const Candlestick&)> callback)
+{
+	impl_->setCandleClosedCallback(callback);
+}
+
+std::vector<Candlestick> EventCandleMaker::getClosedCandles()
+{
+	return impl_->getClosedCandles();
+}
+
+Candlestick EventCandleMaker::getCurrentCandle()
+{
+	return impl_->currentCandle();
+}
+
+EventCandleMaker::EventCandleMakerImpl::EventCandleMakerImpl(BarType barType, double threshold) :
+	barType(barType),
+	threshold(threshold),
+	beginAggregation(false),
+	thresholdReached(false),
+	aggregatedCandle(),
+	notional(0)
+{
+	if (!(threshold > 0))
+	{
+		throw std::invalid_argument("EventCandleMaker threshold must be positive.");
+	}
+}
+
+EventCandleMaker::EventCandleMakerImpl::~EventCandleMakerImpl()
+{
+}
+
+void EventCandleMaker::EventCandleMakerImpl::addTick(const Tick & newTick)
+{
+	// unlike time bars there is no period to align to, the first tick starts the first candle
+	if (!beginAggregation)
+	{
+		beginAggregation = true;
+		beginCandle(newTick);
+		return;
+	}
+
+	// a range candle is complete when the new tick would take it above the threshold. the
+	// tick starts the next candle so that no closed candle is ever wider than the threshold
+	if (barType == BarType::RANGE)
+	{
+		double high = (std::max)(aggregatedCandle.high, newTick.price);
+		double low = (std::min)(aggregatedCandle.low, newTick.price);
+		thresholdReached = high - low > threshold;
+	}
+
+	if (thresholdReached)
+	{
+		closedCandles.push(aggregatedCandle);
+		beginCandle(newTick);
+	}
+	else
+	{
+		aggregateCandle(newTick);
+	}
+}
+
+bool EventCandleMaker::EventCandleMakerImpl::popClosedCandle(Candlestick& candle)
+{
+	return closedCandles.pop(candle);
+}
+
+const Candlestick& EventCandleMaker::EventCandleMakerImpl::currentCandle()
+{
+	return aggregatedCandle;
+}
+
+void EventCandleMaker::EventCandleMakerImpl::setCandleClosedCallback(std::function<void(const Candlestick&)> callback)
+{
+	closedCandles.setClosedCallback(callback);
+}
+
+std::vector<Candlestick> EventCandleMaker::EventCandleMakerImpl::getClosedCandles()
+{
+	std::vector<Candlestick> retClosedCandles;
+	retClosedCandles.reserve(closedCandles.size());
+
+	Candlestick candle;
+	while (closedCandles.pop(candle))
+	{
+		retClosedCandles.push_back(candle);
+	}
+	return retClosedCandles;
+}
+
+void EventCandleMaker::EventCandleMakerImpl::beginCandle(const Tick& newTick)
+{
+	aggregatedCandle.open = newTick.price;
+	aggregatedCandle.low = newTick.price;
+	aggregatedCandle.high = newTick.price;
+	aggregatedCandle.close = newTick.price;
+	aggregatedCandle.volume = newTick.size;
+	aggregatedCandle.wap = newTick.price;
+	aggregatedCandle.count = 1;
+	aggregatedCandle.time = newTick.time;
+	notional = newTick.price * newTick.size;
+
+	thresholdReached = isThresholdReached();
+}
+
+void EventCandleMaker::EventCandleMakerImpl::aggregateCandle(const Tick& newTick)
+{
+	aggregatedCandle.close = newTick.price;
+	if (newTick.price < aggregatedCandle.low)
+		aggregatedCandle.low = newTick.price;
+	else if (newTick.price > aggregatedCandle.high)
+		aggregatedCandle.high = newTick.price;
+
+	aggregatedCandle.volume += newTick.size;
+	aggregatedCandle.count++;
+	notional += newTick.price * newTick.size;
+	if (aggregatedCandle.volume > 0)
+		aggregatedCandle.wap = notional / aggregatedCandle.volume;
+
+	thresholdReached = isThresholdReached();
+}
+
+bool EventCandleMaker::EventCandleMakerImpl::isThresholdReached() const
+{
+	switch (barType)
+	{
+	case BarType::VOLUME:
+		return aggregatedCandle.volume >= threshold;
+	case BarType::TICK:
+		return aggregatedCandle.count >= threshold;
+	case BarType::DOLLAR:
+		return notional >= threshold;
+	default:
+		// range candles are checked against the next tick in addTick
+		return false;
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <vector>
+#include "CandleMaker.h"
+
+class CANDLEMAKERDLL EventCandleMaker
+{
+public:
+	enum class BarType
+	{
+		VOLUME,	// closes once threshold shares have traded
+		TICK,	// closes once threshold ticks have been added
+		DOLLAR,	// closes once price times size traded reaches threshold
+		RANGE	// closes when the next tick would take high - low above threshold
+	};
+
+	//
+	// Aggregates the streaming real time price snapshots into candles which close on
+	// market activity instead of on the clock. Every candle starts with the first tick
+	// after the previous candle closed and its time is the time of that tick.
+	//
+	// Same as the time bars of CandleMaker, a candle is pushed to the closed candles when
+	// the first tick of the next candle comes in, so the current candle always contains
+	// the last tick. The tick which reaches the threshold of a volume, tick or dollar candle
+	// belongs to that candle. It is not split between candles.
+	//
+	// Throws std::invalid_argument if threshold is not positive.
+	//
+	EventCandleMaker(BarType barType, double threshold);
+	~EventCandleMaker();
+	EventCandleMaker(const EventCandleMaker& other) = delete;
+	EventCandleMaker& operator=(const EventCandleMaker& other) = delete;
+
+	//
+	// updates the EventCandleMaker by adding a tick
+	//
+	void addTick(const Tick& newTick);
+
+	//
+	// Retrieve candles without allocating. Same rules as CandleMaker.
+	//
+	bool popClosedCandle(Candlestick& candle);
+	const Candlestick& currentCandle();
+	void setCandleClosedCallback(std::function<void(const Candlestick&)> callback);
+
+	//
+	// Retrieve candles. Drains the ring of closed candles into a vector
+	//
+	std::vector<Candlestick> getClosedCandles();
+	Candlestick getCurrentCandle();
+
+private:
+	class EventCandleMakerImpl;
+	EventCandleMakerImpl* impl_;
+};
@@ -0,0 +1,362 @@
+#include <algorithm>
+#include <ctime>
+#include <stdexcept>
+#include "MultiCandleMaker.h"
+#include "CandleRing.h"
+
+class MultiCandleMaker::MultiCandleMakerImpl
+{
+public:
+	MultiCandleMakerImpl(const std::vector<int>& timeFrameSeconds);
+	~MultiCandleMakerImpl();
+
+	//
+	// updates the finest time frame with the tick and rolls up the closed candles
+	//
+	void addTick(const Tick& newTick);
+
+	std::vector<int> getTimeFrames();
+
+	//
+	// Retrieve candles
+	//
+	bool popClosedCandle(int timeFrameSeconds, Candlestick& candle);
+	const Candlestick& currentCandle(int timeFrameSeconds);
+	void setCandleClosedCallback(int timeFrameSeconds, std::function<void(const Candlestick&)> callback);
+	std::vector<Candlestick> getClosedCandles(int timeFrameSeconds);
+
+private:
+	//
+	// State of a single time frame. Follows the same rules as CandleMaker. Recording
+	// starts at the first whole period after the first tick so that every candle
+	// covers its whole period.
+	//
+	struct TimeFrameLevel
+	{
+		int timeFrame;
+
+		//
+		// Index of the finer level whose closed candles are rolled up into this level.
+		// The finest level has no source and is aggregated from the ticks directly
+		//
+		int sourceLevel;
+
+		bool beginAggregation;
+		bool periodIndexInit;
+		time_t periodIndex;
+
+		//
+		// For the finest level, the candle aggregated from the ticks since the beginning of
+		// the period. For coarser levels, the candles of the source level that closed since the
+		// beginning of the period. hasRolledCandle is false until the first one rolls up.
+		//
+		Candlestick aggregatedCandle;
+		bool hasRolledCandle;
+
+		//
+		// price times size traded in the aggregated candle. coarser levels add up the notional
+		// of their source candles so wap stays exact when candles are rolled up
+		//
+		double notional;
+
+		CandleRing closedCandles;
+
+		//
+		// current candle merged with the finer levels. only updated when it is read
+		//
+		Candlestick currentCandle;
+		double currentNotional;
+	};
+
+	// sorted from the finest to the coarsest time frame
+	std::vector<TimeFrameLevel> levels;
+
+private:
+	//
+	// Closes the candle of a level and rolls it up into every level using it as a source
+	//
+	void closeCandle(size_t level);
+
+	//
+	// Aggregates the current candle of the finest level when a new price tick comes in.
+	//
+	void aggregateCandle(TimeFrameLevel& level, const Tick& newTick);
+
+	//
+	// Merges a finer candle into a coarser one which began earlier
+	//
+	static void mergeCandle(Candlestick& candle, double& notional, const Candlestick& finerCandle, double finerNotional);
+
+	size_t findLevel(int timeFrameSeconds);
+};
+
+MultiCandleMaker::MultiCandleMaker(const std::vector<int>& timeFrameSeconds) :
+	impl_(new MultiCandleMakerImpl(timeFrameSeconds))
+{
+}
+
+MultiCandleMaker::~MultiCandleMaker()
+{
+	delete impl_;
+}
+
+void MultiCandleMaker::addTick(const Tick & newTick)
+{
+	impl_->addTick(newTick);
+}
+
+std::vector<int> MultiCandleMaker::getTimeFrames()
+{
+	return impl_->getTimeFrames();
+}
+
+bool MultiCandleMaker::popClosedCandle(int timeFrameSeconds, Candlestick& candle)
+{
+	return impl_->popClosedCandle(timeFrameSeconds, candle);
+}
+
+const Candlestick& MultiCandleMaker::currentCandle(int timeFrameSeconds)
+{
+	return impl_->currentCandle(timeFrameSeconds);
+}
+
+void MultiCandleMaker::setCandleClosedCallback(int timeFrameSeconds, std::function<void(const Candlestick&)> callback)
+{
+	impl_->setCandleClosedCallback(timeFrameSeconds, callback);
+}
+
+std::vector<Candlestick> MultiCandleMaker::getClosedCandles(int timeFrameSeconds)
+{
+	return impl_->getClosedCandles(timeFrameSeconds);
+}
+
+Candlestick MultiCandleMaker::getCurrentCandle(int timeFrameSeconds)
+{
+	return impl_->currentCandle(timeFrameSeconds);
+}
+
+MultiCandleMaker::MultiCandleMakerImpl::MultiCandleMakerImpl(const std::vector<int>& timeFrameSeconds)
+{
+	auto timeFrames = timeFrameSeconds;
+	std::sort(timeFrames.begin(), timeFrames.end());
+	timeFrames.erase(std::unique(timeFrames.begin(), timeFrames.end()), timeFrames.end());
+
+	if (timeFrames.empty() || timeFrames.front() <= 0)
+	{
+		throw std::invalid_argument("MultiCandleMaker needs at least one positive time frame.");
+	}
+
+	for (size_t i = 0; i < timeFrames.size(); i++)
+	{
+		TimeFrameLevel level = {};
+		level.timeFrame = timeFrames[i];
+		level.sourceLevel = -1;
+
+		// roll up from the coarsest finer time frame which divides this one. this keeps
+		// the number of candles rolled up into each period as small as possible
+		for (size_t source = i; source-- > 0;)
+		{
+			if (timeFrames[i] % timeFrames[source] == 0)
+			{
+				level.sourceLevel = static_cast<int>(source);
+				break;
+			}
+		}
+
+		if (i > 0 && level.sourceLevel < 0)
+		{
+			throw std::invalid_argument("MultiCandleMaker time frames must be multiples of the finest time frame.");
+		}
+
+		levels.push_back(level);
+	}
+}
+
+MultiCandleMaker::MultiCandleMakerImpl::~MultiCandleMakerImpl()
+{
+}
+
+void MultiCandleMaker::MultiCandleMakerImpl::addTick(const Tick & newTick)
+{
+	// levels are visited from the finest to the coarsest. a level closing rolls its candle
+	// up into the coarser levels before they check their own period, so a coarse candle
+	// always receives the last finer candle of its period before it closes
+	for (size_t i = 0; i < levels.size(); i++)
+	{
+		auto& level = levels[i];
+		time_t thisPeriodIndex = newTick.time / level.timeFrame;
+
+		// same alignment as CandleMaker. wait for the start of the next period
+		if (!level.periodIndexInit)
+		{
+			level.periodIndexInit = true;
+			level.periodIndex = thisPeriodIndex;
+			continue;
+		}
+
+		if (thisPeriodIndex > level.periodIndex)
+		{
+			if (level.beginAggregation)
+			{
+				closeCandle(i);
+			}
+
+			// create a new candle. the finest level starts from the tick. coarser levels start
+			// empty and receive the finer candles as they close
+			level.aggregatedCandle.open = newTick.price;
+			level.aggregatedCandle.low = newTick.price;
+			level.aggregatedCandle.high = newTick.price;
+			level.aggregatedCandle.close = newTick.price;
+			level.aggregatedCandle.volume = newTick.size;
+			level.aggregatedCandle.wap = newTick.price;
+			level.aggregatedCandle.count = 1;
+			level.notional = newTick.price * newTick.size;
+			level.aggregatedCandle.time = newTick.time - (newTick.time % level.timeFrame); // candle time should align with the nearest timeframe
+			level.hasRolledCandle = false;
+
+			level.beginAggregation = true;
+			level.periodIndex = thisPeriodIndex;
+		}
+		else if (level.sourceLevel < 0 && level.beginAggregation)
+		{
+			aggregateCandle(level, newTick);
+		}
+	}
+}
+
+std::vector<int> MultiCandleMaker::MultiCandleMakerImpl::getTimeFrames()
+{
+	std::vector<int> timeFrames;
+	for (const auto& level : levels)
+	{
+		timeFrames.push_back(level.timeFrame);
+	}
+	return timeFrames;
+}
+
+bool MultiCandleMaker::MultiCandleMakerImpl::popClosedCandle(int timeFrameSeconds, Candlestick& candle)
+{
+	return levels[findLevel(timeFrameSeconds)].closedCandles.pop(candle);
+}
+
+void MultiCandleMaker::MultiCandleMakerImpl::setCandleClosedCallback(int timeFrameSeconds, std::function<void(const Candlestick&)> callback)
+{
+	levels[findLevel(timeFrameSeconds)].closedCandles.setClosedCallback(callback);
+}
+
+std::vector<Candlestick> MultiCandleMaker::MultiCandleMakerImpl::getClosedCandles(int timeFrameSeconds)
+{
+	auto& closedCandles = levels[findLevel(timeFrameSeconds)].closedCandles;
+	std::vector<Candlestick> retClosedCandles;
+	retClosedCandles.reserve(closedCandles.size());
+
+	Candlestick candle;
+	while (closedCandles.pop(candle))
+	{
+		retClosedCandles.push_back(candle);
+	}
+	return retClosedCandles;
+}
+
+const Candlestick& MultiCandleMaker::MultiCandleMakerImpl::currentCandle(int timeFrameSeconds)
+{
+	auto& level = levels[findLevel(timeFrameSeconds)];
+	if (level.sourceLevel < 0)
+	{
+		level.currentNotional = level.notional;
+		return level.aggregatedCandle;
+	}
+
+	// merge the current candle of the source level, which is itself merged with its own
+	// source. every current candle of a finer level began inside the current period of
+	// the coarser levels
+	const auto& finerCandle = currentCandle(levels[level.sourceLevel].timeFrame);
+	const auto finerNotional = levels[level.sourceLevel].currentNotional;
+	if (level.hasRolledCandle)
+	{
+		level.currentCandle = level.aggregatedCandle;
+		level.currentNotional = level.notional;
+		mergeCandle(level.currentCandle, level.currentNotional, finerCandle, finerNotional);
+	}
+	else
+	{
+		level.currentCandle = finerCandle;
+		level.currentCandle.time = level.aggregatedCandle.time;
+		level.currentNotional = finerNotional;
+	}
+	return level.currentCandle;
+}
+
+void MultiCandleMaker::MultiCandleMakerImpl::closeCandle(size_t closingLevel)
+{
+	const auto& level = levels[closingLevel];
+
+	// a coarse level only has a candle if something rolled up into it during the period
+	if (level.sourceLevel >= 0 && !level.hasRolledCandle)
+	{
+		return;
+	}
+
+	levels[closingLevel].closedCandles.push(level.aggregatedCandle);
+
+	for (size_t i = closingLevel + 1; i < levels.size(); i++)
+	{
+		auto& coarserLevel = levels[i];
+		if (coarserLevel.sourceLevel != static_cast<int>(closingLevel) || !coarserLevel.beginAggregation)
+		{
+			continue;
+		}
+
+		if (coarserLevel.hasRolledCandle)
+		{
+			mergeCandle(coarserLevel.aggregatedCandle, coarserLevel.notional, level.aggregatedCandle, level.notional);
+		}
+		else
+		{
+			auto coarserTime = coarserLevel.aggregatedCandle.time;
+			coarserLevel.aggregatedCandle = level.aggregatedCandle;
+			coarserLevel.aggregatedCandle.time = coarserTime;
+			coarserLevel.notional = level.notional;
+			coarserLevel.hasRolledCandle = true;
+		}
+	}
+}
+
+void MultiCandleMaker::MultiCandleMakerImpl::aggregateCandle(TimeFrameLevel& level, const Tick& newTick)
+{
+	level.aggregatedCandle.close = newTick.price;
+	if (newTick.price < level.aggregatedCandle.low)
+		level.aggregatedCandle.low = newTick.price;
+	else if (newTick.price > level.aggregatedCandle.high)
+		level.aggregatedCandle.high = newTick.price;
+
+	level.aggregatedCandle.volume += newTick.size;
+	level.aggregatedCandle.count++;
+	level.notional += newTick.price * newTick.size;
+	if (level.aggregatedCandle.volume > 0)
+		level.aggregatedCandle.wap = level.notional / level.aggregatedCandle.volume;
+}
+
+void MultiCandleMaker::MultiCandleMakerImpl::mergeCandle(Candlestick& candle, double& notional, const Candlestick& finerCandle, double finerNotional)
+{
+	candle.close = finerCandle.close;
+	candle.high = (std::max)(candle.high, finerCandle.high);
+	candle.low = (std::min)(candle.low, finerCandle.low);
+	candle.volume += finerCandle.volume;
+	candle.count += finerCandle.count;
+	notional += finerNotional;
+	if (candle.volume > 0)
+		candle.wap = notional / candle.volume;
+}
+
+size_t MultiCandleMaker::MultiCandleMakerImpl::findLevel(int timeFrameSeconds)
+{
+	for (size_t i = 0; i < levels.size(); i++)
+	{
+		if (levels[i].timeFrame == timeFrameSeconds)
+		{
+			return i;
+		}
+	}
+	throw std::invalid_argument("Time frame was not requested from this MultiCandleMaker.");
+}
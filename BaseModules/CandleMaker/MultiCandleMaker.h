@@ -0,0 +1,52 @@
+#pragma once
+#include <vector>
+#include "CandleMaker.h"
+
+class CANDLEMAKERDLL MultiCandleMaker
+{
+public:
+	//
+	// Aggregates the streaming real time price snapshots into candles of every requested
+	// time frame at once. Only the finest time frame is updated by each tick. Coarser time
+	// frames are rolled up from the closed candles of a finer time frame when those close,
+	// so adding a tick costs the same as a single CandleMaker no matter how many time
+	// frames are requested.
+	//
+	// The finest time frame must divide every other time frame. eg. 1, 60, 300 and 900 seconds.
+	// Throws std::invalid_argument otherwise.
+	//
+	MultiCandleMaker(const std::vector<int>& timeFrameSeconds);
+	~MultiCandleMaker();
+	MultiCandleMaker(const MultiCandleMaker& other) = delete;
+	MultiCandleMaker& operator=(const MultiCandleMaker& other) = delete;
+
+	//
+	// updates every time frame by adding a tick
+	//
+	void addTick(const Tick& newTick);
+
+	//
+	// Time frames in ascending order
+	//
+	std::vector<int> getTimeFrames();
+
+	//
+	// Retrieve candles of one of the requested time frames without allocating. Same rules
+	// as CandleMaker. Each time frame has its own ring of closed candles. The current candle
+	// of a coarse time frame is merged with the current candles of the finer time frames
+	// when it is read.
+	//
+	bool popClosedCandle(int timeFrameSeconds, Candlestick& candle);
+	const Candlestick& currentCandle(int timeFrameSeconds);
+	void setCandleClosedCallback(int timeFrameSeconds, std::function<void(const Candlestick&)> callback);
+
+	//
+	// Retrieve candles. Drains the ring of closed candles into a vector
+	//
+	std::vector<Candlestick> getClosedCandles(int timeFrameSeconds);
+	Candlestick getCurrentCandle(int timeFrameSeconds);
+
+private:
+	class MultiCandleMakerImpl;
+	MultiCandleMakerImpl* impl_;
+};
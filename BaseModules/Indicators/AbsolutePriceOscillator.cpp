@@ -0,0 +1,60 @@
+#include "AbsolutePriceOscillator.h"
+#include "IndicatorKernels.h"
+
+class AbsolutePriceOscillator::AbsolutePriceOscillatorImpl
+{
+public:
+	AbsolutePriceOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod);
+	~AbsolutePriceOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	Ema short_;
+	Ema long_;
+};
+
+AbsolutePriceOscillator::AbsolutePriceOscillator(unsigned int shortPeriod, unsigned int longPeriod) :
+	impl_(new AbsolutePriceOscillatorImpl(shortPeriod, longPeriod))
+{
+}
+
+AbsolutePriceOscillator::~AbsolutePriceOscillator()
+{
+	delete impl_;
+}
+
+AbsolutePriceOscillator::array_type AbsolutePriceOscillator::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+AbsolutePriceOscillator::array_type AbsolutePriceOscillator::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AbsolutePriceOscillator::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AbsolutePriceOscillator::AbsolutePriceOscillatorImpl::AbsolutePriceOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod) :
+	short_(emaAlpha(shortPeriod)),
+	long_(emaAlpha(longPeriod))
+{
+}
+
+AbsolutePriceOscillator::AbsolutePriceOscillatorImpl::~AbsolutePriceOscillatorImpl()
+{
+}
+
+AbsolutePriceOscillator::array_type AbsolutePriceOscillator::AbsolutePriceOscillatorImpl::update(const double sample, bool newBar)
+{
+	return array_type{ short_.update(sample, newBar) - long_.update(sample, newBar) };
+}
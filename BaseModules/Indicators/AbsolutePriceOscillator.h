@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Short ema minus long ema
+//
+class INDICATORSDLL AbsolutePriceOscillator
+{
+public:
+	AbsolutePriceOscillator(unsigned int shortPeriod, unsigned int longPeriod);
+	~AbsolutePriceOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ABSOLUTE_PRICE_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class AbsolutePriceOscillatorImpl;
+	AbsolutePriceOscillatorImpl* impl_;
+};
@@ -0,0 +1,63 @@
+#include "AccumulationDistributionLine.h"
+#include "IndicatorKernels.h"
+
+class AccumulationDistributionLine::AccumulationDistributionLineImpl
+{
+public:
+	AccumulationDistributionLineImpl();
+	~AccumulationDistributionLineImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> total_;
+};
+
+AccumulationDistributionLine::AccumulationDistributionLine() :
+	impl_(new AccumulationDistributionLineImpl())
+{
+}
+
+AccumulationDistributionLine::~AccumulationDistributionLine()
+{
+	delete impl_;
+}
+
+AccumulationDistributionLine::array_type AccumulationDistributionLine::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AccumulationDistributionLine::array_type AccumulationDistributionLine::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AccumulationDistributionLine::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AccumulationDistributionLine::AccumulationDistributionLineImpl::AccumulationDistributionLineImpl()
+{
+}
+
+AccumulationDistributionLine::AccumulationDistributionLineImpl::~AccumulationDistributionLineImpl()
+{
+}
+
+AccumulationDistributionLine::array_type AccumulationDistributionLine::AccumulationDistributionLineImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto range = sample.high - sample.low;
+	auto& total = total_.begin(newBar);
+	if (range > 0)
+	{
+		total += ((sample.close - sample.low) - (sample.high - sample.close)) / range * sample.volume;
+	}
+	return array_type{ total };
+}
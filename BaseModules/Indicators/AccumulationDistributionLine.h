@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Running total of the volume weighted by the position of the close within the range
+//
+class INDICATORSDLL AccumulationDistributionLine
+{
+public:
+	AccumulationDistributionLine();
+	~AccumulationDistributionLine();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ACCUMULATION_DISTRIBUTION,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AccumulationDistributionLineImpl;
+	AccumulationDistributionLineImpl* impl_;
+};
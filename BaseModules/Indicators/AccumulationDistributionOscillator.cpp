@@ -0,0 +1,67 @@
+#include "AccumulationDistributionOscillator.h"
+#include "IndicatorKernels.h"
+
+class AccumulationDistributionOscillator::AccumulationDistributionOscillatorImpl
+{
+public:
+	AccumulationDistributionOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod);
+	~AccumulationDistributionOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> total_;
+	Ema short_;
+	Ema long_;
+};
+
+AccumulationDistributionOscillator::AccumulationDistributionOscillator(unsigned int shortPeriod, unsigned int longPeriod) :
+	impl_(new AccumulationDistributionOscillatorImpl(shortPeriod, longPeriod))
+{
+}
+
+AccumulationDistributionOscillator::~AccumulationDistributionOscillator()
+{
+	delete impl_;
+}
+
+AccumulationDistributionOscillator::array_type AccumulationDistributionOscillator::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AccumulationDistributionOscillator::array_type AccumulationDistributionOscillator::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AccumulationDistributionOscillator::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AccumulationDistributionOscillator::AccumulationDistributionOscillatorImpl::AccumulationDistributionOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod) :
+	short_(emaAlpha(shortPeriod)),
+	long_(emaAlpha(longPeriod))
+{
+}
+
+AccumulationDistributionOscillator::AccumulationDistributionOscillatorImpl::~AccumulationDistributionOscillatorImpl()
+{
+}
+
+AccumulationDistributionOscillator::array_type AccumulationDistributionOscillator::AccumulationDistributionOscillatorImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto range = sample.high - sample.low;
+	auto& total = total_.begin(newBar);
+	if (range > 0)
+	{
+		total += ((sample.close - sample.low) - (sample.high - sample.close)) / range * sample.volume;
+	}
+	return array_type{ short_.update(total, newBar) - long_.update(total, newBar) };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Short ema minus long ema of the accumulation/distribution line
+//
+class INDICATORSDLL AccumulationDistributionOscillator
+{
+public:
+	AccumulationDistributionOscillator(unsigned int shortPeriod, unsigned int longPeriod);
+	~AccumulationDistributionOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ACCUMULATION_DISTRIBUTION_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AccumulationDistributionOscillatorImpl;
+	AccumulationDistributionOscillatorImpl* impl_;
+};
@@ -0,0 +1,63 @@
+#include "AnnualizedHistoricalVolatility.h"
+#include "IndicatorKernels.h"
+
+class AnnualizedHistoricalVolatility::AnnualizedHistoricalVolatilityImpl
+{
+public:
+	AnnualizedHistoricalVolatilityImpl(unsigned int period);
+	~AnnualizedHistoricalVolatilityImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMoments returns_;
+	BarState<double> previous_;
+};
+
+AnnualizedHistoricalVolatility::AnnualizedHistoricalVolatility(unsigned int period) :
+	impl_(new AnnualizedHistoricalVolatilityImpl(period))
+{
+}
+
+AnnualizedHistoricalVolatility::~AnnualizedHistoricalVolatility()
+{
+	delete impl_;
+}
+
+AnnualizedHistoricalVolatility::array_type AnnualizedHistoricalVolatility::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+AnnualizedHistoricalVolatility::array_type AnnualizedHistoricalVolatility::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AnnualizedHistoricalVolatility::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AnnualizedHistoricalVolatility::AnnualizedHistoricalVolatilityImpl::AnnualizedHistoricalVolatilityImpl(unsigned int period) :
+	returns_(period)
+{
+}
+
+AnnualizedHistoricalVolatility::AnnualizedHistoricalVolatilityImpl::~AnnualizedHistoricalVolatilityImpl()
+{
+}
+
+AnnualizedHistoricalVolatility::array_type AnnualizedHistoricalVolatility::AnnualizedHistoricalVolatilityImpl::update(const double sample, bool newBar)
+{
+	auto& previous = previous_.begin(newBar);
+	returns_.update(previous_.bars() > 1 && previous != 0 ? sample / previous - 1 : 0, newBar);
+	previous = sample;
+
+	return array_type{ returns_.standardDeviation() * std::sqrt(252.0) };
+}
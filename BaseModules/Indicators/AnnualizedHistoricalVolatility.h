@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Standard deviation of the returns of the last period samples, annualized over 252 trading days
+//
+class INDICATORSDLL AnnualizedHistoricalVolatility
+{
+public:
+	AnnualizedHistoricalVolatility(unsigned int period);
+	~AnnualizedHistoricalVolatility();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VOLATILITY,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class AnnualizedHistoricalVolatilityImpl;
+	AnnualizedHistoricalVolatilityImpl* impl_;
+};
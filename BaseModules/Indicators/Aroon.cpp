@@ -0,0 +1,81 @@
+#include "Aroon.h"
+#include "RollingExtremum.h"
+
+class Aroon::AroonImpl
+{
+public:
+	AroonImpl(unsigned int period);
+	~AroonImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	const unsigned int period_;
+
+	// the window holds period_ + 1 candles so that the age of the extremum goes from 0 to period_
+	RollingMaximum highest_;
+	RollingMinimum lowest_;
+
+private:
+	array_type aroon() const;
+};
+
+Aroon::Aroon(unsigned int period) :
+	impl_(new AroonImpl(period))
+{
+}
+
+Aroon::~Aroon()
+{
+	delete impl_;
+}
+
+Aroon::array_type Aroon::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+Aroon::array_type Aroon::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Aroon::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Aroon::AroonImpl::AroonImpl(unsigned int period) :
+	period_(period),
+	highest_(period + 1),
+	lowest_(period + 1)
+{
+	if (period == 0)
+	{
+		throw std::invalid_argument("Indicator period must be positive.");
+	}
+}
+
+Aroon::AroonImpl::~AroonImpl()
+{
+}
+
+Aroon::array_type Aroon::AroonImpl::update(const SamplePoint& sample, bool newBar)
+{
+	highest_.update(sample.high, newBar);
+	lowest_.update(sample.low, newBar);
+	return aroon();
+}
+
+Aroon::array_type Aroon::AroonImpl::aroon() const
+{
+	array_type result;
+	result[UP] = 100.0 * (period_ - highest_.age()) / period_;
+	result[DOWN] = 100.0 * (period_ - lowest_.age()) / period_;
+	return result;
+}
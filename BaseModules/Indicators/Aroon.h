@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Time since the highest high and the lowest low of the last period + 1 candles, from 0 to 100
+//
+class INDICATORSDLL Aroon
+{
+public:
+	Aroon(unsigned int period);
+	~Aroon();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		UP,
+		DOWN,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AroonImpl;
+	AroonImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "AroonOscillator.h"
+#include "Aroon.h"
+
+class AroonOscillator::AroonOscillatorImpl
+{
+public:
+	AroonOscillatorImpl(unsigned int period);
+	~AroonOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	Aroon aroon_;
+};
+
+AroonOscillator::AroonOscillator(unsigned int period) :
+	impl_(new AroonOscillatorImpl(period))
+{
+}
+
+AroonOscillator::~AroonOscillator()
+{
+	delete impl_;
+}
+
+AroonOscillator::array_type AroonOscillator::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AroonOscillator::array_type AroonOscillator::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AroonOscillator::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AroonOscillator::AroonOscillatorImpl::AroonOscillatorImpl(unsigned int period) :
+	aroon_(period)
+{
+}
+
+AroonOscillator::AroonOscillatorImpl::~AroonOscillatorImpl()
+{
+}
+
+AroonOscillator::array_type AroonOscillator::AroonOscillatorImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto aroon = updateIndicator(aroon_, sample, newBar);
+	return array_type{ aroon[Aroon::UP] - aroon[Aroon::DOWN] };
+}
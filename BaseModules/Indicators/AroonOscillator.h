@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Aroon up minus Aroon down, from -100 to 100
+//
+class INDICATORSDLL AroonOscillator
+{
+public:
+	AroonOscillator(unsigned int period);
+	~AroonOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		AROON_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AroonOscillatorImpl;
+	AroonOscillatorImpl* impl_;
+};
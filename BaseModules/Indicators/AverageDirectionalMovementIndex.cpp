@@ -0,0 +1,61 @@
+#include "AverageDirectionalMovementIndex.h"
+#include "IndicatorKernels.h"
+
+class AverageDirectionalMovementIndex::AverageDirectionalMovementIndexImpl
+{
+public:
+	AverageDirectionalMovementIndexImpl(unsigned int period);
+	~AverageDirectionalMovementIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	DirectionalSystem system_;
+	WilderAverage average_;
+};
+
+AverageDirectionalMovementIndex::AverageDirectionalMovementIndex(unsigned int period) :
+	impl_(new AverageDirectionalMovementIndexImpl(period))
+{
+}
+
+AverageDirectionalMovementIndex::~AverageDirectionalMovementIndex()
+{
+	delete impl_;
+}
+
+AverageDirectionalMovementIndex::array_type AverageDirectionalMovementIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AverageDirectionalMovementIndex::array_type AverageDirectionalMovementIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AverageDirectionalMovementIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AverageDirectionalMovementIndex::AverageDirectionalMovementIndexImpl::AverageDirectionalMovementIndexImpl(unsigned int period) :
+	system_(period),
+	average_(period)
+{
+}
+
+AverageDirectionalMovementIndex::AverageDirectionalMovementIndexImpl::~AverageDirectionalMovementIndexImpl()
+{
+}
+
+AverageDirectionalMovementIndex::array_type AverageDirectionalMovementIndex::AverageDirectionalMovementIndexImpl::update(const SamplePoint& sample, bool newBar)
+{
+	system_.update(sample, newBar);
+	return array_type{ average_.update(system_.movementIndex(), newBar) };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Directional movement index averaged with Wilder's smoothing
+//
+class INDICATORSDLL AverageDirectionalMovementIndex
+{
+public:
+	AverageDirectionalMovementIndex(unsigned int period);
+	~AverageDirectionalMovementIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ADX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AverageDirectionalMovementIndexImpl;
+	AverageDirectionalMovementIndexImpl* impl_;
+};
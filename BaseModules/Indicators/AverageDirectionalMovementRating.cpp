@@ -0,0 +1,65 @@
+#include "AverageDirectionalMovementRating.h"
+#include "IndicatorKernels.h"
+
+class AverageDirectionalMovementRating::AverageDirectionalMovementRatingImpl
+{
+public:
+	AverageDirectionalMovementRatingImpl(unsigned int period);
+	~AverageDirectionalMovementRatingImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	DirectionalSystem system_;
+	WilderAverage average_;
+	RollingWindow history_;
+};
+
+AverageDirectionalMovementRating::AverageDirectionalMovementRating(unsigned int period) :
+	impl_(new AverageDirectionalMovementRatingImpl(period))
+{
+}
+
+AverageDirectionalMovementRating::~AverageDirectionalMovementRating()
+{
+	delete impl_;
+}
+
+AverageDirectionalMovementRating::array_type AverageDirectionalMovementRating::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AverageDirectionalMovementRating::array_type AverageDirectionalMovementRating::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AverageDirectionalMovementRating::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AverageDirectionalMovementRating::AverageDirectionalMovementRatingImpl::AverageDirectionalMovementRatingImpl(unsigned int period) :
+	system_(period),
+	average_(period),
+	history_(period)
+{
+}
+
+AverageDirectionalMovementRating::AverageDirectionalMovementRatingImpl::~AverageDirectionalMovementRatingImpl()
+{
+}
+
+AverageDirectionalMovementRating::array_type AverageDirectionalMovementRating::AverageDirectionalMovementRatingImpl::update(const SamplePoint& sample, bool newBar)
+{
+	system_.update(sample, newBar);
+	auto adx = average_.update(system_.movementIndex(), newBar);
+	history_.update(adx, newBar);
+	return array_type{ (adx + history_.oldest()) / 2 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Average of the average directional movement index and its value period - 1 bars ago
+//
+class INDICATORSDLL AverageDirectionalMovementRating
+{
+public:
+	AverageDirectionalMovementRating(unsigned int period);
+	~AverageDirectionalMovementRating();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ADXR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AverageDirectionalMovementRatingImpl;
+	AverageDirectionalMovementRatingImpl* impl_;
+};
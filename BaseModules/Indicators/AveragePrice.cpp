@@ -0,0 +1,55 @@
+#include "AveragePrice.h"
+
+class AveragePrice::AveragePriceImpl
+{
+public:
+	AveragePriceImpl();
+	~AveragePriceImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+};
+
+AveragePrice::AveragePrice() :
+	impl_(new AveragePriceImpl())
+{
+}
+
+AveragePrice::~AveragePrice()
+{
+	delete impl_;
+}
+
+AveragePrice::array_type AveragePrice::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AveragePrice::array_type AveragePrice::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AveragePrice::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AveragePrice::AveragePriceImpl::AveragePriceImpl()
+{
+}
+
+AveragePrice::AveragePriceImpl::~AveragePriceImpl()
+{
+}
+
+AveragePrice::array_type AveragePrice::AveragePriceImpl::update(const SamplePoint& sample, bool)
+{
+	return array_type{ (sample.open + sample.high + sample.low + sample.close) / 4 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Average of the open, high, low and close
+//
+class INDICATORSDLL AveragePrice
+{
+public:
+	AveragePrice();
+	~AveragePrice();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		AVERAGE_PRICE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AveragePriceImpl;
+	AveragePriceImpl* impl_;
+};
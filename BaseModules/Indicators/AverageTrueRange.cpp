@@ -0,0 +1,62 @@
+#include "AverageTrueRange.h"
+#include "IndicatorKernels.h"
+
+class AverageTrueRange::AverageTrueRangeImpl
+{
+public:
+	AverageTrueRangeImpl(unsigned int period);
+	~AverageTrueRangeImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> close_;
+	WilderAverage average_;
+};
+
+AverageTrueRange::AverageTrueRange(unsigned int period) :
+	impl_(new AverageTrueRangeImpl(period))
+{
+}
+
+AverageTrueRange::~AverageTrueRange()
+{
+	delete impl_;
+}
+
+AverageTrueRange::array_type AverageTrueRange::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AverageTrueRange::array_type AverageTrueRange::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AverageTrueRange::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AverageTrueRange::AverageTrueRangeImpl::AverageTrueRangeImpl(unsigned int period) :
+	average_(period)
+{
+}
+
+AverageTrueRange::AverageTrueRangeImpl::~AverageTrueRangeImpl()
+{
+}
+
+AverageTrueRange::array_type AverageTrueRange::AverageTrueRangeImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& close = close_.begin(newBar);
+	auto range = trueRange(sample, close_.bars() > 1, close);
+	close = sample.close;
+	return array_type{ average_.update(range, newBar) };
+}
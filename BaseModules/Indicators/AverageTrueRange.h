@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// True range averaged with Wilder's smoothing
+//
+class INDICATORSDLL AverageTrueRange
+{
+public:
+	AverageTrueRange(unsigned int period);
+	~AverageTrueRange();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		AVERAGE_TRUE_RANGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AverageTrueRangeImpl;
+	AverageTrueRangeImpl* impl_;
+};
@@ -0,0 +1,63 @@
+#include "AwesomeOscillator.h"
+#include "IndicatorKernels.h"
+
+class AwesomeOscillator::AwesomeOscillatorImpl
+{
+public:
+	AwesomeOscillatorImpl();
+	~AwesomeOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	RollingWindow short_;
+	RollingWindow long_;
+};
+
+AwesomeOscillator::AwesomeOscillator() :
+	impl_(new AwesomeOscillatorImpl())
+{
+}
+
+AwesomeOscillator::~AwesomeOscillator()
+{
+	delete impl_;
+}
+
+AwesomeOscillator::array_type AwesomeOscillator::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+AwesomeOscillator::array_type AwesomeOscillator::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void AwesomeOscillator::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+AwesomeOscillator::AwesomeOscillatorImpl::AwesomeOscillatorImpl() :
+	short_(5),
+	long_(34)
+{
+}
+
+AwesomeOscillator::AwesomeOscillatorImpl::~AwesomeOscillatorImpl()
+{
+}
+
+AwesomeOscillator::array_type AwesomeOscillator::AwesomeOscillatorImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto median = (sample.high + sample.low) / 2;
+	short_.update(median, newBar);
+	long_.update(median, newBar);
+	return array_type{ short_.mean() - long_.mean() };
+}
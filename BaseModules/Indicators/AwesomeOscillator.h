@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Simple moving average of the median price over 5 candles minus the one over 34 candles
+//
+class INDICATORSDLL AwesomeOscillator
+{
+public:
+	AwesomeOscillator();
+	~AwesomeOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		AWESOME_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class AwesomeOscillatorImpl;
+	AwesomeOscillatorImpl* impl_;
+};
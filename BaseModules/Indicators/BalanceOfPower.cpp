@@ -0,0 +1,55 @@
+#include "BalanceOfPower.h"
+
+class BalanceOfPower::BalanceOfPowerImpl
+{
+public:
+	BalanceOfPowerImpl();
+	~BalanceOfPowerImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+};
+
+BalanceOfPower::BalanceOfPower() :
+	impl_(new BalanceOfPowerImpl())
+{
+}
+
+BalanceOfPower::~BalanceOfPower()
+{
+	delete impl_;
+}
+
+BalanceOfPower::array_type BalanceOfPower::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+BalanceOfPower::array_type BalanceOfPower::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void BalanceOfPower::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+BalanceOfPower::BalanceOfPowerImpl::BalanceOfPowerImpl()
+{
+}
+
+BalanceOfPower::BalanceOfPowerImpl::~BalanceOfPowerImpl()
+{
+}
+
+BalanceOfPower::array_type BalanceOfPower::BalanceOfPowerImpl::update(const SamplePoint& sample, bool)
+{
+	return array_type{ sample.high > sample.low ? (sample.close - sample.open) / (sample.high - sample.low) : 0 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Close minus open relative to the range of the candle
+//
+class INDICATORSDLL BalanceOfPower
+{
+public:
+	BalanceOfPower();
+	~BalanceOfPower();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		BALANCE_OF_POWER,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class BalanceOfPowerImpl;
+	BalanceOfPowerImpl* impl_;
+};
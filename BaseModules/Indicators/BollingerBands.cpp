@@ -1,5 +1,5 @@
 #include "BollingerBands.h"
-#include <list>
+#include "IndicatorKernels.h"
 
 
 class BollingerBands::BollingerBandsImpl
@@ -8,13 +8,17 @@ public:
 	BollingerBandsImpl(unsigned int period, double scale);
 	~BollingerBandsImpl();
 
-	array_type computeIndicatorPoint(const double sample);
-	array_type recomputeIndicatorPoint(const double sample);
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
 private:
-	const unsigned int period_;
 	const double scale_;
-	std::list<double> window_;
-	double sum_;
+
+	// running mean and sum of squared differences from the mean of the last period samples. they
+	// are updated with Welford's method when a sample is added or replaced, so the bands are
+	// computed in O(1) no matter the period
+	RollingMoments moments_;
 };
 
 
@@ -30,82 +34,42 @@ BollingerBands::~BollingerBands()
 
 BollingerBands::array_type BollingerBands::computeIndicatorPoint(const double sample)
 {
-	return impl_->computeIndicatorPoint(sample);
+	return impl_->update(sample, true);
 }
 
 BollingerBands::array_type BollingerBands::recomputeIndicatorPoint(const double sample)
 {
-	return impl_->recomputeIndicatorPoint(sample);
+	return impl_->update(sample, false);
 }
 
-BollingerBands::BollingerBandsImpl::BollingerBandsImpl(unsigned int period, double scale) :
-	period_(period),
-	scale_(scale)
+void BollingerBands::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
 {
-	sum_ = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
 }
 
-BollingerBands::BollingerBandsImpl::~BollingerBandsImpl()
+BollingerBands::BollingerBandsImpl::BollingerBandsImpl(unsigned int period, double scale) :
+	scale_(scale),
+	moments_(period)
 {
 }
 
-BollingerBands::array_type BollingerBands::BollingerBandsImpl::computeIndicatorPoint(const double sample)
+BollingerBands::BollingerBandsImpl::~BollingerBandsImpl()
 {
-	array_type result;
-
-	window_.push_front(sample);
-	sum_ += sample;
-
-	// adjust sum and window_ size fixed
-	if (window_.size() > period_)
-	{
-		sum_ -= window_.back();
-		window_.pop_back();
-	}
-
-	auto avg = sum_ / window_.size();
-
-	result[MIDDLE] = avg;
-
-	double offset = 0;
-	// calculating stdDev
-	for (const auto& val : window_)
-	{
-		offset += pow(val - avg, 2);
-	}
-	offset /= window_.size();
-	offset = scale_ * std::sqrt(offset);
-
-	result[LOWER] = avg - offset;
-	result[UPPER] = avg + offset;
-
-	return result;
 }
 
-BollingerBands::array_type BollingerBands::BollingerBandsImpl::recomputeIndicatorPoint(const double sample)
+BollingerBands::array_type BollingerBands::BollingerBandsImpl::update(const double sample, bool newBar)
 {
-	array_type result;
+	moments_.update(sample, newBar);
 
-	//replace the front value and recompute
-	sum_ -= window_.front();
-	window_.front() = sample;
-	sum_ += sample;
-
-	auto avg = sum_ / window_.size();
-
-	result[MIDDLE] = avg;
-
-	double offset = 0;
-	// calculating stdDev
-	for (const auto& val : window_)
-	{
-		offset += pow(val - avg, 2);
-	}
-	offset /= window_.size();
-	offset = scale_ * std::sqrt(offset);
+	array_type result;
+	result[MIDDLE] = moments_.mean();
 
-	result[LOWER] = avg - offset;
-	result[UPPER] = avg + offset;
+	auto offset = scale_ * moments_.standardDeviation();
+	result[LOWER] = moments_.mean() - offset;
+	result[UPPER] = moments_.mean() + offset;
 
 	return result;
-}
\ No newline at end of file
+}
@@ -21,6 +21,7 @@ public:
 
 	array_type computeIndicatorPoint(const double sample);
 	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
 
 private:
 	class BollingerBandsImpl;
@@ -0,0 +1,63 @@
+#include "ChaikinsVolatility.h"
+#include "IndicatorKernels.h"
+
+class ChaikinsVolatility::ChaikinsVolatilityImpl
+{
+public:
+	ChaikinsVolatilityImpl(unsigned int period);
+	~ChaikinsVolatilityImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	Ema ema_;
+	RollingWindow history_;
+};
+
+ChaikinsVolatility::ChaikinsVolatility(unsigned int period) :
+	impl_(new ChaikinsVolatilityImpl(period))
+{
+}
+
+ChaikinsVolatility::~ChaikinsVolatility()
+{
+	delete impl_;
+}
+
+ChaikinsVolatility::array_type ChaikinsVolatility::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+ChaikinsVolatility::array_type ChaikinsVolatility::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void ChaikinsVolatility::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+ChaikinsVolatility::ChaikinsVolatilityImpl::ChaikinsVolatilityImpl(unsigned int period) :
+	ema_(emaAlpha(period)),
+	history_(checkPeriod(period) + 1)
+{
+}
+
+ChaikinsVolatility::ChaikinsVolatilityImpl::~ChaikinsVolatilityImpl()
+{
+}
+
+ChaikinsVolatility::array_type ChaikinsVolatility::ChaikinsVolatilityImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto ema = ema_.update(sample.high - sample.low, newBar);
+	history_.update(ema, newBar);
+	auto past = history_.oldest();
+	return array_type{ past != 0 ? 100 * (ema - past) / past : 0 };
+}
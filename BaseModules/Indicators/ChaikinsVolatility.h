@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Percentage change over period bars of the ema of the high - low range
+//
+class INDICATORSDLL ChaikinsVolatility
+{
+public:
+	ChaikinsVolatility(unsigned int period);
+	~ChaikinsVolatility();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		CHAIKINS_VOLATILITY,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class ChaikinsVolatilityImpl;
+	ChaikinsVolatilityImpl* impl_;
+};
@@ -0,0 +1,69 @@
+#include "ChandeMomentumOscillator.h"
+#include "IndicatorKernels.h"
+
+class ChandeMomentumOscillator::ChandeMomentumOscillatorImpl
+{
+public:
+	ChandeMomentumOscillatorImpl(unsigned int period);
+	~ChandeMomentumOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	BarState<double> previous_;
+	RollingWindow gains_;
+	RollingWindow losses_;
+};
+
+ChandeMomentumOscillator::ChandeMomentumOscillator(unsigned int period) :
+	impl_(new ChandeMomentumOscillatorImpl(period))
+{
+}
+
+ChandeMomentumOscillator::~ChandeMomentumOscillator()
+{
+	delete impl_;
+}
+
+ChandeMomentumOscillator::array_type ChandeMomentumOscillator::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+ChandeMomentumOscillator::array_type ChandeMomentumOscillator::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void ChandeMomentumOscillator::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+ChandeMomentumOscillator::ChandeMomentumOscillatorImpl::ChandeMomentumOscillatorImpl(unsigned int period) :
+	gains_(period),
+	losses_(period)
+{
+}
+
+ChandeMomentumOscillator::ChandeMomentumOscillatorImpl::~ChandeMomentumOscillatorImpl()
+{
+}
+
+ChandeMomentumOscillator::array_type ChandeMomentumOscillator::ChandeMomentumOscillatorImpl::update(const double sample, bool newBar)
+{
+	auto& previous = previous_.begin(newBar);
+	auto change = previous_.bars() > 1 ? sample - previous : 0;
+	previous = sample;
+
+	gains_.update(change > 0 ? change : 0, newBar);
+	losses_.update(change < 0 ? -change : 0, newBar);
+
+	auto total = gains_.sum() + losses_.sum();
+	return array_type{ total > 0 ? 100 * (gains_.sum() - losses_.sum()) / total : 0 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Sum of the gains minus the sum of the losses over the last period samples, relative to their total
+//
+class INDICATORSDLL ChandeMomentumOscillator
+{
+public:
+	ChandeMomentumOscillator(unsigned int period);
+	~ChandeMomentumOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		CHANDE_MOMENTUM_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class ChandeMomentumOscillatorImpl;
+	ChandeMomentumOscillatorImpl* impl_;
+};
@@ -0,0 +1,62 @@
+#include "CommodityChannelIndex.h"
+#include "IndicatorKernels.h"
+
+class CommodityChannelIndex::CommodityChannelIndexImpl
+{
+public:
+	CommodityChannelIndexImpl(unsigned int period);
+	~CommodityChannelIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	RollingMeanDeviation window_;
+};
+
+CommodityChannelIndex::CommodityChannelIndex(unsigned int period) :
+	impl_(new CommodityChannelIndexImpl(period))
+{
+}
+
+CommodityChannelIndex::~CommodityChannelIndex()
+{
+	delete impl_;
+}
+
+CommodityChannelIndex::array_type CommodityChannelIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+CommodityChannelIndex::array_type CommodityChannelIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void CommodityChannelIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+CommodityChannelIndex::CommodityChannelIndexImpl::CommodityChannelIndexImpl(unsigned int period) :
+	window_(period)
+{
+}
+
+CommodityChannelIndex::CommodityChannelIndexImpl::~CommodityChannelIndexImpl()
+{
+}
+
+CommodityChannelIndex::array_type CommodityChannelIndex::CommodityChannelIndexImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto typicalPrice = (sample.high + sample.low + sample.close) / 3;
+	window_.update(typicalPrice, newBar);
+
+	auto deviation = window_.meanDeviation();
+	return array_type{ deviation > 0 ? (typicalPrice - window_.mean()) / (0.015 * deviation) : 0 };
+}
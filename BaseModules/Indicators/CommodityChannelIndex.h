@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Deviation of the typical price from its simple moving average, scaled by 0.015 times the mean
+// deviation. O(period) per update for the mean deviation, see RollingMeanDeviation in
+// IndicatorKernels.h for why
+//
+class INDICATORSDLL CommodityChannelIndex
+{
+public:
+	CommodityChannelIndex(unsigned int period);
+	~CommodityChannelIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		COMMODITY_CHANNEL_INDEX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class CommodityChannelIndexImpl;
+	CommodityChannelIndexImpl* impl_;
+};
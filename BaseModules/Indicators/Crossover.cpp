@@ -0,0 +1,65 @@
+#include "Crossover.h"
+#include "IndicatorKernels.h"
+
+class Crossover::CrossoverImpl
+{
+public:
+	CrossoverImpl(bool anyDirection);
+	~CrossoverImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double first, const double second, bool newBar);
+private:
+	const bool anyDirection_;
+
+	// first and second samples of the latest bar
+	BarState<std::array<double, 2>> samples_;
+};
+
+Crossover::Crossover(bool anyDirection) :
+	impl_(new CrossoverImpl(anyDirection))
+{
+}
+
+Crossover::~Crossover()
+{
+	delete impl_;
+}
+
+Crossover::array_type Crossover::computeIndicatorPoint(const double first, const double second)
+{
+	return impl_->update(first, second, true);
+}
+
+Crossover::array_type Crossover::recomputeIndicatorPoint(const double first, const double second)
+{
+	return impl_->update(first, second, false);
+}
+
+Crossover::CrossoverImpl::CrossoverImpl(bool anyDirection) :
+	anyDirection_(anyDirection)
+{
+}
+
+Crossover::CrossoverImpl::~CrossoverImpl()
+{
+}
+
+Crossover::array_type Crossover::CrossoverImpl::update(const double first, const double second, bool newBar)
+{
+	auto& samples = samples_.begin(newBar);
+	auto previous = samples;
+	samples[0] = first;
+	samples[1] = second;
+
+	if (samples_.bars() < 2)
+	{
+		return array_type{ 0 };
+	}
+
+	bool crossedAbove = first > second && previous[0] <= previous[1];
+	bool crossedBelow = first < second && previous[0] >= previous[1];
+	return array_type{ crossedAbove || (anyDirection_ && crossedBelow) ? 1.0 : 0.0 };
+}
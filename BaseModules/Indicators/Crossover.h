@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// 1 on the bar where the first sample crosses above the second, otherwise 0. With anyDirection
+// crossing below also counts
+//
+class INDICATORSDLL Crossover
+{
+public:
+	Crossover(bool anyDirection);
+	~Crossover();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		CROSSOVER,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double first, const double second);
+	array_type recomputeIndicatorPoint(const double first, const double second);
+
+private:
+	class CrossoverImpl;
+	CrossoverImpl* impl_;
+};
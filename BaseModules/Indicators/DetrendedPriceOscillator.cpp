@@ -0,0 +1,62 @@
+#include "DetrendedPriceOscillator.h"
+#include "IndicatorKernels.h"
+
+class DetrendedPriceOscillator::DetrendedPriceOscillatorImpl
+{
+public:
+	DetrendedPriceOscillatorImpl(unsigned int period);
+	~DetrendedPriceOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow prices_;
+	RollingWindow average_;
+};
+
+DetrendedPriceOscillator::DetrendedPriceOscillator(unsigned int period) :
+	impl_(new DetrendedPriceOscillatorImpl(period))
+{
+}
+
+DetrendedPriceOscillator::~DetrendedPriceOscillator()
+{
+	delete impl_;
+}
+
+DetrendedPriceOscillator::array_type DetrendedPriceOscillator::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+DetrendedPriceOscillator::array_type DetrendedPriceOscillator::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void DetrendedPriceOscillator::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+DetrendedPriceOscillator::DetrendedPriceOscillatorImpl::DetrendedPriceOscillatorImpl(unsigned int period) :
+	prices_(checkPeriod(period) / 2 + 2),
+	average_(period)
+{
+}
+
+DetrendedPriceOscillator::DetrendedPriceOscillatorImpl::~DetrendedPriceOscillatorImpl()
+{
+}
+
+DetrendedPriceOscillator::array_type DetrendedPriceOscillator::DetrendedPriceOscillatorImpl::update(const double sample, bool newBar)
+{
+	prices_.update(sample, newBar);
+	average_.update(sample, newBar);
+	return array_type{ prices_.oldest() - average_.mean() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Sample period / 2 + 1 bars ago minus the simple moving average of the last period samples
+//
+class INDICATORSDLL DetrendedPriceOscillator
+{
+public:
+	DetrendedPriceOscillator(unsigned int period);
+	~DetrendedPriceOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		DETRENDED_PRICE_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class DetrendedPriceOscillatorImpl;
+	DetrendedPriceOscillatorImpl* impl_;
+};
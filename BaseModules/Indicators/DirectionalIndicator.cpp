@@ -0,0 +1,63 @@
+#include "DirectionalIndicator.h"
+#include "IndicatorKernels.h"
+
+class DirectionalIndicator::DirectionalIndicatorImpl
+{
+public:
+	DirectionalIndicatorImpl(unsigned int period);
+	~DirectionalIndicatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	DirectionalSystem system_;
+};
+
+DirectionalIndicator::DirectionalIndicator(unsigned int period) :
+	impl_(new DirectionalIndicatorImpl(period))
+{
+}
+
+DirectionalIndicator::~DirectionalIndicator()
+{
+	delete impl_;
+}
+
+DirectionalIndicator::array_type DirectionalIndicator::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+DirectionalIndicator::array_type DirectionalIndicator::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void DirectionalIndicator::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+DirectionalIndicator::DirectionalIndicatorImpl::DirectionalIndicatorImpl(unsigned int period) :
+	system_(period)
+{
+}
+
+DirectionalIndicator::DirectionalIndicatorImpl::~DirectionalIndicatorImpl()
+{
+}
+
+DirectionalIndicator::array_type DirectionalIndicator::DirectionalIndicatorImpl::update(const SamplePoint& sample, bool newBar)
+{
+	system_.update(sample, newBar);
+
+	array_type result;
+	result[PLUS_DI] = system_.plusIndicator();
+	result[MINUS_DI] = system_.minusIndicator();
+	return result;
+}
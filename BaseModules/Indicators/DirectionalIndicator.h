@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Plus and minus directional movement as a percentage of the average true range
+//
+class INDICATORSDLL DirectionalIndicator
+{
+public:
+	DirectionalIndicator(unsigned int period);
+	~DirectionalIndicator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		PLUS_DI,
+		MINUS_DI,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class DirectionalIndicatorImpl;
+	DirectionalIndicatorImpl* impl_;
+};
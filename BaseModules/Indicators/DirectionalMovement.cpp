@@ -0,0 +1,63 @@
+#include "DirectionalMovement.h"
+#include "IndicatorKernels.h"
+
+class DirectionalMovement::DirectionalMovementImpl
+{
+public:
+	DirectionalMovementImpl(unsigned int period);
+	~DirectionalMovementImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	DirectionalSystem system_;
+};
+
+DirectionalMovement::DirectionalMovement(unsigned int period) :
+	impl_(new DirectionalMovementImpl(period))
+{
+}
+
+DirectionalMovement::~DirectionalMovement()
+{
+	delete impl_;
+}
+
+DirectionalMovement::array_type DirectionalMovement::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+DirectionalMovement::array_type DirectionalMovement::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void DirectionalMovement::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+DirectionalMovement::DirectionalMovementImpl::DirectionalMovementImpl(unsigned int period) :
+	system_(period)
+{
+}
+
+DirectionalMovement::DirectionalMovementImpl::~DirectionalMovementImpl()
+{
+}
+
+DirectionalMovement::array_type DirectionalMovement::DirectionalMovementImpl::update(const SamplePoint& sample, bool newBar)
+{
+	system_.update(sample, newBar);
+
+	array_type result;
+	result[PLUS_DM] = system_.plusMovement();
+	result[MINUS_DM] = system_.minusMovement();
+	return result;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Plus and minus directional movement averaged with Wilder's smoothing
+//
+class INDICATORSDLL DirectionalMovement
+{
+public:
+	DirectionalMovement(unsigned int period);
+	~DirectionalMovement();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		PLUS_DM,
+		MINUS_DM,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class DirectionalMovementImpl;
+	DirectionalMovementImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "DirectionalMovementIndex.h"
+#include "IndicatorKernels.h"
+
+class DirectionalMovementIndex::DirectionalMovementIndexImpl
+{
+public:
+	DirectionalMovementIndexImpl(unsigned int period);
+	~DirectionalMovementIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	DirectionalSystem system_;
+};
+
+DirectionalMovementIndex::DirectionalMovementIndex(unsigned int period) :
+	impl_(new DirectionalMovementIndexImpl(period))
+{
+}
+
+DirectionalMovementIndex::~DirectionalMovementIndex()
+{
+	delete impl_;
+}
+
+DirectionalMovementIndex::array_type DirectionalMovementIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+DirectionalMovementIndex::array_type DirectionalMovementIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void DirectionalMovementIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+DirectionalMovementIndex::DirectionalMovementIndexImpl::DirectionalMovementIndexImpl(unsigned int period) :
+	system_(period)
+{
+}
+
+DirectionalMovementIndex::DirectionalMovementIndexImpl::~DirectionalMovementIndexImpl()
+{
+}
+
+DirectionalMovementIndex::array_type DirectionalMovementIndex::DirectionalMovementIndexImpl::update(const SamplePoint& sample, bool newBar)
+{
+	system_.update(sample, newBar);
+	return array_type{ system_.movementIndex() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Difference of the directional indicators relative to their sum, from 0 to 100
+//
+class INDICATORSDLL DirectionalMovementIndex
+{
+public:
+	DirectionalMovementIndex(unsigned int period);
+	~DirectionalMovementIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		DX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class DirectionalMovementIndexImpl;
+	DirectionalMovementIndexImpl* impl_;
+};
@@ -0,0 +1,74 @@
+#include "DonchianChannel.h"
+#include "RollingExtremum.h"
+
+class DonchianChannel::DonchianChannelImpl
+{
+public:
+	DonchianChannelImpl(unsigned int period);
+	~DonchianChannelImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	RollingMaximum highest_;
+	RollingMinimum lowest_;
+
+private:
+	array_type channel() const;
+};
+
+DonchianChannel::DonchianChannel(unsigned int period) :
+	impl_(new DonchianChannelImpl(period))
+{
+}
+
+DonchianChannel::~DonchianChannel()
+{
+	delete impl_;
+}
+
+DonchianChannel::array_type DonchianChannel::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+DonchianChannel::array_type DonchianChannel::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void DonchianChannel::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+DonchianChannel::DonchianChannelImpl::DonchianChannelImpl(unsigned int period) :
+	highest_(period),
+	lowest_(period)
+{
+}
+
+DonchianChannel::DonchianChannelImpl::~DonchianChannelImpl()
+{
+}
+
+DonchianChannel::array_type DonchianChannel::DonchianChannelImpl::update(const SamplePoint& sample, bool newBar)
+{
+	highest_.update(sample.high, newBar);
+	lowest_.update(sample.low, newBar);
+	return channel();
+}
+
+DonchianChannel::array_type DonchianChannel::DonchianChannelImpl::channel() const
+{
+	array_type result;
+	result[UPPER] = highest_.value();
+	result[LOWER] = lowest_.value();
+	result[MIDDLE] = (result[UPPER] + result[LOWER]) / 2;
+	return result;
+}
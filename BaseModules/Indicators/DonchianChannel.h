@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Highest high and lowest low over the last period candles and the midpoint between them
+//
+class INDICATORSDLL DonchianChannel
+{
+public:
+	DonchianChannel(unsigned int period);
+	~DonchianChannel();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		UPPER,
+		MIDDLE,
+		LOWER,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class DonchianChannelImpl;
+	DonchianChannelImpl* impl_;
+};
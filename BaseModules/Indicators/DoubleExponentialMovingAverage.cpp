@@ -0,0 +1,62 @@
+#include "DoubleExponentialMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class DoubleExponentialMovingAverage::DoubleExponentialMovingAverageImpl
+{
+public:
+	DoubleExponentialMovingAverageImpl(unsigned int period);
+	~DoubleExponentialMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	Ema ema_;
+	Ema emaOfEma_;
+};
+
+DoubleExponentialMovingAverage::DoubleExponentialMovingAverage(unsigned int period) :
+	impl_(new DoubleExponentialMovingAverageImpl(period))
+{
+}
+
+DoubleExponentialMovingAverage::~DoubleExponentialMovingAverage()
+{
+	delete impl_;
+}
+
+DoubleExponentialMovingAverage::array_type DoubleExponentialMovingAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+DoubleExponentialMovingAverage::array_type DoubleExponentialMovingAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void DoubleExponentialMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+DoubleExponentialMovingAverage::DoubleExponentialMovingAverageImpl::DoubleExponentialMovingAverageImpl(unsigned int period) :
+	ema_(emaAlpha(period)),
+	emaOfEma_(emaAlpha(period))
+{
+}
+
+DoubleExponentialMovingAverage::DoubleExponentialMovingAverageImpl::~DoubleExponentialMovingAverageImpl()
+{
+}
+
+DoubleExponentialMovingAverage::array_type DoubleExponentialMovingAverage::DoubleExponentialMovingAverageImpl::update(const double sample, bool newBar)
+{
+	auto ema = ema_.update(sample, newBar);
+	auto emaOfEma = emaOfEma_.update(ema, newBar);
+	return array_type{ 2 * ema - emaOfEma };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Double exponential moving average. 2 * ema - ema of ema
+//
+class INDICATORSDLL DoubleExponentialMovingAverage
+{
+public:
+	DoubleExponentialMovingAverage(unsigned int period);
+	~DoubleExponentialMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		DOUBLE_EXPONENTIAL_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class DoubleExponentialMovingAverageImpl;
+	DoubleExponentialMovingAverageImpl* impl_;
+};
@@ -0,0 +1,63 @@
+#include "EaseOfMovement.h"
+#include "IndicatorKernels.h"
+
+class EaseOfMovement::EaseOfMovementImpl
+{
+public:
+	EaseOfMovementImpl();
+	~EaseOfMovementImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> midpoint_;
+};
+
+EaseOfMovement::EaseOfMovement() :
+	impl_(new EaseOfMovementImpl())
+{
+}
+
+EaseOfMovement::~EaseOfMovement()
+{
+	delete impl_;
+}
+
+EaseOfMovement::array_type EaseOfMovement::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+EaseOfMovement::array_type EaseOfMovement::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void EaseOfMovement::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+EaseOfMovement::EaseOfMovementImpl::EaseOfMovementImpl()
+{
+}
+
+EaseOfMovement::EaseOfMovementImpl::~EaseOfMovementImpl()
+{
+}
+
+EaseOfMovement::array_type EaseOfMovement::EaseOfMovementImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& midpoint = midpoint_.begin(newBar);
+	auto distance = midpoint_.bars() > 1 ? (sample.high + sample.low) / 2 - midpoint : 0;
+	midpoint = (sample.high + sample.low) / 2;
+
+	auto range = sample.high - sample.low;
+	auto boxRatio = range > 0 ? sample.volume / 10000 / range : 0;
+	return array_type{ boxRatio > 0 ? distance / boxRatio : 0 };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Move of the midpoint of the candle from the previous candle per unit of volume over the range,
+// with the volume in units of 10000
+//
+class INDICATORSDLL EaseOfMovement
+{
+public:
+	EaseOfMovement();
+	~EaseOfMovement();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		EASE_OF_MOVEMENT,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class EaseOfMovementImpl;
+	EaseOfMovementImpl* impl_;
+};
@@ -0,0 +1,61 @@
+#include "ExponentialDecay.h"
+#include "IndicatorKernels.h"
+
+class ExponentialDecay::ExponentialDecayImpl
+{
+public:
+	ExponentialDecayImpl(unsigned int period);
+	~ExponentialDecayImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	const unsigned int period_;
+	BarState<double> decay_;
+};
+
+ExponentialDecay::ExponentialDecay(unsigned int period) :
+	impl_(new ExponentialDecayImpl(period))
+{
+}
+
+ExponentialDecay::~ExponentialDecay()
+{
+	delete impl_;
+}
+
+ExponentialDecay::array_type ExponentialDecay::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+ExponentialDecay::array_type ExponentialDecay::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void ExponentialDecay::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+ExponentialDecay::ExponentialDecayImpl::ExponentialDecayImpl(unsigned int period) :
+	period_(checkPeriod(period))
+{
+}
+
+ExponentialDecay::ExponentialDecayImpl::~ExponentialDecayImpl()
+{
+}
+
+ExponentialDecay::array_type ExponentialDecay::ExponentialDecayImpl::update(const double sample, bool newBar)
+{
+	auto& decay = decay_.begin(newBar);
+	decay = decay_.bars() == 1 ? sample : (std::max)(sample, decay * (period_ - 1) / period_);
+	return array_type{ decay };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// The sample, or the previous value scaled by (period - 1) / period if that is greater
+//
+class INDICATORSDLL ExponentialDecay
+{
+public:
+	ExponentialDecay(unsigned int period);
+	~ExponentialDecay();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		EXPONENTIAL_DECAY,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class ExponentialDecayImpl;
+	ExponentialDecayImpl* impl_;
+};
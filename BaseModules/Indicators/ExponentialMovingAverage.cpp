@@ -1,4 +1,5 @@
 #include "ExponentialMovingAverage.h"
+#include "IndicatorKernels.h"
 
 class ExponentialMovingAverage::ExponentialMovingAverageImpl
 {
@@ -6,13 +7,15 @@ public:
 	ExponentialMovingAverageImpl(int period);
 	~ExponentialMovingAverageImpl();
 
-	array_type computeIndicatorPoint(const double sample);
-	array_type recomputeIndicatorPoint(const double sample);
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
 
 private:
-	const double scale_;
-	double pEma_;
-	double cEma_;
+	// the first point of the ema is the input itself. recomputing the latest bar always starts
+	// from the ema committed at the close of the previous bar
+	Ema ema_;
 };
 
 
@@ -28,49 +31,32 @@ ExponentialMovingAverage::~ExponentialMovingAverage()
 
 ExponentialMovingAverage::array_type ExponentialMovingAverage::computeIndicatorPoint(const double sample)
 {
-	return impl_->computeIndicatorPoint(sample);
+	return impl_->update(sample, true);
 }
 
 ExponentialMovingAverage::array_type ExponentialMovingAverage::recomputeIndicatorPoint(const double sample)
 {
-	return impl_->recomputeIndicatorPoint(sample);
+	return impl_->update(sample, false);
 }
 
-ExponentialMovingAverage::ExponentialMovingAverageImpl::ExponentialMovingAverageImpl(int period):
-	scale_(static_cast<double>(2) / ( period + 1))
+void ExponentialMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
 {
-	cEma_ = 0;
-	pEma_ = cEma_;
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
 }
 
-ExponentialMovingAverage::ExponentialMovingAverageImpl::~ExponentialMovingAverageImpl()
+ExponentialMovingAverage::ExponentialMovingAverageImpl::ExponentialMovingAverageImpl(int period):
+	ema_(emaAlpha(period > 0 ? static_cast<unsigned int>(period) : 0))
 {
 }
 
-ExponentialMovingAverage::array_type ExponentialMovingAverage::ExponentialMovingAverageImpl::computeIndicatorPoint(const double sample)
+ExponentialMovingAverage::ExponentialMovingAverageImpl::~ExponentialMovingAverageImpl()
 {
-	// save the current cma as the previous 
-	pEma_ = cEma_;
-
-	// first point of ema is the input itself
-	if (cEma_ == 0)
-	{
-		cEma_ = sample;
-	}
-	else
-	{
-		cEma_ = (1 - scale_) * (pEma_)+(scale_ * sample);
-	}
-
-	return {cEma_};
 }
 
-ExponentialMovingAverage::array_type ExponentialMovingAverage::ExponentialMovingAverageImpl::recomputeIndicatorPoint(const double sample)
+ExponentialMovingAverage::array_type ExponentialMovingAverage::ExponentialMovingAverageImpl::update(const double sample, bool newBar)
 {
-	// first point of the ema is the input value itself
-	if (pEma_ == 0)
-	{
-		return { sample };
-	}
-	return {(1 - scale_) * (pEma_) + scale_ * sample};
+	return array_type{ ema_.update(sample, newBar) };
 }
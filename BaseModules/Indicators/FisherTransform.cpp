@@ -0,0 +1,82 @@
+#include "FisherTransform.h"
+#include "IndicatorKernels.h"
+#include "RollingExtremum.h"
+
+class FisherTransform::FisherTransformImpl
+{
+public:
+	FisherTransformImpl(unsigned int period);
+	~FisherTransformImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	struct Fisher
+	{
+		double value;
+		double fisher;
+	};
+
+	RollingMaximum highest_;
+	RollingMinimum lowest_;
+	BarState<Fisher> state_;
+};
+
+FisherTransform::FisherTransform(unsigned int period) :
+	impl_(new FisherTransformImpl(period))
+{
+}
+
+FisherTransform::~FisherTransform()
+{
+	delete impl_;
+}
+
+FisherTransform::array_type FisherTransform::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+FisherTransform::array_type FisherTransform::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void FisherTransform::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+FisherTransform::FisherTransformImpl::FisherTransformImpl(unsigned int period) :
+	highest_(period),
+	lowest_(period)
+{
+}
+
+FisherTransform::FisherTransformImpl::~FisherTransformImpl()
+{
+}
+
+FisherTransform::array_type FisherTransform::FisherTransformImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto median = (sample.high + sample.low) / 2;
+	highest_.update(median, newBar);
+	lowest_.update(median, newBar);
+
+	auto& fisher = state_.begin(newBar);
+	array_type result;
+	result[SIGNAL] = fisher.fisher;
+
+	auto range = highest_.value() - lowest_.value();
+	auto position = range > 0 ? (median - lowest_.value()) / range - 0.5 : 0;
+	fisher.value = (std::max)(-0.999, (std::min)(0.999, 0.66 * position + 0.67 * fisher.value));
+	fisher.fisher = 0.5 * std::log((1 + fisher.value) / (1 - fisher.value)) + 0.5 * fisher.fisher;
+
+	result[FISHER] = fisher.fisher;
+	return result;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Fisher transform of the position of the median price within its range over the last period
+// candles. The signal is the transform of the previous candle
+//
+class INDICATORSDLL FisherTransform
+{
+public:
+	FisherTransform(unsigned int period);
+	~FisherTransform();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		FISHER,
+		SIGNAL,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class FisherTransformImpl;
+	FisherTransformImpl* impl_;
+};
@@ -0,0 +1,67 @@
+#include "ForecastOscillator.h"
+#include "IndicatorKernels.h"
+
+class ForecastOscillator::ForecastOscillatorImpl
+{
+public:
+	ForecastOscillatorImpl(unsigned int period);
+	~ForecastOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingRegression regression_;
+	BarState<double> forecast_;
+};
+
+ForecastOscillator::ForecastOscillator(unsigned int period) :
+	impl_(new ForecastOscillatorImpl(period))
+{
+}
+
+ForecastOscillator::~ForecastOscillator()
+{
+	delete impl_;
+}
+
+ForecastOscillator::array_type ForecastOscillator::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+ForecastOscillator::array_type ForecastOscillator::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void ForecastOscillator::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+ForecastOscillator::ForecastOscillatorImpl::ForecastOscillatorImpl(unsigned int period) :
+	regression_(period)
+{
+}
+
+ForecastOscillator::ForecastOscillatorImpl::~ForecastOscillatorImpl()
+{
+}
+
+ForecastOscillator::array_type ForecastOscillator::ForecastOscillatorImpl::update(const double sample, bool newBar)
+{
+	regression_.update(sample, newBar);
+	auto& forecast = forecast_.begin(newBar);
+	forecast = regression_.valueAt(1);
+
+	if (forecast_.bars() < 2 || sample == 0)
+	{
+		return array_type{ 0 };
+	}
+	return array_type{ 100 * (sample - forecast_.committed()) / sample };
+}
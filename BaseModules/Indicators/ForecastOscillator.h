@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Percentage difference between the sample and the time series forecast made at the previous bar
+//
+class INDICATORSDLL ForecastOscillator
+{
+public:
+	ForecastOscillator(unsigned int period);
+	~ForecastOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		FORECAST_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class ForecastOscillatorImpl;
+	ForecastOscillatorImpl* impl_;
+};
@@ -0,0 +1,65 @@
+#include "HullMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class HullMovingAverage::HullMovingAverageImpl
+{
+public:
+	HullMovingAverageImpl(unsigned int period);
+	~HullMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingRegression half_;
+	RollingRegression full_;
+	RollingRegression smoothing_;
+};
+
+HullMovingAverage::HullMovingAverage(unsigned int period) :
+	impl_(new HullMovingAverageImpl(period))
+{
+}
+
+HullMovingAverage::~HullMovingAverage()
+{
+	delete impl_;
+}
+
+HullMovingAverage::array_type HullMovingAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+HullMovingAverage::array_type HullMovingAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void HullMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+HullMovingAverage::HullMovingAverageImpl::HullMovingAverageImpl(unsigned int period) :
+	half_((std::max)(checkPeriod(period) / 2, 1u)),
+	full_(period),
+	smoothing_((std::max)(static_cast<unsigned int>(std::sqrt(period)), 1u))
+{
+}
+
+HullMovingAverage::HullMovingAverageImpl::~HullMovingAverageImpl()
+{
+}
+
+HullMovingAverage::array_type HullMovingAverage::HullMovingAverageImpl::update(const double sample, bool newBar)
+{
+	half_.update(sample, newBar);
+	full_.update(sample, newBar);
+	smoothing_.update(2 * half_.weightedMean() - full_.weightedMean(), newBar);
+	return array_type{ smoothing_.weightedMean() };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Hull moving average. Weighted moving average over sqrt(period) of
+// 2 * wma(period / 2) - wma(period)
+//
+class INDICATORSDLL HullMovingAverage
+{
+public:
+	HullMovingAverage(unsigned int period);
+	~HullMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		HULL_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class HullMovingAverageImpl;
+	HullMovingAverageImpl* impl_;
+};
@@ -0,0 +1,624 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#include "Indicators.h"
+
+//
+// Runs a set of indicators over the same candles. Each indicator is a node keyed by its type, its
+// parameters and its inputs. Adding a node identical to an existing one returns the existing node, so
+// an indicator used by several graphs or by a strategy is computed once per candle.
+//
+// The inputs of a node are series, either a field of the candle or an output of another node. A node
+// can only take the series of nodes added before it, so the order the nodes are added in is a
+// topological order and update propagates a candle through the whole graph in a single pass.
+// Subscribers read the outputs by handle.
+//
+class IndicatorEngine
+{
+public:
+	enum CandleField
+	{
+		OPEN,
+		HIGH,
+		LOW,
+		CLOSE,
+		VOLUME,
+		CANDLE_FIELDS
+	};
+
+	//
+	// a stream of values, either a field of the candle or one output of a node
+	//
+	struct Series
+	{
+		size_t slot;
+	};
+
+	//
+	// a node of the graph. output(i) is the series of output i of the indicator
+	//
+	class Handle
+	{
+	public:
+		Handle() :
+			node_(0),
+			firstSlot_(0),
+			size_(0)
+		{
+		}
+
+		Series output(size_t index) const
+		{
+			if (index >= size_)
+			{
+				throw std::out_of_range("Indicator output does not exist.");
+			}
+			return Series{ firstSlot_ + index };
+		}
+
+		size_t size() const
+		{
+			return size_;
+		}
+
+	private:
+		friend class IndicatorEngine;
+
+		Handle(size_t node, size_t firstSlot, size_t size) :
+			node_(node),
+			firstSlot_(firstSlot),
+			size_(size)
+		{
+		}
+
+		size_t node_;
+		size_t firstSlot_;
+		size_t size_;
+	};
+
+	IndicatorEngine() :
+		values_(CANDLE_FIELDS, 0),
+		slotOwners_(CANDLE_FIELDS, noOwner())
+	{
+	}
+
+	IndicatorEngine(const IndicatorEngine&) = delete;
+	IndicatorEngine& operator=(const IndicatorEngine&) = delete;
+
+	static Series candle(CandleField field)
+	{
+		return Series{ static_cast<size_t>(field) };
+	}
+
+	//
+	// adds an indicator computed from a single value, e.g. add<SimpleMovingAverage>(candle(CLOSE), 20)
+	//
+	template<typename T, typename... Args>
+	Handle add(Series input, Args... args)
+	{
+		return addNode<T>(ValueInput{ input.slot }, "v" + std::to_string(input.slot), { input.slot }, args...);
+	}
+
+	//
+	// adds an indicator computed from the whole candle, e.g. addOnCandle<AverageTrueRange>(14)
+	//
+	template<typename T, typename... Args>
+	Handle addOnCandle(Args... args)
+	{
+		return addNode<T>(CandleInput{}, "c", {}, args...);
+	}
+
+	//
+	// adds an indicator computed from two values, e.g. addOnPair<Crossover>(fast.output(0), slow.output(0), false)
+	//
+	template<typename T, typename... Args>
+	Handle addOnPair(Series first, Series second, Args... args)
+	{
+		return addNode<T>(PairInput{ first.slot, second.slot }, "p" + std::to_string(first.slot) + "," + std::to_string(second.slot), { first.slot, second.slot }, args...);
+	}
+
+	//
+	// each add returns a reference to the node which is given back here. the node is removed once it
+	// has no references left, including the nodes which take its outputs
+	//
+	void release(const Handle& handle)
+	{
+		releaseNode(handle.node_);
+	}
+
+	//
+	// propagates the candle through every node. newBar begins a new bar, otherwise the latest bar is
+	// replaced, same as computeIndicatorPoint and recomputeIndicatorPoint
+	//
+	void update(const SamplePoint& candle, bool newBar)
+	{
+		writeCandle(values_, candle);
+		for (auto& node : nodes_)
+		{
+			if (node.node)
+			{
+				node.node->update(values_, candle, newBar);
+				node.updated = true;
+			}
+		}
+	}
+
+	double value(Series series) const
+	{
+		return values_[series.slot];
+	}
+
+	//
+	// the latest value of every series, indexed by slot. a copy keeps the values as of the candle it was
+	// taken after and is read back with value(values, series), which gives NaN for the series added since
+	//
+	const std::vector<double>& values() const
+	{
+		return values_;
+	}
+
+	static double value(const std::vector<double>& values, Series series)
+	{
+		return series.slot < values.size() ? values[series.slot] : std::numeric_limits<double>::quiet_NaN();
+	}
+
+	//
+	// computes the outputs of the node over past candles, each candle beginning a new bar. onCandle is
+	// called with the index of the candle and the outputs of the node after it. Nodes which have not been
+	// updated yet are brought up to date by the replay. The others keep their state and the replay runs
+	// over fresh copies of them, which is how a node shared with an earlier subscriber gives the new
+	// subscriber its history.
+	//
+	// The replay runs each node over every candle with computeIndicatorPoints rather than each candle
+	// through every node, so the past bars of an indicator are computed in a single call.
+	//
+	void replay(const Handle& handle, const SamplePoint* candles, size_t count, const std::function<void(size_t, const double*)>& onCandle)
+	{
+		auto columns = candleColumns(values_.size(), candles, count);
+		for (auto index : dependencies(handle.node_))
+		{
+			auto& node = nodes_[index];
+			if (node.updated)
+			{
+				node.node->fresh()->replay(columns, candles, count);
+			}
+			else
+			{
+				node.node->replay(columns, candles, count);
+
+				// the node was brought up to date and keeps its outputs
+				if (count > 0)
+				{
+					for (size_t slot = node.firstSlot; slot < node.firstSlot + node.size; ++slot)
+					{
+						values_[slot] = columns[slot].back();
+					}
+					node.updated = true;
+				}
+			}
+		}
+
+		emitOutputs(handle, columns, count, onCandle);
+	}
+
+	class Backfill;
+
+	//
+	// copies the node and every node it depends on without their history, so that the past bars of a
+	// new subscriber can be computed away from the engine, e.g. on another thread, while the engine goes
+	// on taking candles. see Backfill
+	//
+	Backfill backfill(const Handle& handle) const;
+
+	//
+	// once the backfill has taken every candle the engine was given since it was made, hands the nodes
+	// which had no history then over to the engine in place of its own, which have seen only those
+	// candles. the other nodes of the engine already had the whole history and are kept
+	//
+	void install(Backfill& backfill);
+
+private:
+	// owner of the slots holding the fields of the candle
+	static size_t noOwner()
+	{
+		return static_cast<size_t>(-1);
+	}
+
+	class Node
+	{
+	public:
+		virtual ~Node() {}
+
+		virtual void update(std::vector<double>& values, const SamplePoint& candle, bool newBar) = 0;
+
+		// computes count bars at once, filling the columns of the outputs from those of the inputs
+		virtual void replay(std::vector<std::vector<double>>& columns, const SamplePoint* candles, size_t count) = 0;
+
+		// node with the same indicator and inputs but no history
+		virtual std::unique_ptr<Node> fresh() const = 0;
+	};
+
+	struct ValueInput
+	{
+		size_t slot;
+
+		template<typename T>
+		typename T::array_type update(T& indicator, const std::vector<double>& values, const SamplePoint&, bool newBar) const
+		{
+			return updateIndicator(indicator, values[slot], newBar);
+		}
+
+		template<typename T>
+		void replay(T& indicator, const std::vector<std::vector<double>>& columns, const SamplePoint*, size_t count, typename T::array_type* points) const
+		{
+			computeIndicatorPoints(indicator, columns[slot].data(), count, points);
+		}
+	};
+
+	struct CandleInput
+	{
+		template<typename T>
+		typename T::array_type update(T& indicator, const std::vector<double>&, const SamplePoint& candle, bool newBar) const
+		{
+			return updateIndicator(indicator, candle, newBar);
+		}
+
+		template<typename T>
+		void replay(T& indicator, const std::vector<std::vector<double>>&, const SamplePoint* candles, size_t count, typename T::array_type* points) const
+		{
+			computeIndicatorPoints(indicator, candles, count, points);
+		}
+	};
+
+	struct PairInput
+	{
+		size_t first;
+		size_t second;
+
+		template<typename T>
+		typename T::array_type update(T& indicator, const std::vector<double>& values, const SamplePoint&, bool newBar) const
+		{
+			return newBar ? indicator.computeIndicatorPoint(values[first], values[second]) : indicator.recomputeIndicatorPoint(values[first], values[second]);
+		}
+
+		template<typename T>
+		void replay(T& indicator, const std::vector<std::vector<double>>& columns, const SamplePoint*, size_t count, typename T::array_type* points) const
+		{
+			for (size_t c = 0; c < count; ++c)
+			{
+				points[c] = indicator.computeIndicatorPoint(columns[first][c], columns[second][c]);
+			}
+		}
+	};
+
+	template<typename T, typename Input>
+	class IndicatorNode : public Node
+	{
+	public:
+		IndicatorNode(std::function<std::unique_ptr<T>()> make, Input input, size_t firstSlot) :
+			make_(make),
+			indicator_(make()),
+			input_(input),
+			firstSlot_(firstSlot)
+		{
+		}
+
+		void update(std::vector<double>& values, const SamplePoint& candle, bool newBar) override
+		{
+			auto outputs = input_.update(*indicator_, values, candle, newBar);
+			std::copy(outputs.begin(), outputs.end(), values.begin() + firstSlot_);
+		}
+
+		void replay(std::vector<std::vector<double>>& columns, const SamplePoint* candles, size_t count) override
+		{
+			std::vector<typename T::array_type> points(count);
+			input_.replay(*indicator_, columns, candles, count, points.data());
+			for (size_t i = 0; i < T::SIZE; ++i)
+			{
+				auto& column = columns[firstSlot_ + i];
+				column.resize(count);
+				for (size_t c = 0; c < count; ++c)
+				{
+					column[c] = points[c][i];
+				}
+			}
+		}
+
+		std::unique_ptr<Node> fresh() const override
+		{
+			return std::unique_ptr<Node>(new IndicatorNode(make_, input_, firstSlot_));
+		}
+
+	private:
+		std::function<std::unique_ptr<T>()> make_;
+		std::unique_ptr<T> indicator_;
+		Input input_;
+		size_t firstSlot_;
+	};
+
+	struct Entry
+	{
+		std::unique_ptr<Node> node;
+		std::string key;
+
+		// nodes whose outputs are inputs of this node
+		std::vector<size_t> inputs;
+
+		size_t firstSlot;
+		size_t size;
+		unsigned int references;
+
+		// false until the node is given its first candle
+		bool updated;
+	};
+
+	// nodes in the order they were added, which is a topological order. removed nodes stay as empty
+	// entries so that handles and slots remain valid
+	std::vector<Entry> nodes_;
+	std::unordered_map<std::string, size_t> keys_;
+
+	// latest value of every series. the first CANDLE_FIELDS slots are the fields of the candle, followed
+	// by the outputs of each node
+	std::vector<double> values_;
+	std::vector<size_t> slotOwners_;
+
+	template<typename T, typename Input, typename... Args>
+	Handle addNode(Input input, const std::string& inputKey, std::vector<size_t> inputSlots, Args... args)
+	{
+		auto key = makeKey<T>(inputKey, args...);
+		auto found = keys_.find(key);
+		if (found != keys_.end())
+		{
+			auto& node = nodes_[found->second];
+			++node.references;
+			return Handle(found->second, node.firstSlot, node.size);
+		}
+
+		std::vector<size_t> inputNodes;
+		for (auto slot : inputSlots)
+		{
+			if (slot >= values_.size() || (slotOwners_[slot] != noOwner() && !nodes_[slotOwners_[slot]].node))
+			{
+				throw std::invalid_argument("Indicator input does not exist.");
+			}
+			if (slotOwners_[slot] != noOwner())
+			{
+				inputNodes.push_back(slotOwners_[slot]);
+			}
+		}
+
+		auto index = nodes_.size();
+		auto firstSlot = values_.size();
+		std::function<std::unique_ptr<T>()> make = [args...]()
+		{
+			return std::unique_ptr<T>(new T(args...));
+		};
+
+		Entry entry;
+		entry.node.reset(new IndicatorNode<T, Input>(make, input, firstSlot));
+		entry.key = key;
+		entry.firstSlot = firstSlot;
+		entry.size = T::SIZE;
+		entry.references = 1;
+		entry.updated = false;
+
+		for (auto inputNode : inputNodes)
+		{
+			++nodes_[inputNode].references;
+		}
+		entry.inputs = std::move(inputNodes);
+
+		nodes_.push_back(std::move(entry));
+		values_.resize(firstSlot + T::SIZE, 0);
+		slotOwners_.resize(firstSlot + T::SIZE, index);
+		keys_[key] = index;
+
+		return Handle(index, firstSlot, T::SIZE);
+	}
+
+	void releaseNode(size_t index)
+	{
+		auto& node = nodes_[index];
+		if (!node.node || --node.references > 0)
+		{
+			return;
+		}
+
+		keys_.erase(node.key);
+		node.node.reset();
+
+		auto inputs = std::move(node.inputs);
+		for (auto input : inputs)
+		{
+			releaseNode(input);
+		}
+	}
+
+	// the node and every node it depends on, in topological order
+	std::vector<size_t> dependencies(size_t index) const
+	{
+		std::vector<size_t> closure;
+		std::vector<size_t> pending{ index };
+		while (!pending.empty())
+		{
+			auto node = pending.back();
+			pending.pop_back();
+			if (std::find(closure.begin(), closure.end(), node) == closure.end())
+			{
+				closure.push_back(node);
+				pending.insert(pending.end(), nodes_[node].inputs.begin(), nodes_[node].inputs.end());
+			}
+		}
+		std::sort(closure.begin(), closure.end());
+		return closure;
+	}
+
+	// one column of count values for every series. the columns of the fields of the candle are filled
+	// here, those of the nodes as each node is replayed
+	static std::vector<std::vector<double>> candleColumns(size_t slots, const SamplePoint* candles, size_t count)
+	{
+		std::vector<std::vector<double>> columns(slots);
+		for (size_t field = 0; field < CANDLE_FIELDS; ++field)
+		{
+			columns[field].resize(count);
+		}
+		for (size_t c = 0; c < count; ++c)
+		{
+			columns[OPEN][c] = candles[c].open;
+			columns[HIGH][c] = candles[c].high;
+			columns[LOW][c] = candles[c].low;
+			columns[CLOSE][c] = candles[c].close;
+			columns[VOLUME][c] = candles[c].volume;
+		}
+		return columns;
+	}
+
+	static void emitOutputs(const Handle& handle, const std::vector<std::vector<double>>& columns, size_t count, const std::function<void(size_t, const double*)>& onCandle)
+	{
+		std::vector<double> outputs(handle.size_);
+		for (size_t c = 0; c < count; ++c)
+		{
+			for (size_t i = 0; i < handle.size_; ++i)
+			{
+				outputs[i] = columns[handle.firstSlot_ + i][c];
+			}
+			onCandle(c, outputs.data());
+		}
+	}
+
+	static void writeCandle(std::vector<double>& values, const SamplePoint& candle)
+	{
+		values[OPEN] = candle.open;
+		values[HIGH] = candle.high;
+		values[LOW] = candle.low;
+		values[CLOSE] = candle.close;
+		values[VOLUME] = candle.volume;
+	}
+
+	template<typename T, typename... Args>
+	static std::string makeKey(const std::string& input, const Args&... args)
+	{
+		std::ostringstream key;
+		key.precision(17);
+		key << typeid(T).name() << '(' << input << ')';
+
+		// appends every parameter in order
+		int expand[] = { 0, (appendKey(key, args, std::is_enum<Args>()), 0)... };
+		(void)expand;
+
+		return key.str();
+	}
+
+	template<typename Arg>
+	static void appendKey(std::ostringstream& key, const Arg& arg, std::true_type)
+	{
+		key << ',' << static_cast<long long>(arg);
+	}
+
+	template<typename Arg>
+	static void appendKey(std::ostringstream& key, const Arg& arg, std::false_type)
+	{
+		key << ',' << arg;
+	}
+};
+
+//
+// the nodes of a subscriber's indicator and of its inputs, copied from the engine without history. run
+// computes their outputs over the past candles, like IndicatorEngine::replay, and may be called on any
+// thread since the copies share nothing with the engine. update then gives them, on the engine's thread,
+// the candles the engine took in the meantime, each beginning a new bar, before they are installed
+//
+class IndicatorEngine::Backfill
+{
+public:
+	void run(const SamplePoint* candles, size_t count, const std::function<void(size_t, const double*)>& onCandle)
+	{
+		auto columns = candleColumns(values_.size(), candles, count);
+		for (auto& copy : copies_)
+		{
+			copy.node->replay(columns, candles, count);
+			if (count > 0)
+			{
+				for (size_t slot = copy.firstSlot; slot < copy.firstSlot + copy.size; ++slot)
+				{
+					values_[slot] = columns[slot].back();
+				}
+			}
+		}
+		emitOutputs(handle_, columns, count, onCandle);
+	}
+
+	void update(const SamplePoint& candle)
+	{
+		writeCandle(values_, candle);
+		for (auto& copy : copies_)
+		{
+			copy.node->update(values_, candle, true);
+		}
+	}
+
+	double value(Series series) const
+	{
+		return values_[series.slot];
+	}
+
+private:
+	friend class IndicatorEngine;
+
+	struct Copy
+	{
+		size_t index;
+		size_t firstSlot;
+		size_t size;
+		std::unique_ptr<Node> node;
+
+		// the node of the engine had no history when the copy was made
+		bool install;
+	};
+
+	Backfill(const Handle& handle, size_t slots) :
+		handle_(handle),
+		values_(slots, 0)
+	{
+	}
+
+	Handle handle_;
+	std::vector<Copy> copies_;
+	std::vector<double> values_;
+};
+
+inline IndicatorEngine::Backfill IndicatorEngine::backfill(const Handle& handle) const
+{
+	Backfill backfill(handle, values_.size());
+	for (auto index : dependencies(handle.node_))
+	{
+		const auto& node = nodes_[index];
+		backfill.copies_.push_back(Backfill::Copy{ index, node.firstSlot, node.size, node.node->fresh(), !node.updated });
+	}
+	return backfill;
+}
+
+inline void IndicatorEngine::install(Backfill& backfill)
+{
+	for (auto& copy : backfill.copies_)
+	{
+		// nodes released since the backfill was made are left out
+		auto& node = nodes_[copy.index];
+		if (copy.install && node.node)
+		{
+			node.node = std::move(copy.node);
+			std::copy(backfill.values_.begin() + node.firstSlot, backfill.values_.begin() + node.firstSlot + node.size, values_.begin() + node.firstSlot);
+			node.updated = true;
+		}
+	}
+}
@@ -0,0 +1,611 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "Indicators.h"
+#include "RingBuffer.h"
+
+//
+// Building blocks shared by the streaming indicators. They keep the committed and provisional
+// state described in Indicators.h. Every building block is updated with update(sample, newBar). newBar is true when sample begins a new bar, which is what
+// computeIndicatorPoint does, and false when sample replaces the latest bar, which is what
+// recomputeIndicatorPoint does. Replacing the latest bar before any bar was added begins the
+// first bar. Each update is O(1) unless noted otherwise.
+//
+
+inline unsigned int checkPeriod(unsigned int period)
+{
+	if (period == 0)
+	{
+		throw std::invalid_argument("Indicator period must be positive.");
+	}
+	return period;
+}
+
+inline double emaAlpha(unsigned int period)
+{
+	return 2.0 / (checkPeriod(period) + 1);
+}
+
+//
+// State of an indicator as of the latest bar, kept apart from its state as of the previous bar.
+// begin(newBar) returns the state to update for the latest bar. It always starts as a copy of the
+// committed state, so the latest bar can be replaced any number of times. When a new bar begins, the
+// state of the latest bar is committed first.
+//
+template<typename T>
+class BarState
+{
+public:
+	BarState() :
+		committed_(),
+		current_(),
+		bars_(0)
+	{
+	}
+
+	explicit BarState(const T& initial) :
+		committed_(initial),
+		current_(initial),
+		bars_(0)
+	{
+	}
+
+	T& begin(bool newBar)
+	{
+		if (newBar || bars_ == 0)
+		{
+			if (bars_ > 0)
+			{
+				committed_ = current_;
+			}
+			++bars_;
+		}
+		current_ = committed_;
+		return current_;
+	}
+
+	// state as of the previous bar
+	const T& committed() const
+	{
+		return committed_;
+	}
+
+	// state as of the latest bar
+	const T& current() const
+	{
+		return current_;
+	}
+
+	// number of bars including the latest one
+	unsigned long long bars() const
+	{
+		return bars_;
+	}
+
+private:
+	T committed_;
+	T current_;
+	unsigned long long bars_;
+};
+
+//
+// Exponential moving average seeded with the first sample, same as ExponentialMovingAverage.
+// The smoothing factor can also be given with each sample for the adaptive averages.
+//
+class Ema
+{
+public:
+	explicit Ema(double alpha) :
+		alpha_(alpha)
+	{
+	}
+
+	double update(double sample, bool newBar)
+	{
+		return update(sample, alpha_, newBar);
+	}
+
+	double update(double sample, double alpha, bool newBar)
+	{
+		auto& ema = state_.begin(newBar);
+		ema = state_.bars() == 1 ? sample : ema + alpha * (sample - ema);
+		return ema;
+	}
+
+	double value() const
+	{
+		return state_.current();
+	}
+
+	// value at the close of the previous bar
+	double previous() const
+	{
+		return state_.committed();
+	}
+
+	unsigned long long bars() const
+	{
+		return state_.bars();
+	}
+
+private:
+	const double alpha_;
+	BarState<double> state_;
+};
+
+//
+// Wilder's smoothing. Until period bars have been added it is the average of the bars so far,
+// afterwards each bar moves it by 1 / period of the difference.
+//
+class WilderAverage
+{
+public:
+	explicit WilderAverage(unsigned int period) :
+		period_(checkPeriod(period))
+	{
+	}
+
+	double update(double sample, bool newBar)
+	{
+		auto& average = state_.begin(newBar);
+		auto divisor = (std::min)(state_.bars(), static_cast<unsigned long long>(period_));
+		average += (sample - average) / divisor;
+		return average;
+	}
+
+	double value() const
+	{
+		return state_.current();
+	}
+
+private:
+	const unsigned int period_;
+	BarState<double> state_;
+};
+
+//
+// Relative strength index of the changes from bar to bar, with the ups and downs smoothed with
+// Wilder's smoothing. The first sample has nothing to compare with and counts as no change.
+//
+class RelativeStrength
+{
+public:
+	explicit RelativeStrength(unsigned int period) :
+		up_(period),
+		down_(period)
+	{
+	}
+
+	double update(double sample, bool newBar)
+	{
+		// the change of the latest bar is always taken against the sample of the previous bar,
+		// however many times the latest bar is replaced
+		auto& previous = previous_.begin(newBar);
+		auto change = previous_.bars() > 1 ? sample - previous : 0;
+		previous = sample;
+
+		auto up = up_.update(change > 0 ? change : 0, newBar);
+		auto down = down_.update(change < 0 ? -change : 0, newBar);
+
+		// 100 - 100 / (1 + up / down), which is 50 when nothing has moved yet
+		return up + down > 0 ? 100 * up / (up + down) : 50;
+	}
+
+private:
+	BarState<double> previous_;
+	WilderAverage up_;
+	WilderAverage down_;
+};
+
+//
+// Last period samples and their sum. Until period samples have been added the window holds the
+// samples so far.
+//
+// The window kernels take the buffer holding the samples as a parameter. RollingWindow,
+// RollingMoments and RollingRegression use a RingBuffer sized at run time, the stages of
+// IndicatorPipeline.h a FixedRingBuffer sized at compile time. Both run the same arithmetic.
+//
+template<typename Buffer>
+class BasicRollingWindow
+{
+public:
+	explicit BasicRollingWindow(unsigned int period) :
+		window_(checkPeriod(period)),
+		sum_(0),
+		updatesSinceResum_(0)
+	{
+	}
+
+	void update(double sample, bool newBar)
+	{
+		if (newBar || window_.empty())
+		{
+			double oldest;
+			sum_ += sample;
+			if (window_.push(sample, oldest))
+			{
+				sum_ -= oldest;
+			}
+		}
+		else
+		{
+			auto& newest = window_.newest();
+			sum_ += sample - newest;
+			newest = sample;
+		}
+
+		// the running sum drifts as samples are added and removed. it is recomputed
+		// every period updates, which keeps the amortized cost O(1)
+		if (++updatesSinceResum_ >= window_.capacity())
+		{
+			updatesSinceResum_ = 0;
+			sum_ = 0;
+			for (size_t i = 0; i < window_.size(); ++i)
+			{
+				sum_ += window_[i];
+			}
+		}
+	}
+
+	double sum() const
+	{
+		return sum_;
+	}
+
+	double mean() const
+	{
+		return sum_ / window_.size();
+	}
+
+	// sample k bars before the latest one. 0 is the latest sample
+	double ago(size_t k) const
+	{
+		return window_[window_.size() - 1 - k];
+	}
+
+	double oldest() const
+	{
+		return window_[0];
+	}
+
+	size_t size() const
+	{
+		return window_.size();
+	}
+
+private:
+	Buffer window_;
+	double sum_;
+	size_t updatesSinceResum_;
+};
+
+using RollingWindow = BasicRollingWindow<RingBuffer<double>>;
+
+//
+// Mean absolute deviation of the last period samples from their mean. This is the one kernel which
+// is O(period) per update, not O(1), and it stays that way on purpose. Every sample is measured
+// against the mean of the current window, so whenever the mean moves any term can change sign and
+// there is no running sum to keep. Exact alternatives need an order statistics tree, which is
+// O(log period) at best and slower than a loop over a few dozen contiguous samples for the
+// periods these indicators use.
+//
+class RollingMeanDeviation
+{
+public:
+	explicit RollingMeanDeviation(unsigned int period) :
+		window_(period)
+	{
+	}
+
+	void update(double sample, bool newBar)
+	{
+		window_.update(sample, newBar);
+	}
+
+	double mean() const
+	{
+		return window_.mean();
+	}
+
+	double meanDeviation() const
+	{
+		const auto mean = window_.mean();
+		double deviation = 0;
+		for (size_t i = 0; i < window_.size(); ++i)
+		{
+			deviation += std::fabs(window_.ago(i) - mean);
+		}
+		return deviation / window_.size();
+	}
+
+private:
+	RollingWindow window_;
+};
+
+//
+// Mean and population variance of the last period samples. Same running sums as BollingerBands.
+//
+template<typename Buffer>
+class BasicRollingMoments
+{
+public:
+	explicit BasicRollingMoments(unsigned int period) :
+		window_(checkPeriod(period)),
+		mean_(0),
+		m2_(0),
+		updatesSinceRecenter_(0)
+	{
+	}
+
+	void update(double sample, bool newBar)
+	{
+		if (newBar || window_.empty())
+		{
+			double oldest;
+			if (window_.push(sample, oldest))
+			{
+				replace(oldest, sample);
+			}
+			else
+			{
+				auto delta = sample - mean_;
+				mean_ += delta / window_.size();
+				m2_ += delta * (sample - mean_);
+			}
+		}
+		else
+		{
+			auto& newest = window_.newest();
+			replace(newest, sample);
+			newest = sample;
+		}
+
+		if (++updatesSinceRecenter_ >= window_.capacity())
+		{
+			recenter();
+		}
+	}
+
+	double mean() const
+	{
+		return mean_;
+	}
+
+	double variance() const
+	{
+		// m2_ can dip slightly below 0 from rounding when the window is flat
+		return m2_ > 0 ? m2_ / window_.size() : 0;
+	}
+
+	double standardDeviation() const
+	{
+		return std::sqrt(variance());
+	}
+
+	size_t size() const
+	{
+		return window_.size();
+	}
+
+private:
+	Buffer window_;
+	double mean_;
+	double m2_;
+	size_t updatesSinceRecenter_;
+
+	void replace(double oldSample, double newSample)
+	{
+		auto oldMean = mean_;
+		mean_ += (newSample - oldSample) / window_.size();
+		m2_ += (newSample - oldSample) * (newSample - mean_ + oldSample - oldMean);
+	}
+
+	void recenter()
+	{
+		updatesSinceRecenter_ = 0;
+
+		double sum = 0;
+		for (size_t i = 0; i < window_.size(); ++i)
+		{
+			sum += window_[i];
+		}
+		mean_ = sum / window_.size();
+
+		m2_ = 0;
+		for (size_t i = 0; i < window_.size(); ++i)
+		{
+			auto delta = window_[i] - mean_;
+			m2_ += delta * delta;
+		}
+	}
+};
+
+using RollingMoments = BasicRollingMoments<RingBuffer<double>>;
+
+//
+// Least squares line through the last period samples, with the oldest sample at x = 1 and the latest
+// at x = size(). Keeps the sum of the samples and the sum weighted by x, which is also what the
+// weighted moving average needs.
+//
+template<typename Buffer>
+class BasicRollingRegression
+{
+public:
+	explicit BasicRollingRegression(unsigned int period) :
+		window_(checkPeriod(period)),
+		sum_(0),
+		weightedSum_(0),
+		updatesSinceResum_(0)
+	{
+	}
+
+	void update(double sample, bool newBar)
+	{
+		if (newBar || window_.empty())
+		{
+			double oldest;
+			if (window_.push(sample, oldest))
+			{
+				// every sample moves down by one weight and the oldest falls out
+				weightedSum_ += window_.size() * sample - sum_;
+				sum_ += sample - oldest;
+			}
+			else
+			{
+				weightedSum_ += window_.size() * sample;
+				sum_ += sample;
+			}
+		}
+		else
+		{
+			auto& newest = window_.newest();
+			weightedSum_ += window_.size() * (sample - newest);
+			sum_ += sample - newest;
+			newest = sample;
+		}
+
+		if (++updatesSinceResum_ >= window_.capacity())
+		{
+			updatesSinceResum_ = 0;
+			sum_ = 0;
+			weightedSum_ = 0;
+			for (size_t i = 0; i < window_.size(); ++i)
+			{
+				sum_ += window_[i];
+				weightedSum_ += (i + 1) * window_[i];
+			}
+		}
+	}
+
+	double weightedMean() const
+	{
+		double n = static_cast<double>(window_.size());
+		return weightedSum_ / (n * (n + 1) / 2);
+	}
+
+	double slope() const
+	{
+		double n = static_cast<double>(window_.size());
+		if (n < 2)
+		{
+			return 0;
+		}
+		double sumX = n * (n + 1) / 2;
+		double sumXX = n * (n + 1) * (2 * n + 1) / 6;
+		return (n * weightedSum_ - sumX * sum_) / (n * sumXX - sumX * sumX);
+	}
+
+	// value of the line at x = 0
+	double intercept() const
+	{
+		double n = static_cast<double>(window_.size());
+		return (sum_ - slope() * n * (n + 1) / 2) / n;
+	}
+
+	// value of the line offset bars after the latest sample. 0 is the latest sample
+	double valueAt(double offset) const
+	{
+		return intercept() + slope() * (window_.size() + offset);
+	}
+
+	size_t size() const
+	{
+		return window_.size();
+	}
+
+private:
+	Buffer window_;
+	double sum_;
+	double weightedSum_;
+	size_t updatesSinceResum_;
+};
+
+using RollingRegression = BasicRollingRegression<RingBuffer<double>>;
+
+//
+// Greatest of the high - low range of the bar and the gaps from the previous close
+//
+inline double trueRange(const SamplePoint& sample, bool hasPreviousClose, double previousClose)
+{
+	if (!hasPreviousClose)
+	{
+		return sample.high - sample.low;
+	}
+	return (std::max)({ sample.high - sample.low, std::fabs(sample.high - previousClose), std::fabs(sample.low - previousClose) });
+}
+
+//
+// Wilder's directional movement system. The directional movements and the true range are smoothed
+// with Wilder's smoothing.
+//
+class DirectionalSystem
+{
+public:
+	explicit DirectionalSystem(unsigned int period) :
+		plusMovement_(period),
+		minusMovement_(period),
+		trueRange_(period)
+	{
+	}
+
+	void update(const SamplePoint& sample, bool newBar)
+	{
+		auto& bar = bar_.begin(newBar);
+		double plusMove = 0;
+		double minusMove = 0;
+		double range = sample.high - sample.low;
+		if (bar_.bars() > 1)
+		{
+			// bar holds the previous bar until it is replaced below
+			auto up = sample.high - bar.high;
+			auto down = bar.low - sample.low;
+			plusMove = up > down && up > 0 ? up : 0;
+			minusMove = down > up && down > 0 ? down : 0;
+			range = trueRange(sample, true, bar.close);
+		}
+		bar = sample;
+
+		plusMovement_.update(plusMove, newBar);
+		minusMovement_.update(minusMove, newBar);
+		trueRange_.update(range, newBar);
+	}
+
+	double plusMovement() const
+	{
+		return plusMovement_.value();
+	}
+
+	double minusMovement() const
+	{
+		return minusMovement_.value();
+	}
+
+	double averageTrueRange() const
+	{
+		return trueRange_.value();
+	}
+
+	double plusIndicator() const
+	{
+		return trueRange_.value() > 0 ? 100 * plusMovement_.value() / trueRange_.value() : 0;
+	}
+
+	double minusIndicator() const
+	{
+		return trueRange_.value() > 0 ? 100 * minusMovement_.value() / trueRange_.value() : 0;
+	}
+
+	double movementIndex() const
+	{
+		auto total = plusIndicator() + minusIndicator();
+		return total > 0 ? 100 * std::fabs(plusIndicator() - minusIndicator()) / total : 0;
+	}
+
+private:
+	BarState<SamplePoint> bar_;
+	WilderAverage plusMovement_;
+	WilderAverage minusMovement_;
+	WilderAverage trueRange_;
+};
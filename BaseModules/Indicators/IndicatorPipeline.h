@@ -0,0 +1,304 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include "IndicatorKernels.h"
+#include "RingBuffer.h"
+
+//
+// Indicators composed at compile time for the strategies, e.g.
+//
+//     auto slope = Pipeline::Sma<5>() | Pipeline::Diff() | Pipeline::Sma<5>();
+//     auto value = slope(candle.close);
+//
+// Each stage keeps its state inline, windows included, so a pipeline is one object without any
+// allocation and an update is a chain of inlined calls the compiler can optimize as a whole. The
+// stages run the kernels of IndicatorKernels.h, which the DLL indicators wrap for the GUI, so a
+// stage gives the same values as the indicator of the same name.
+//
+// Every stage follows the contract of Indicators.h. update(sample, newBar) begins a new bar if newBar
+// is true and replaces the latest bar otherwise. operator() begins a new bar.
+//
+namespace Pipeline
+{
+	//
+	// base of every stage. only stages compose with operator|
+	//
+	template<typename Derived>
+	class Stage
+	{
+	public:
+		double operator()(double sample)
+		{
+			return static_cast<Derived&>(*this).update(sample, true);
+		}
+	};
+
+	template<typename First, typename Second>
+	class Chain : public Stage<Chain<First, Second>>
+	{
+	public:
+		Chain(First first, Second second) :
+			first_(std::move(first)),
+			second_(std::move(second))
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			return second_.update(first_.update(sample, newBar), newBar);
+		}
+
+	private:
+		First first_;
+		Second second_;
+	};
+
+	template<typename First, typename Second>
+	Chain<First, Second> operator|(Stage<First>&& first, Stage<Second>&& second)
+	{
+		return Chain<First, Second>(std::move(static_cast<First&>(first)), std::move(static_cast<Second&>(second)));
+	}
+
+	template<typename First, typename Second>
+	Chain<First, Second> operator|(const Stage<First>& first, const Stage<Second>& second)
+	{
+		return Chain<First, Second>(static_cast<const First&>(first), static_cast<const Second&>(second));
+	}
+
+	template<unsigned int Period>
+	using Window = BasicRollingWindow<FixedRingBuffer<double, Period>>;
+
+	//
+	// same as SimpleMovingAverage
+	//
+	template<unsigned int Period>
+	class Sma : public Stage<Sma<Period>>
+	{
+	public:
+		Sma() :
+			window_(Period)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			window_.update(sample, newBar);
+			return window_.mean();
+		}
+
+	private:
+		Window<Period> window_;
+	};
+
+	//
+	// same as SumOverPeriod
+	//
+	template<unsigned int Period>
+	class Sum : public Stage<Sum<Period>>
+	{
+	public:
+		Sum() :
+			window_(Period)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			window_.update(sample, newBar);
+			return window_.sum();
+		}
+
+	private:
+		Window<Period> window_;
+	};
+
+	//
+	// same as WeightedMovingAverage
+	//
+	template<unsigned int Period>
+	class Wma : public Stage<Wma<Period>>
+	{
+	public:
+		Wma() :
+			regression_(Period)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			regression_.update(sample, newBar);
+			return regression_.weightedMean();
+		}
+
+	private:
+		BasicRollingRegression<FixedRingBuffer<double, Period>> regression_;
+	};
+
+	//
+	// same as ExponentialMovingAverage
+	//
+	template<unsigned int Period>
+	class Ema : public Stage<Ema<Period>>
+	{
+	public:
+		Ema() :
+			ema_(emaAlpha(Period))
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			return ema_.update(sample, newBar);
+		}
+
+	private:
+		::Ema ema_;
+	};
+
+	//
+	// same as WildersSmoothing
+	//
+	template<unsigned int Period>
+	class Wilders : public Stage<Wilders<Period>>
+	{
+	public:
+		Wilders() :
+			average_(Period)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			return average_.update(sample, newBar);
+		}
+
+	private:
+		WilderAverage average_;
+	};
+
+	//
+	// same as RelativeStrengthIndex
+	//
+	template<unsigned int Period>
+	class Rsi : public Stage<Rsi<Period>>
+	{
+	public:
+		Rsi() :
+			strength_(Period)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			return strength_.update(sample, newBar);
+		}
+
+	private:
+		RelativeStrength strength_;
+	};
+
+	//
+	// same as Variance and StandardDeviation
+	//
+	template<unsigned int Period>
+	class Variance : public Stage<Variance<Period>>
+	{
+	public:
+		Variance() :
+			moments_(Period)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			moments_.update(sample, newBar);
+			return moments_.variance();
+		}
+
+	private:
+		BasicRollingMoments<FixedRingBuffer<double, Period>> moments_;
+	};
+
+	template<unsigned int Period>
+	class StdDev : public Stage<StdDev<Period>>
+	{
+	public:
+		StdDev() :
+			moments_(Period)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			moments_.update(sample, newBar);
+			return moments_.standardDeviation();
+		}
+
+	private:
+		BasicRollingMoments<FixedRingBuffer<double, Period>> moments_;
+	};
+
+	//
+	// same as Lag. the sample Period bars ago, or the oldest sample until there are that many
+	//
+	template<unsigned int Period>
+	class Lag : public Stage<Lag<Period>>
+	{
+	public:
+		Lag() :
+			window_(Period + 1)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			window_.update(sample, newBar);
+			return window_.oldest();
+		}
+
+	private:
+		Window<Period + 1> window_;
+	};
+
+	//
+	// same as Momentum. the change over Period bars, or since the oldest sample until there are
+	// that many
+	//
+	template<unsigned int Period>
+	class Momentum : public Stage<Momentum<Period>>
+	{
+	public:
+		Momentum() :
+			window_(Period + 1)
+		{
+		}
+
+		double update(double sample, bool newBar)
+		{
+			window_.update(sample, newBar);
+			return sample - window_.oldest();
+		}
+
+	private:
+		Window<Period + 1> window_;
+	};
+
+	//
+	// change from the previous bar, 0 for the first one
+	//
+	class Diff : public Stage<Diff>
+	{
+	public:
+		double update(double sample, bool newBar)
+		{
+			auto& previous = previous_.begin(newBar);
+			auto change = previous_.bars() > 1 ? sample - previous : 0;
+			previous = sample;
+			return change;
+		}
+
+	private:
+		BarState<double> previous_;
+	};
+}
@@ -11,6 +11,67 @@
 //
 
 #include <array>
+#include <cstddef>
+
+//
+// Input for the indicators which need more than a single value from each candle, such as the
+// high and low of the period.
+//
+struct SamplePoint
+{
+	double open;
+	double high;
+	double low;
+	double close;
+	double volume;
+};
+
+//
+// Every indicator is updated one bar at a time. computeIndicatorPoint commits the latest bar and begins
+// a new one with the sample. recomputeIndicatorPoint replaces the sample of the latest bar, which is
+// how an in-progress candle is followed tick by tick. Each indicator keeps its state as of the close of
+// the previous bar apart from the provisional state of the latest bar, so recomputing is O(1) and can be
+// repeated any number of times.
+//
+// Because of this, indicators compose. An indicator fed with the output of another stays correct as long
+// as both are computed or recomputed together, see updateIndicator.
+//
+template<typename Indicator, typename Sample>
+typename Indicator::array_type updateIndicator(Indicator& indicator, const Sample& sample, bool newBar)
+{
+	return newBar ? indicator.computeIndicatorPoint(sample) : indicator.recomputeIndicatorPoint(sample);
+}
+
+//
+// Past bars are computed at once with computeIndicatorPoints(samples, count, points), which is the same
+// as calling computeIndicatorPoint with each sample in turn. It gives the same points and leaves the
+// indicator in the same state, so streaming carries on from the last of them, but runs the whole span
+// inside the library instead of crossing into it for every bar.
+//
+template<typename Indicator, typename Sample>
+auto computeIndicatorPoints(Indicator& indicator, const Sample* samples, size_t count, typename Indicator::array_type* points, int)
+	-> decltype(indicator.computeIndicatorPoints(samples, count, points))
+{
+	return indicator.computeIndicatorPoints(samples, count, points);
+}
+
+template<typename Indicator, typename Sample>
+void computeIndicatorPoints(Indicator& indicator, const Sample* samples, size_t count, typename Indicator::array_type* points, long)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = indicator.computeIndicatorPoint(samples[i]);
+	}
+}
+
+//
+// computes the past bars with the indicator's own computeIndicatorPoints if it has one
+//
+template<typename Indicator, typename Sample>
+void computeIndicatorPoints(Indicator& indicator, const Sample* samples, size_t count, typename Indicator::array_type* points)
+{
+	computeIndicatorPoints(indicator, samples, count, points, 0);
+}
 
 #ifdef INDICATORS_EXPORTS
 #define INDICATORSDLL __declspec(dllexport)
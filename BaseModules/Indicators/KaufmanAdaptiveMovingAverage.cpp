@@ -0,0 +1,72 @@
+#include "KaufmanAdaptiveMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class KaufmanAdaptiveMovingAverage::KaufmanAdaptiveMovingAverageImpl
+{
+public:
+	KaufmanAdaptiveMovingAverageImpl(unsigned int period);
+	~KaufmanAdaptiveMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	// period changes need period + 1 prices
+	RollingWindow prices_;
+	RollingWindow changes_;
+	Ema kama_;
+};
+
+KaufmanAdaptiveMovingAverage::KaufmanAdaptiveMovingAverage(unsigned int period) :
+	impl_(new KaufmanAdaptiveMovingAverageImpl(period))
+{
+}
+
+KaufmanAdaptiveMovingAverage::~KaufmanAdaptiveMovingAverage()
+{
+	delete impl_;
+}
+
+KaufmanAdaptiveMovingAverage::array_type KaufmanAdaptiveMovingAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+KaufmanAdaptiveMovingAverage::array_type KaufmanAdaptiveMovingAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void KaufmanAdaptiveMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+KaufmanAdaptiveMovingAverage::KaufmanAdaptiveMovingAverageImpl::KaufmanAdaptiveMovingAverageImpl(unsigned int period) :
+	prices_(checkPeriod(period) + 1),
+	changes_(period),
+	kama_(0)
+{
+}
+
+KaufmanAdaptiveMovingAverage::KaufmanAdaptiveMovingAverageImpl::~KaufmanAdaptiveMovingAverageImpl()
+{
+}
+
+KaufmanAdaptiveMovingAverage::array_type KaufmanAdaptiveMovingAverage::KaufmanAdaptiveMovingAverageImpl::update(const double sample, bool newBar)
+{
+	prices_.update(sample, newBar);
+	changes_.update(prices_.size() > 1 ? std::fabs(sample - prices_.ago(1)) : 0, newBar);
+
+	auto volatility = changes_.sum();
+	auto efficiency = volatility > 0 ? std::fabs(sample - prices_.oldest()) / volatility : 0;
+
+	const double fastest = emaAlpha(2);
+	const double slowest = emaAlpha(30);
+	auto smoothing = efficiency * (fastest - slowest) + slowest;
+	return array_type{ kama_.update(sample, smoothing * smoothing, newBar) };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Kaufman adaptive moving average. The smoothing goes from the ema of 2 to the ema of 30 samples
+// with the efficiency ratio of the net change over the sum of the changes of the last period samples
+//
+class INDICATORSDLL KaufmanAdaptiveMovingAverage
+{
+public:
+	KaufmanAdaptiveMovingAverage(unsigned int period);
+	~KaufmanAdaptiveMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		KAUFMAN_ADAPTIVE_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class KaufmanAdaptiveMovingAverageImpl;
+	KaufmanAdaptiveMovingAverageImpl* impl_;
+};
@@ -0,0 +1,95 @@
+#include "KlingerVolumeOscillator.h"
+#include "IndicatorKernels.h"
+
+class KlingerVolumeOscillator::KlingerVolumeOscillatorImpl
+{
+public:
+	KlingerVolumeOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod);
+	~KlingerVolumeOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	struct Force
+	{
+		double sum;
+		double range;
+		double cumulativeRange;
+		int trend;
+	};
+
+	BarState<Force> state_;
+	Ema short_;
+	Ema long_;
+};
+
+KlingerVolumeOscillator::KlingerVolumeOscillator(unsigned int shortPeriod, unsigned int longPeriod) :
+	impl_(new KlingerVolumeOscillatorImpl(shortPeriod, longPeriod))
+{
+}
+
+KlingerVolumeOscillator::~KlingerVolumeOscillator()
+{
+	delete impl_;
+}
+
+KlingerVolumeOscillator::array_type KlingerVolumeOscillator::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+KlingerVolumeOscillator::array_type KlingerVolumeOscillator::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void KlingerVolumeOscillator::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+KlingerVolumeOscillator::KlingerVolumeOscillatorImpl::KlingerVolumeOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod) :
+	short_(emaAlpha(shortPeriod)),
+	long_(emaAlpha(longPeriod))
+{
+}
+
+KlingerVolumeOscillator::KlingerVolumeOscillatorImpl::~KlingerVolumeOscillatorImpl()
+{
+}
+
+KlingerVolumeOscillator::array_type KlingerVolumeOscillator::KlingerVolumeOscillatorImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& force = state_.begin(newBar);
+	auto sum = sample.high + sample.low + sample.close;
+	auto range = sample.high - sample.low;
+	if (state_.bars() == 1)
+	{
+		force.sum = sum;
+		force.range = range;
+		return array_type{ 0 };
+	}
+
+	// the cumulative range restarts from the range of the previous candle when the trend turns
+	if (sum > force.sum && force.trend != 1)
+	{
+		force.trend = 1;
+		force.cumulativeRange = force.range;
+	}
+	else if (sum < force.sum && force.trend != -1)
+	{
+		force.trend = -1;
+		force.cumulativeRange = force.range;
+	}
+	force.cumulativeRange += range;
+	force.sum = sum;
+	force.range = range;
+
+	auto volumeForce = force.cumulativeRange != 0 ? 100 * sample.volume * force.trend * std::fabs(2 * range / force.cumulativeRange - 1) : 0;
+	return array_type{ short_.update(volumeForce, newBar) - long_.update(volumeForce, newBar) };
+}
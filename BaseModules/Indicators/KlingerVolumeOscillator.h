@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Short ema minus long ema of the volume force, the volume signed by the trend of high + low + close
+// and scaled by how much of the cumulative range of the trend the candle covers
+//
+class INDICATORSDLL KlingerVolumeOscillator
+{
+public:
+	KlingerVolumeOscillator(unsigned int shortPeriod, unsigned int longPeriod);
+	~KlingerVolumeOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		KLINGER_VOLUME_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class KlingerVolumeOscillatorImpl;
+	KlingerVolumeOscillatorImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "Lag.h"
+#include "IndicatorKernels.h"
+
+class Lag::LagImpl
+{
+public:
+	LagImpl(unsigned int period);
+	~LagImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow window_;
+};
+
+Lag::Lag(unsigned int period) :
+	impl_(new LagImpl(period))
+{
+}
+
+Lag::~Lag()
+{
+	delete impl_;
+}
+
+Lag::array_type Lag::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+Lag::array_type Lag::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Lag::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Lag::LagImpl::LagImpl(unsigned int period) :
+	window_(checkPeriod(period) + 1)
+{
+}
+
+Lag::LagImpl::~LagImpl()
+{
+}
+
+Lag::array_type Lag::LagImpl::update(const double sample, bool newBar)
+{
+	window_.update(sample, newBar);
+	return array_type{ window_.oldest() };
+}
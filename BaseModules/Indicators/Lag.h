@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Sample period bars before the latest one. The oldest sample until period bars have been added
+//
+class INDICATORSDLL Lag
+{
+public:
+	Lag(unsigned int period);
+	~Lag();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		LAG,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class LagImpl;
+	LagImpl* impl_;
+};
@@ -0,0 +1,61 @@
+#include "LinearDecay.h"
+#include "IndicatorKernels.h"
+
+class LinearDecay::LinearDecayImpl
+{
+public:
+	LinearDecayImpl(unsigned int period);
+	~LinearDecayImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	const unsigned int period_;
+	BarState<double> decay_;
+};
+
+LinearDecay::LinearDecay(unsigned int period) :
+	impl_(new LinearDecayImpl(period))
+{
+}
+
+LinearDecay::~LinearDecay()
+{
+	delete impl_;
+}
+
+LinearDecay::array_type LinearDecay::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+LinearDecay::array_type LinearDecay::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void LinearDecay::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+LinearDecay::LinearDecayImpl::LinearDecayImpl(unsigned int period) :
+	period_(checkPeriod(period))
+{
+}
+
+LinearDecay::LinearDecayImpl::~LinearDecayImpl()
+{
+}
+
+LinearDecay::array_type LinearDecay::LinearDecayImpl::update(const double sample, bool newBar)
+{
+	auto& decay = decay_.begin(newBar);
+	decay = decay_.bars() == 1 ? sample : (std::max)(sample, decay - 1.0 / period_);
+	return array_type{ decay };
+}
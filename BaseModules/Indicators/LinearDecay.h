@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// The sample, or the previous value less 1 / period if that is greater
+//
+class INDICATORSDLL LinearDecay
+{
+public:
+	LinearDecay(unsigned int period);
+	~LinearDecay();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		LINEAR_DECAY,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class LinearDecayImpl;
+	LinearDecayImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "LinearRegression.h"
+#include "IndicatorKernels.h"
+
+class LinearRegression::LinearRegressionImpl
+{
+public:
+	LinearRegressionImpl(unsigned int period);
+	~LinearRegressionImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingRegression regression_;
+};
+
+LinearRegression::LinearRegression(unsigned int period) :
+	impl_(new LinearRegressionImpl(period))
+{
+}
+
+LinearRegression::~LinearRegression()
+{
+	delete impl_;
+}
+
+LinearRegression::array_type LinearRegression::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+LinearRegression::array_type LinearRegression::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void LinearRegression::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+LinearRegression::LinearRegressionImpl::LinearRegressionImpl(unsigned int period) :
+	regression_(period)
+{
+}
+
+LinearRegression::LinearRegressionImpl::~LinearRegressionImpl()
+{
+}
+
+LinearRegression::array_type LinearRegression::LinearRegressionImpl::update(const double sample, bool newBar)
+{
+	regression_.update(sample, newBar);
+	return array_type{ regression_.valueAt(0) };
+}
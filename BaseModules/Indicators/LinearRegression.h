@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Value of the least squares line through the last period samples at the latest sample
+//
+class INDICATORSDLL LinearRegression
+{
+public:
+	LinearRegression(unsigned int period);
+	~LinearRegression();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		LINEAR_REGRESSION,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class LinearRegressionImpl;
+	LinearRegressionImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "LinearRegressionIntercept.h"
+#include "IndicatorKernels.h"
+
+class LinearRegressionIntercept::LinearRegressionInterceptImpl
+{
+public:
+	LinearRegressionInterceptImpl(unsigned int period);
+	~LinearRegressionInterceptImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingRegression regression_;
+};
+
+LinearRegressionIntercept::LinearRegressionIntercept(unsigned int period) :
+	impl_(new LinearRegressionInterceptImpl(period))
+{
+}
+
+LinearRegressionIntercept::~LinearRegressionIntercept()
+{
+	delete impl_;
+}
+
+LinearRegressionIntercept::array_type LinearRegressionIntercept::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+LinearRegressionIntercept::array_type LinearRegressionIntercept::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void LinearRegressionIntercept::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+LinearRegressionIntercept::LinearRegressionInterceptImpl::LinearRegressionInterceptImpl(unsigned int period) :
+	regression_(period)
+{
+}
+
+LinearRegressionIntercept::LinearRegressionInterceptImpl::~LinearRegressionInterceptImpl()
+{
+}
+
+LinearRegressionIntercept::array_type LinearRegressionIntercept::LinearRegressionInterceptImpl::update(const double sample, bool newBar)
+{
+	regression_.update(sample, newBar);
+	return array_type{ regression_.intercept() };
+}
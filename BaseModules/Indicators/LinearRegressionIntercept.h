@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Intercept of the least squares line through the last period samples, with the oldest sample
+// at x = 1
+//
+class INDICATORSDLL LinearRegressionIntercept
+{
+public:
+	LinearRegressionIntercept(unsigned int period);
+	~LinearRegressionIntercept();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		LINEAR_REGRESSION_INTERCEPT,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class LinearRegressionInterceptImpl;
+	LinearRegressionInterceptImpl* impl_;
+};
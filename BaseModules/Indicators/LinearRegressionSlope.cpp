@@ -0,0 +1,59 @@
+#include "LinearRegressionSlope.h"
+#include "IndicatorKernels.h"
+
+class LinearRegressionSlope::LinearRegressionSlopeImpl
+{
+public:
+	LinearRegressionSlopeImpl(unsigned int period);
+	~LinearRegressionSlopeImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingRegression regression_;
+};
+
+LinearRegressionSlope::LinearRegressionSlope(unsigned int period) :
+	impl_(new LinearRegressionSlopeImpl(period))
+{
+}
+
+LinearRegressionSlope::~LinearRegressionSlope()
+{
+	delete impl_;
+}
+
+LinearRegressionSlope::array_type LinearRegressionSlope::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+LinearRegressionSlope::array_type LinearRegressionSlope::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void LinearRegressionSlope::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+LinearRegressionSlope::LinearRegressionSlopeImpl::LinearRegressionSlopeImpl(unsigned int period) :
+	regression_(period)
+{
+}
+
+LinearRegressionSlope::LinearRegressionSlopeImpl::~LinearRegressionSlopeImpl()
+{
+}
+
+LinearRegressionSlope::array_type LinearRegressionSlope::LinearRegressionSlopeImpl::update(const double sample, bool newBar)
+{
+	regression_.update(sample, newBar);
+	return array_type{ regression_.slope() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Slope of the least squares line through the last period samples
+//
+class INDICATORSDLL LinearRegressionSlope
+{
+public:
+	LinearRegressionSlope(unsigned int period);
+	~LinearRegressionSlope();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		LINEAR_REGRESSION_SLOPE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class LinearRegressionSlopeImpl;
+	LinearRegressionSlopeImpl* impl_;
+};
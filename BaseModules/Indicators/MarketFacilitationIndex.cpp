@@ -0,0 +1,55 @@
+#include "MarketFacilitationIndex.h"
+
+class MarketFacilitationIndex::MarketFacilitationIndexImpl
+{
+public:
+	MarketFacilitationIndexImpl();
+	~MarketFacilitationIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+};
+
+MarketFacilitationIndex::MarketFacilitationIndex() :
+	impl_(new MarketFacilitationIndexImpl())
+{
+}
+
+MarketFacilitationIndex::~MarketFacilitationIndex()
+{
+	delete impl_;
+}
+
+MarketFacilitationIndex::array_type MarketFacilitationIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+MarketFacilitationIndex::array_type MarketFacilitationIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MarketFacilitationIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MarketFacilitationIndex::MarketFacilitationIndexImpl::MarketFacilitationIndexImpl()
+{
+}
+
+MarketFacilitationIndex::MarketFacilitationIndexImpl::~MarketFacilitationIndexImpl()
+{
+}
+
+MarketFacilitationIndex::array_type MarketFacilitationIndex::MarketFacilitationIndexImpl::update(const SamplePoint& sample, bool)
+{
+	return array_type{ sample.volume > 0 ? (sample.high - sample.low) / sample.volume : 0 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Range of the candle per unit of volume
+//
+class INDICATORSDLL MarketFacilitationIndex
+{
+public:
+	MarketFacilitationIndex();
+	~MarketFacilitationIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MARKET_FACILITATION_INDEX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class MarketFacilitationIndexImpl;
+	MarketFacilitationIndexImpl* impl_;
+};
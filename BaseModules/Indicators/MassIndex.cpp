@@ -0,0 +1,65 @@
+#include "MassIndex.h"
+#include "IndicatorKernels.h"
+
+class MassIndex::MassIndexImpl
+{
+public:
+	MassIndexImpl(unsigned int period);
+	~MassIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	Ema ema_;
+	Ema emaOfEma_;
+	RollingWindow ratios_;
+};
+
+MassIndex::MassIndex(unsigned int period) :
+	impl_(new MassIndexImpl(period))
+{
+}
+
+MassIndex::~MassIndex()
+{
+	delete impl_;
+}
+
+MassIndex::array_type MassIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+MassIndex::array_type MassIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MassIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MassIndex::MassIndexImpl::MassIndexImpl(unsigned int period) :
+	ema_(emaAlpha(9)),
+	emaOfEma_(emaAlpha(9)),
+	ratios_(period)
+{
+}
+
+MassIndex::MassIndexImpl::~MassIndexImpl()
+{
+}
+
+MassIndex::array_type MassIndex::MassIndexImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto ema = ema_.update(sample.high - sample.low, newBar);
+	auto emaOfEma = emaOfEma_.update(ema, newBar);
+	ratios_.update(emaOfEma != 0 ? ema / emaOfEma : 0, newBar);
+	return array_type{ ratios_.sum() };
+}
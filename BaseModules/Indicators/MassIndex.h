@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Sum over the last period candles of the 9 bar ema of the range over its own 9 bar ema
+//
+class INDICATORSDLL MassIndex
+{
+public:
+	MassIndex(unsigned int period);
+	~MassIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MASS_INDEX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class MassIndexImpl;
+	MassIndexImpl* impl_;
+};
@@ -0,0 +1,60 @@
+#include "MathOperator.h"
+
+class MathOperator::MathOperatorImpl
+{
+public:
+	MathOperatorImpl(Operator op);
+	~MathOperatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double first, const double second, bool newBar);
+private:
+	const Operator operator_;
+};
+
+MathOperator::MathOperator(Operator op) :
+	impl_(new MathOperatorImpl(op))
+{
+}
+
+MathOperator::~MathOperator()
+{
+	delete impl_;
+}
+
+MathOperator::array_type MathOperator::computeIndicatorPoint(const double first, const double second)
+{
+	return impl_->update(first, second, true);
+}
+
+MathOperator::array_type MathOperator::recomputeIndicatorPoint(const double first, const double second)
+{
+	return impl_->update(first, second, false);
+}
+
+MathOperator::MathOperatorImpl::MathOperatorImpl(Operator op) :
+	operator_(op)
+{
+}
+
+MathOperator::MathOperatorImpl::~MathOperatorImpl()
+{
+}
+
+MathOperator::array_type MathOperator::MathOperatorImpl::update(const double first, const double second, bool)
+{
+	switch (operator_)
+	{
+	case Operator::ADDITION:
+		return array_type{ first + second };
+	case Operator::SUBTRACTION:
+		return array_type{ first - second };
+	case Operator::MULTIPLICATION:
+		return array_type{ first * second };
+	case Operator::DIVISION:
+	default:
+		return array_type{ second != 0 ? first / second : 0 };
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Applies an arithmetic operator to two samples. Division by 0 gives 0
+//
+class INDICATORSDLL MathOperator
+{
+public:
+	enum class Operator
+	{
+		ADDITION,
+		SUBTRACTION,
+		MULTIPLICATION,
+		DIVISION
+	};
+
+	MathOperator(Operator op);
+	~MathOperator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VALUE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double first, const double second);
+	array_type recomputeIndicatorPoint(const double first, const double second);
+
+private:
+	class MathOperatorImpl;
+	MathOperatorImpl* impl_;
+};
@@ -0,0 +1,101 @@
+#include <cmath>
+#include "MathTransform.h"
+
+class MathTransform::MathTransformImpl
+{
+public:
+	MathTransformImpl(Function function);
+	~MathTransformImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	const Function function_;
+};
+
+MathTransform::MathTransform(Function function) :
+	impl_(new MathTransformImpl(function))
+{
+}
+
+MathTransform::~MathTransform()
+{
+	delete impl_;
+}
+
+MathTransform::array_type MathTransform::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+MathTransform::array_type MathTransform::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MathTransform::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MathTransform::MathTransformImpl::MathTransformImpl(Function function) :
+	function_(function)
+{
+}
+
+MathTransform::MathTransformImpl::~MathTransformImpl()
+{
+}
+
+MathTransform::array_type MathTransform::MathTransformImpl::update(const double sample, bool)
+{
+	switch (function_)
+	{
+	case Function::ABSOLUTE_VALUE:
+		return array_type{ std::fabs(sample) };
+	case Function::ARCCOSINE:
+		return array_type{ std::acos(sample) };
+	case Function::ARCSINE:
+		return array_type{ std::asin(sample) };
+	case Function::ARCTANGENT:
+		return array_type{ std::atan(sample) };
+	case Function::CEILING:
+		return array_type{ std::ceil(sample) };
+	case Function::COSINE:
+		return array_type{ std::cos(sample) };
+	case Function::HYPERBOLIC_COSINE:
+		return array_type{ std::cosh(sample) };
+	case Function::DEGREE_CONVERSION:
+		return array_type{ sample * 180 / 3.14159265358979323846 };
+	case Function::EXPONENTIAL:
+		return array_type{ std::exp(sample) };
+	case Function::FLOOR:
+		return array_type{ std::floor(sample) };
+	case Function::NATURAL_LOG:
+		return array_type{ std::log(sample) };
+	case Function::BASE_10_LOG:
+		return array_type{ std::log10(sample) };
+	case Function::RADIAN_CONVERSION:
+		return array_type{ sample * 3.14159265358979323846 / 180 };
+	case Function::ROUND:
+		return array_type{ std::round(sample) };
+	case Function::SINE:
+		return array_type{ std::sin(sample) };
+	case Function::HYPERBOLIC_SINE:
+		return array_type{ std::sinh(sample) };
+	case Function::SQUARE_ROOT:
+		return array_type{ std::sqrt(sample) };
+	case Function::TANGENT:
+		return array_type{ std::tan(sample) };
+	case Function::HYPERBOLIC_TANGENT:
+		return array_type{ std::tanh(sample) };
+	case Function::TRUNCATE:
+	default:
+		return array_type{ std::trunc(sample) };
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Applies a math function to every sample
+//
+class INDICATORSDLL MathTransform
+{
+public:
+	enum class Function
+	{
+		ABSOLUTE_VALUE,
+		ARCCOSINE,
+		ARCSINE,
+		ARCTANGENT,
+		CEILING,
+		COSINE,
+		HYPERBOLIC_COSINE,
+		DEGREE_CONVERSION,
+		EXPONENTIAL,
+		FLOOR,
+		NATURAL_LOG,
+		BASE_10_LOG,
+		RADIAN_CONVERSION,
+		ROUND,
+		SINE,
+		HYPERBOLIC_SINE,
+		SQUARE_ROOT,
+		TANGENT,
+		HYPERBOLIC_TANGENT,
+		TRUNCATE
+	};
+
+	MathTransform(Function function);
+	~MathTransform();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VALUE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class MathTransformImpl;
+	MathTransformImpl* impl_;
+};
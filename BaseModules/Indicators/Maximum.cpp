@@ -0,0 +1,59 @@
+#include "Maximum.h"
+#include "RollingExtremum.h"
+
+class Maximum::MaximumImpl
+{
+public:
+	MaximumImpl(unsigned int period);
+	~MaximumImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMaximum maximum_;
+};
+
+Maximum::Maximum(unsigned int period) :
+	impl_(new MaximumImpl(period))
+{
+}
+
+Maximum::~Maximum()
+{
+	delete impl_;
+}
+
+Maximum::array_type Maximum::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+Maximum::array_type Maximum::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Maximum::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Maximum::MaximumImpl::MaximumImpl(unsigned int period) :
+	maximum_(period)
+{
+}
+
+Maximum::MaximumImpl::~MaximumImpl()
+{
+}
+
+Maximum::array_type Maximum::MaximumImpl::update(const double sample, bool newBar)
+{
+	maximum_.update(sample, newBar);
+	return array_type{ maximum_.value() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Highest value over the last period samples
+//
+class INDICATORSDLL Maximum
+{
+public:
+	Maximum(unsigned int period);
+	~Maximum();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MAXIMUM,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class MaximumImpl;
+	MaximumImpl* impl_;
+};
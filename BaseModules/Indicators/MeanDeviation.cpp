@@ -0,0 +1,59 @@
+#include "MeanDeviation.h"
+#include "IndicatorKernels.h"
+
+class MeanDeviation::MeanDeviationImpl
+{
+public:
+	MeanDeviationImpl(unsigned int period);
+	~MeanDeviationImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMeanDeviation window_;
+};
+
+MeanDeviation::MeanDeviation(unsigned int period) :
+	impl_(new MeanDeviationImpl(period))
+{
+}
+
+MeanDeviation::~MeanDeviation()
+{
+	delete impl_;
+}
+
+MeanDeviation::array_type MeanDeviation::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+MeanDeviation::array_type MeanDeviation::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MeanDeviation::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MeanDeviation::MeanDeviationImpl::MeanDeviationImpl(unsigned int period) :
+	window_(period)
+{
+}
+
+MeanDeviation::MeanDeviationImpl::~MeanDeviationImpl()
+{
+}
+
+MeanDeviation::array_type MeanDeviation::MeanDeviationImpl::update(const double sample, bool newBar)
+{
+	window_.update(sample, newBar);
+	return array_type{ window_.meanDeviation() };
+}
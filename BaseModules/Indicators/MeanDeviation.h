@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Mean absolute deviation of the last period samples from their mean. O(period) per update, see
+// RollingMeanDeviation in IndicatorKernels.h for why
+//
+class INDICATORSDLL MeanDeviation
+{
+public:
+	MeanDeviation(unsigned int period);
+	~MeanDeviation();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MEAN_DEVIATION,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class MeanDeviationImpl;
+	MeanDeviationImpl* impl_;
+};
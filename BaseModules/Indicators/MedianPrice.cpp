@@ -0,0 +1,55 @@
+#include "MedianPrice.h"
+
+class MedianPrice::MedianPriceImpl
+{
+public:
+	MedianPriceImpl();
+	~MedianPriceImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+};
+
+MedianPrice::MedianPrice() :
+	impl_(new MedianPriceImpl())
+{
+}
+
+MedianPrice::~MedianPrice()
+{
+	delete impl_;
+}
+
+MedianPrice::array_type MedianPrice::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+MedianPrice::array_type MedianPrice::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MedianPrice::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MedianPrice::MedianPriceImpl::MedianPriceImpl()
+{
+}
+
+MedianPrice::MedianPriceImpl::~MedianPriceImpl()
+{
+}
+
+MedianPrice::array_type MedianPrice::MedianPriceImpl::update(const SamplePoint& sample, bool)
+{
+	return array_type{ (sample.high + sample.low) / 2 };
+}
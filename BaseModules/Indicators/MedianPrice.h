@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Midpoint of the high and the low
+//
+class INDICATORSDLL MedianPrice
+{
+public:
+	MedianPrice();
+	~MedianPrice();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MEDIAN_PRICE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class MedianPriceImpl;
+	MedianPriceImpl* impl_;
+};
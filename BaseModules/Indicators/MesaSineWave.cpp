@@ -0,0 +1,115 @@
+#include "MesaSineWave.h"
+#include "IndicatorKernels.h"
+
+class MesaSineWave::MesaSineWaveImpl
+{
+public:
+	MesaSineWaveImpl(unsigned int period);
+	~MesaSineWaveImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	const unsigned int period_;
+	const double pi = 3.14159265358979323846;
+
+	// rotation of one bar
+	const double cosine_;
+	const double sine_;
+
+	RingBuffer<double> window_;
+
+	// sum of the samples rotated by the number of bars since each of them
+	double real_;
+	double imaginary_;
+
+	// the rotations accumulate rounding errors. the sums are recomputed every period updates
+	size_t updatesSinceRecenter_;
+};
+
+MesaSineWave::MesaSineWave(unsigned int period) :
+	impl_(new MesaSineWaveImpl(period))
+{
+}
+
+MesaSineWave::~MesaSineWave()
+{
+	delete impl_;
+}
+
+MesaSineWave::array_type MesaSineWave::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+MesaSineWave::array_type MesaSineWave::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MesaSineWave::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MesaSineWave::MesaSineWaveImpl::MesaSineWaveImpl(unsigned int period) :
+	period_(checkPeriod(period)),
+	cosine_(std::cos(2 * pi / period)),
+	sine_(std::sin(2 * pi / period)),
+	window_(period),
+	real_(0),
+	imaginary_(0),
+	updatesSinceRecenter_(0)
+{
+}
+
+MesaSineWave::MesaSineWaveImpl::~MesaSineWaveImpl()
+{
+}
+
+MesaSineWave::array_type MesaSineWave::MesaSineWaveImpl::update(const double sample, bool newBar)
+{
+	if (newBar || window_.empty())
+	{
+		// rotate every sample one bar further and drop the one that leaves the window. its
+		// rotation has come back to the start of the cycle
+		double oldest = 0;
+		bool full = window_.push(sample, oldest);
+		auto real = real_ * cosine_ - imaginary_ * sine_;
+		auto imaginary = real_ * sine_ + imaginary_ * cosine_;
+		real_ = real + sample - (full ? oldest : 0);
+		imaginary_ = imaginary;
+	}
+	else
+	{
+		// the latest sample is not rotated
+		auto& newest = window_.newest();
+		real_ += sample - newest;
+		newest = sample;
+	}
+
+	if (++updatesSinceRecenter_ >= window_.capacity())
+	{
+		updatesSinceRecenter_ = 0;
+		real_ = 0;
+		imaginary_ = 0;
+		for (size_t i = 0; i < window_.size(); ++i)
+		{
+			auto angle = 2 * pi * (window_.size() - 1 - i) / period_;
+			real_ += std::cos(angle) * window_[i];
+			imaginary_ += std::sin(angle) * window_[i];
+		}
+	}
+
+	auto phase = std::atan2(imaginary_, real_) + pi / 2;
+
+	array_type result;
+	result[SINE] = std::sin(phase);
+	result[LEAD] = std::sin(phase + pi / 4);
+	return result;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Sine of the phase of the dominant cycle of length period and the sine 45 degrees ahead. The phase
+// is taken from a sliding discrete Fourier transform, so each update is O(1)
+//
+class INDICATORSDLL MesaSineWave
+{
+public:
+	MesaSineWave(unsigned int period);
+	~MesaSineWave();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		SINE,
+		LEAD,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class MesaSineWaveImpl;
+	MesaSineWaveImpl* impl_;
+};
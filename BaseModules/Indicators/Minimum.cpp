@@ -0,0 +1,59 @@
+#include "Minimum.h"
+#include "RollingExtremum.h"
+
+class Minimum::MinimumImpl
+{
+public:
+	MinimumImpl(unsigned int period);
+	~MinimumImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMinimum minimum_;
+};
+
+Minimum::Minimum(unsigned int period) :
+	impl_(new MinimumImpl(period))
+{
+}
+
+Minimum::~Minimum()
+{
+	delete impl_;
+}
+
+Minimum::array_type Minimum::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+Minimum::array_type Minimum::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Minimum::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Minimum::MinimumImpl::MinimumImpl(unsigned int period) :
+	minimum_(period)
+{
+}
+
+Minimum::MinimumImpl::~MinimumImpl()
+{
+}
+
+Minimum::array_type Minimum::MinimumImpl::update(const double sample, bool newBar)
+{
+	minimum_.update(sample, newBar);
+	return array_type{ minimum_.value() };
+}
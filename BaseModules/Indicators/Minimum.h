@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Lowest value over the last period samples
+//
+class INDICATORSDLL Minimum
+{
+public:
+	Minimum(unsigned int period);
+	~Minimum();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MINIMUM,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class MinimumImpl;
+	MinimumImpl* impl_;
+};
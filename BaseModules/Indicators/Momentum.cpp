@@ -0,0 +1,59 @@
+#include "Momentum.h"
+#include "IndicatorKernels.h"
+
+class Momentum::MomentumImpl
+{
+public:
+	MomentumImpl(unsigned int period);
+	~MomentumImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow window_;
+};
+
+Momentum::Momentum(unsigned int period) :
+	impl_(new MomentumImpl(period))
+{
+}
+
+Momentum::~Momentum()
+{
+	delete impl_;
+}
+
+Momentum::array_type Momentum::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+Momentum::array_type Momentum::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Momentum::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Momentum::MomentumImpl::MomentumImpl(unsigned int period) :
+	window_(checkPeriod(period) + 1)
+{
+}
+
+Momentum::MomentumImpl::~MomentumImpl()
+{
+}
+
+Momentum::array_type Momentum::MomentumImpl::update(const double sample, bool newBar)
+{
+	window_.update(sample, newBar);
+	return array_type{ sample - window_.oldest() };
+}
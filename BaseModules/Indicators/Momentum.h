@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Change of the sample over period bars
+//
+class INDICATORSDLL Momentum
+{
+public:
+	Momentum(unsigned int period);
+	~Momentum();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MOMENTUM,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class MomentumImpl;
+	MomentumImpl* impl_;
+};
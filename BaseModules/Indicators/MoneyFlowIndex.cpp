@@ -0,0 +1,71 @@
+#include "MoneyFlowIndex.h"
+#include "IndicatorKernels.h"
+
+class MoneyFlowIndex::MoneyFlowIndexImpl
+{
+public:
+	MoneyFlowIndexImpl(unsigned int period);
+	~MoneyFlowIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> previous_;
+	RollingWindow positive_;
+	RollingWindow negative_;
+};
+
+MoneyFlowIndex::MoneyFlowIndex(unsigned int period) :
+	impl_(new MoneyFlowIndexImpl(period))
+{
+}
+
+MoneyFlowIndex::~MoneyFlowIndex()
+{
+	delete impl_;
+}
+
+MoneyFlowIndex::array_type MoneyFlowIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+MoneyFlowIndex::array_type MoneyFlowIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MoneyFlowIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MoneyFlowIndex::MoneyFlowIndexImpl::MoneyFlowIndexImpl(unsigned int period) :
+	positive_(period),
+	negative_(period)
+{
+}
+
+MoneyFlowIndex::MoneyFlowIndexImpl::~MoneyFlowIndexImpl()
+{
+}
+
+MoneyFlowIndex::array_type MoneyFlowIndex::MoneyFlowIndexImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto typicalPrice = (sample.high + sample.low + sample.close) / 3;
+	auto& previous = previous_.begin(newBar);
+	auto change = previous_.bars() > 1 ? typicalPrice - previous : 0;
+	previous = typicalPrice;
+
+	auto flow = typicalPrice * sample.volume;
+	positive_.update(change > 0 ? flow : 0, newBar);
+	negative_.update(change < 0 ? flow : 0, newBar);
+
+	auto total = positive_.sum() + negative_.sum();
+	return array_type{ total > 0 ? 100 * positive_.sum() / total : 0 };
+}
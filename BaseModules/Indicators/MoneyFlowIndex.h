@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Money flow of the candles where the typical price rose as a percentage of the total money flow
+// over the last period candles
+//
+class INDICATORSDLL MoneyFlowIndex
+{
+public:
+	MoneyFlowIndex(unsigned int period);
+	~MoneyFlowIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MONEY_FLOW_INDEX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class MoneyFlowIndexImpl;
+	MoneyFlowIndexImpl* impl_;
+};
@@ -0,0 +1,66 @@
+#include "MovingAverageConvergenceDivergence.h"
+#include "IndicatorKernels.h"
+
+class MovingAverageConvergenceDivergence::MovingAverageConvergenceDivergenceImpl
+{
+public:
+	MovingAverageConvergenceDivergenceImpl(unsigned int shortPeriod, unsigned int longPeriod, unsigned int signalPeriod);
+	~MovingAverageConvergenceDivergenceImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	Ema short_;
+	Ema long_;
+	Ema signal_;
+};
+
+MovingAverageConvergenceDivergence::MovingAverageConvergenceDivergence(unsigned int shortPeriod, unsigned int longPeriod, unsigned int signalPeriod) :
+	impl_(new MovingAverageConvergenceDivergenceImpl(shortPeriod, longPeriod, signalPeriod))
+{
+}
+
+MovingAverageConvergenceDivergence::~MovingAverageConvergenceDivergence()
+{
+	delete impl_;
+}
+
+MovingAverageConvergenceDivergence::array_type MovingAverageConvergenceDivergence::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+MovingAverageConvergenceDivergence::array_type MovingAverageConvergenceDivergence::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void MovingAverageConvergenceDivergence::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+MovingAverageConvergenceDivergence::MovingAverageConvergenceDivergenceImpl::MovingAverageConvergenceDivergenceImpl(unsigned int shortPeriod, unsigned int longPeriod, unsigned int signalPeriod) :
+	short_(emaAlpha(shortPeriod)),
+	long_(emaAlpha(longPeriod)),
+	signal_(emaAlpha(signalPeriod))
+{
+}
+
+MovingAverageConvergenceDivergence::MovingAverageConvergenceDivergenceImpl::~MovingAverageConvergenceDivergenceImpl()
+{
+}
+
+MovingAverageConvergenceDivergence::array_type MovingAverageConvergenceDivergence::MovingAverageConvergenceDivergenceImpl::update(const double sample, bool newBar)
+{
+	array_type result;
+	result[MACD] = short_.update(sample, newBar) - long_.update(sample, newBar);
+	result[SIGNAL] = signal_.update(result[MACD], newBar);
+	result[HISTOGRAM] = result[MACD] - result[SIGNAL];
+	return result;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Short ema minus long ema, its signalPeriod ema and the difference between the two
+//
+class INDICATORSDLL MovingAverageConvergenceDivergence
+{
+public:
+	MovingAverageConvergenceDivergence(unsigned int shortPeriod, unsigned int longPeriod, unsigned int signalPeriod);
+	~MovingAverageConvergenceDivergence();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		MACD,
+		SIGNAL,
+		HISTOGRAM,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class MovingAverageConvergenceDivergenceImpl;
+	MovingAverageConvergenceDivergenceImpl* impl_;
+};
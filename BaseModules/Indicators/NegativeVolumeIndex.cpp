@@ -0,0 +1,72 @@
+#include "NegativeVolumeIndex.h"
+#include "IndicatorKernels.h"
+
+class NegativeVolumeIndex::NegativeVolumeIndexImpl
+{
+public:
+	NegativeVolumeIndexImpl();
+	~NegativeVolumeIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	struct Index
+	{
+		double close;
+		double volume;
+		double index;
+	};
+
+	BarState<Index> state_;
+};
+
+NegativeVolumeIndex::NegativeVolumeIndex() :
+	impl_(new NegativeVolumeIndexImpl())
+{
+}
+
+NegativeVolumeIndex::~NegativeVolumeIndex()
+{
+	delete impl_;
+}
+
+NegativeVolumeIndex::array_type NegativeVolumeIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+NegativeVolumeIndex::array_type NegativeVolumeIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void NegativeVolumeIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+NegativeVolumeIndex::NegativeVolumeIndexImpl::NegativeVolumeIndexImpl() :
+	state_(Index{ 0, 0, 1000 })
+{
+}
+
+NegativeVolumeIndex::NegativeVolumeIndexImpl::~NegativeVolumeIndexImpl()
+{
+}
+
+NegativeVolumeIndex::array_type NegativeVolumeIndex::NegativeVolumeIndexImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& index = state_.begin(newBar);
+	if (state_.bars() > 1 && sample.volume < index.volume && index.close != 0)
+	{
+		index.index += index.index * (sample.close - index.close) / index.close;
+	}
+	index.close = sample.close;
+	index.volume = sample.volume;
+	return array_type{ index.index };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Index starting at 1000 which follows the close on the candles where the volume falls
+//
+class INDICATORSDLL NegativeVolumeIndex
+{
+public:
+	NegativeVolumeIndex();
+	~NegativeVolumeIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		NEGATIVE_VOLUME_INDEX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class NegativeVolumeIndexImpl;
+	NegativeVolumeIndexImpl* impl_;
+};
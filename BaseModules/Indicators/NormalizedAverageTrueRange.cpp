@@ -0,0 +1,64 @@
+#include "NormalizedAverageTrueRange.h"
+#include "IndicatorKernels.h"
+
+class NormalizedAverageTrueRange::NormalizedAverageTrueRangeImpl
+{
+public:
+	NormalizedAverageTrueRangeImpl(unsigned int period);
+	~NormalizedAverageTrueRangeImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> close_;
+	WilderAverage average_;
+};
+
+NormalizedAverageTrueRange::NormalizedAverageTrueRange(unsigned int period) :
+	impl_(new NormalizedAverageTrueRangeImpl(period))
+{
+}
+
+NormalizedAverageTrueRange::~NormalizedAverageTrueRange()
+{
+	delete impl_;
+}
+
+NormalizedAverageTrueRange::array_type NormalizedAverageTrueRange::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+NormalizedAverageTrueRange::array_type NormalizedAverageTrueRange::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void NormalizedAverageTrueRange::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+NormalizedAverageTrueRange::NormalizedAverageTrueRangeImpl::NormalizedAverageTrueRangeImpl(unsigned int period) :
+	average_(period)
+{
+}
+
+NormalizedAverageTrueRange::NormalizedAverageTrueRangeImpl::~NormalizedAverageTrueRangeImpl()
+{
+}
+
+NormalizedAverageTrueRange::array_type NormalizedAverageTrueRange::NormalizedAverageTrueRangeImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& close = close_.begin(newBar);
+	auto range = trueRange(sample, close_.bars() > 1, close);
+	close = sample.close;
+
+	auto averageRange = average_.update(range, newBar);
+	return array_type{ sample.close != 0 ? 100 * averageRange / sample.close : 0 };
+}
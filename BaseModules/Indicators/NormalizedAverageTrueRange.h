@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Average true range as a percentage of the close
+//
+class INDICATORSDLL NormalizedAverageTrueRange
+{
+public:
+	NormalizedAverageTrueRange(unsigned int period);
+	~NormalizedAverageTrueRange();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		NORMALIZED_AVERAGE_TRUE_RANGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class NormalizedAverageTrueRangeImpl;
+	NormalizedAverageTrueRangeImpl* impl_;
+};
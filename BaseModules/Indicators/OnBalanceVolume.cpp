@@ -0,0 +1,72 @@
+#include "OnBalanceVolume.h"
+#include "IndicatorKernels.h"
+
+class OnBalanceVolume::OnBalanceVolumeImpl
+{
+public:
+	OnBalanceVolumeImpl();
+	~OnBalanceVolumeImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	struct Balance
+	{
+		double close;
+		double volume;
+	};
+
+	BarState<Balance> state_;
+};
+
+OnBalanceVolume::OnBalanceVolume() :
+	impl_(new OnBalanceVolumeImpl())
+{
+}
+
+OnBalanceVolume::~OnBalanceVolume()
+{
+	delete impl_;
+}
+
+OnBalanceVolume::array_type OnBalanceVolume::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+OnBalanceVolume::array_type OnBalanceVolume::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void OnBalanceVolume::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+OnBalanceVolume::OnBalanceVolumeImpl::OnBalanceVolumeImpl()
+{
+}
+
+OnBalanceVolume::OnBalanceVolumeImpl::~OnBalanceVolumeImpl()
+{
+}
+
+OnBalanceVolume::array_type OnBalanceVolume::OnBalanceVolumeImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& balance = state_.begin(newBar);
+	if (state_.bars() > 1)
+	{
+		if (sample.close > balance.close)
+			balance.volume += sample.volume;
+		else if (sample.close < balance.close)
+			balance.volume -= sample.volume;
+	}
+	balance.close = sample.close;
+	return array_type{ balance.volume };
+}
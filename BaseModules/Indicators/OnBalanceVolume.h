@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Running total of the volume, added when the close rises and subtracted when it falls
+//
+class INDICATORSDLL OnBalanceVolume
+{
+public:
+	OnBalanceVolume();
+	~OnBalanceVolume();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ON_BALANCE_VOLUME,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class OnBalanceVolumeImpl;
+	OnBalanceVolumeImpl* impl_;
+};
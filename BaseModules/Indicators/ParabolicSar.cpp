@@ -0,0 +1,129 @@
+#include "ParabolicSar.h"
+#include "IndicatorKernels.h"
+
+class ParabolicSar::ParabolicSarImpl
+{
+public:
+	ParabolicSarImpl(double accelerationStep, double accelerationMaximum);
+	~ParabolicSarImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	struct Sar
+	{
+		bool rising;
+		double sar;
+		double extreme;
+		double acceleration;
+
+		// lows and highs of the last two candles
+		double lastLow;
+		double lastHigh;
+		double priorLow;
+		double priorHigh;
+	};
+
+	const double accelerationStep_;
+	const double accelerationMaximum_;
+	BarState<Sar> state_;
+};
+
+ParabolicSar::ParabolicSar(double accelerationStep, double accelerationMaximum) :
+	impl_(new ParabolicSarImpl(accelerationStep, accelerationMaximum))
+{
+}
+
+ParabolicSar::~ParabolicSar()
+{
+	delete impl_;
+}
+
+ParabolicSar::array_type ParabolicSar::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+ParabolicSar::array_type ParabolicSar::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void ParabolicSar::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+ParabolicSar::ParabolicSarImpl::ParabolicSarImpl(double accelerationStep, double accelerationMaximum) :
+	accelerationStep_(accelerationStep),
+	accelerationMaximum_(accelerationMaximum)
+{
+}
+
+ParabolicSar::ParabolicSarImpl::~ParabolicSarImpl()
+{
+}
+
+ParabolicSar::array_type ParabolicSar::ParabolicSarImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& sar = state_.begin(newBar);
+	if (state_.bars() == 1)
+	{
+		// assume a rising trend from the first candle
+		sar.rising = true;
+		sar.sar = sample.low;
+		sar.extreme = sample.high;
+		sar.acceleration = accelerationStep_;
+		sar.lastLow = sar.priorLow = sample.low;
+		sar.lastHigh = sar.priorHigh = sample.high;
+		return array_type{ sar.sar };
+	}
+
+	// project the stop of the previous candle towards the extreme of the trend. it may not enter the
+	// range of the previous two candles
+	auto value = sar.sar + sar.acceleration * (sar.extreme - sar.sar);
+	if (sar.rising)
+	{
+		value = (std::min)({ value, sar.lastLow, sar.priorLow });
+		if (sample.low < value)
+		{
+			sar.rising = false;
+			value = sar.extreme;
+			sar.extreme = sample.low;
+			sar.acceleration = accelerationStep_;
+		}
+		else if (sample.high > sar.extreme)
+		{
+			sar.extreme = sample.high;
+			sar.acceleration = (std::min)(sar.acceleration + accelerationStep_, accelerationMaximum_);
+		}
+	}
+	else
+	{
+		value = (std::max)({ value, sar.lastHigh, sar.priorHigh });
+		if (sample.high > value)
+		{
+			sar.rising = true;
+			value = sar.extreme;
+			sar.extreme = sample.high;
+			sar.acceleration = accelerationStep_;
+		}
+		else if (sample.low < sar.extreme)
+		{
+			sar.extreme = sample.low;
+			sar.acceleration = (std::min)(sar.acceleration + accelerationStep_, accelerationMaximum_);
+		}
+	}
+
+	sar.sar = value;
+	sar.priorLow = sar.lastLow;
+	sar.priorHigh = sar.lastHigh;
+	sar.lastLow = sample.low;
+	sar.lastHigh = sample.high;
+	return array_type{ value };
+}
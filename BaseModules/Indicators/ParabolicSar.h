@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Wilder's parabolic stop and reverse. accelerationStep and accelerationMaximum are usually 0.02 and 0.2
+//
+class INDICATORSDLL ParabolicSar
+{
+public:
+	ParabolicSar(double accelerationStep, double accelerationMaximum);
+	~ParabolicSar();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		PARABOLIC_SAR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class ParabolicSarImpl;
+	ParabolicSarImpl* impl_;
+};
@@ -0,0 +1,62 @@
+#include "PercentagePriceOscillator.h"
+#include "IndicatorKernels.h"
+
+class PercentagePriceOscillator::PercentagePriceOscillatorImpl
+{
+public:
+	PercentagePriceOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod);
+	~PercentagePriceOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	Ema short_;
+	Ema long_;
+};
+
+PercentagePriceOscillator::PercentagePriceOscillator(unsigned int shortPeriod, unsigned int longPeriod) :
+	impl_(new PercentagePriceOscillatorImpl(shortPeriod, longPeriod))
+{
+}
+
+PercentagePriceOscillator::~PercentagePriceOscillator()
+{
+	delete impl_;
+}
+
+PercentagePriceOscillator::array_type PercentagePriceOscillator::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+PercentagePriceOscillator::array_type PercentagePriceOscillator::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void PercentagePriceOscillator::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+PercentagePriceOscillator::PercentagePriceOscillatorImpl::PercentagePriceOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod) :
+	short_(emaAlpha(shortPeriod)),
+	long_(emaAlpha(longPeriod))
+{
+}
+
+PercentagePriceOscillator::PercentagePriceOscillatorImpl::~PercentagePriceOscillatorImpl()
+{
+}
+
+PercentagePriceOscillator::array_type PercentagePriceOscillator::PercentagePriceOscillatorImpl::update(const double sample, bool newBar)
+{
+	auto shortEma = short_.update(sample, newBar);
+	auto longEma = long_.update(sample, newBar);
+	return array_type{ longEma != 0 ? 100 * (shortEma - longEma) / longEma : 0 };
+}
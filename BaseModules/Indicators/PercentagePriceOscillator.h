@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Short ema minus long ema as a percentage of the long ema
+//
+class INDICATORSDLL PercentagePriceOscillator
+{
+public:
+	PercentagePriceOscillator(unsigned int shortPeriod, unsigned int longPeriod);
+	~PercentagePriceOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		PERCENTAGE_PRICE_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class PercentagePriceOscillatorImpl;
+	PercentagePriceOscillatorImpl* impl_;
+};
@@ -0,0 +1,72 @@
+#include "PositiveVolumeIndex.h"
+#include "IndicatorKernels.h"
+
+class PositiveVolumeIndex::PositiveVolumeIndexImpl
+{
+public:
+	PositiveVolumeIndexImpl();
+	~PositiveVolumeIndexImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	struct Index
+	{
+		double close;
+		double volume;
+		double index;
+	};
+
+	BarState<Index> state_;
+};
+
+PositiveVolumeIndex::PositiveVolumeIndex() :
+	impl_(new PositiveVolumeIndexImpl())
+{
+}
+
+PositiveVolumeIndex::~PositiveVolumeIndex()
+{
+	delete impl_;
+}
+
+PositiveVolumeIndex::array_type PositiveVolumeIndex::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+PositiveVolumeIndex::array_type PositiveVolumeIndex::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void PositiveVolumeIndex::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+PositiveVolumeIndex::PositiveVolumeIndexImpl::PositiveVolumeIndexImpl() :
+	state_(Index{ 0, 0, 1000 })
+{
+}
+
+PositiveVolumeIndex::PositiveVolumeIndexImpl::~PositiveVolumeIndexImpl()
+{
+}
+
+PositiveVolumeIndex::array_type PositiveVolumeIndex::PositiveVolumeIndexImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& index = state_.begin(newBar);
+	if (state_.bars() > 1 && sample.volume > index.volume && index.close != 0)
+	{
+		index.index += index.index * (sample.close - index.close) / index.close;
+	}
+	index.close = sample.close;
+	index.volume = sample.volume;
+	return array_type{ index.index };
+}
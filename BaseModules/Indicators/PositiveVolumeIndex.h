@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Index starting at 1000 which follows the close on the candles where the volume rises
+//
+class INDICATORSDLL PositiveVolumeIndex
+{
+public:
+	PositiveVolumeIndex();
+	~PositiveVolumeIndex();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		POSITIVE_VOLUME_INDEX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class PositiveVolumeIndexImpl;
+	PositiveVolumeIndexImpl* impl_;
+};
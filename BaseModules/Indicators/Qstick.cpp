@@ -0,0 +1,59 @@
+#include "Qstick.h"
+#include "IndicatorKernels.h"
+
+class Qstick::QstickImpl
+{
+public:
+	QstickImpl(unsigned int period);
+	~QstickImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	RollingWindow window_;
+};
+
+Qstick::Qstick(unsigned int period) :
+	impl_(new QstickImpl(period))
+{
+}
+
+Qstick::~Qstick()
+{
+	delete impl_;
+}
+
+Qstick::array_type Qstick::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+Qstick::array_type Qstick::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Qstick::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Qstick::QstickImpl::QstickImpl(unsigned int period) :
+	window_(period)
+{
+}
+
+Qstick::QstickImpl::~QstickImpl()
+{
+}
+
+Qstick::array_type Qstick::QstickImpl::update(const SamplePoint& sample, bool newBar)
+{
+	window_.update(sample.close - sample.open, newBar);
+	return array_type{ window_.mean() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Simple moving average of close - open over the last period candles
+//
+class INDICATORSDLL Qstick
+{
+public:
+	Qstick(unsigned int period);
+	~Qstick();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		QSTICK,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class QstickImpl;
+	QstickImpl* impl_;
+};
@@ -0,0 +1,60 @@
+#include "RateOfChange.h"
+#include "IndicatorKernels.h"
+
+class RateOfChange::RateOfChangeImpl
+{
+public:
+	RateOfChangeImpl(unsigned int period);
+	~RateOfChangeImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow window_;
+};
+
+RateOfChange::RateOfChange(unsigned int period) :
+	impl_(new RateOfChangeImpl(period))
+{
+}
+
+RateOfChange::~RateOfChange()
+{
+	delete impl_;
+}
+
+RateOfChange::array_type RateOfChange::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+RateOfChange::array_type RateOfChange::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void RateOfChange::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+RateOfChange::RateOfChangeImpl::RateOfChangeImpl(unsigned int period) :
+	window_(checkPeriod(period) + 1)
+{
+}
+
+RateOfChange::RateOfChangeImpl::~RateOfChangeImpl()
+{
+}
+
+RateOfChange::array_type RateOfChange::RateOfChangeImpl::update(const double sample, bool newBar)
+{
+	window_.update(sample, newBar);
+	auto past = window_.oldest();
+	return array_type{ past != 0 ? (sample - past) / past : 0 };
+}
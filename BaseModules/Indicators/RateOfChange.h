@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Change of the sample over period bars relative to the sample period bars ago
+//
+class INDICATORSDLL RateOfChange
+{
+public:
+	RateOfChange(unsigned int period);
+	~RateOfChange();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		RATE_OF_CHANGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class RateOfChangeImpl;
+	RateOfChangeImpl* impl_;
+};
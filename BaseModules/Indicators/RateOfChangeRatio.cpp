@@ -0,0 +1,60 @@
+#include "RateOfChangeRatio.h"
+#include "IndicatorKernels.h"
+
+class RateOfChangeRatio::RateOfChangeRatioImpl
+{
+public:
+	RateOfChangeRatioImpl(unsigned int period);
+	~RateOfChangeRatioImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow window_;
+};
+
+RateOfChangeRatio::RateOfChangeRatio(unsigned int period) :
+	impl_(new RateOfChangeRatioImpl(period))
+{
+}
+
+RateOfChangeRatio::~RateOfChangeRatio()
+{
+	delete impl_;
+}
+
+RateOfChangeRatio::array_type RateOfChangeRatio::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+RateOfChangeRatio::array_type RateOfChangeRatio::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void RateOfChangeRatio::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+RateOfChangeRatio::RateOfChangeRatioImpl::RateOfChangeRatioImpl(unsigned int period) :
+	window_(checkPeriod(period) + 1)
+{
+}
+
+RateOfChangeRatio::RateOfChangeRatioImpl::~RateOfChangeRatioImpl()
+{
+}
+
+RateOfChangeRatio::array_type RateOfChangeRatio::RateOfChangeRatioImpl::update(const double sample, bool newBar)
+{
+	window_.update(sample, newBar);
+	auto past = window_.oldest();
+	return array_type{ past != 0 ? sample / past : 0 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Ratio of the sample to the sample period bars ago
+//
+class INDICATORSDLL RateOfChangeRatio
+{
+public:
+	RateOfChangeRatio(unsigned int period);
+	~RateOfChangeRatio();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		RATE_OF_CHANGE_RATIO,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class RateOfChangeRatioImpl;
+	RateOfChangeRatioImpl* impl_;
+};
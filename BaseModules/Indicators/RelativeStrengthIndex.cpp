@@ -1,4 +1,5 @@
 #include "RelativeStrengthIndex.h"
+#include "IndicatorKernels.h"
 
 class RelativeStrengthIndex::RelativeStrengthIndexImpl
 {
@@ -6,28 +7,14 @@ public:
 	RelativeStrengthIndexImpl(unsigned int period);
 	~RelativeStrengthIndexImpl();
 
-	array_type computeIndicatorPoint(const double sample);
-	array_type recomputeIndicatorPoint(const double sample);
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
 private:
-	const unsigned int period_;
-	double pVal_;
-
-	// previous s up and s down. gets replaced by current s up and down for every new value (candle)
-	// in computeIndicatorPoint
-	double pSUp_;
-	double pSDown_;
-
-	double cVal_;
-
-	// current s up and s down to hold temporary rsi calculations. gets replaced every time an update
-	// value (candle) comes in recomputeIndicatorPoint;
-	double cSUp_;
-	double cSDown_;
-
-	// keeps track of the num of inputs until
-	// num inputs reaches period
-	unsigned int size_;
-
+	// smoothed ups and downs of the changes. until period samples are added they are the
+	// average of the samples so far
+	RelativeStrength strength_;
 };
 
 RelativeStrengthIndex::RelativeStrengthIndex(unsigned int period) :
@@ -42,69 +29,32 @@ RelativeStrengthIndex::~RelativeStrengthIndex()
 
 RelativeStrengthIndex::array_type RelativeStrengthIndex::computeIndicatorPoint(const double sample)
 {
-	return impl_->computeIndicatorPoint(sample);
+	return impl_->update(sample, true);
 }
+
 RelativeStrengthIndex::array_type RelativeStrengthIndex::recomputeIndicatorPoint(const double sample)
 {
-	return impl_->recomputeIndicatorPoint(sample);
+	return impl_->update(sample, false);
 }
-RelativeStrengthIndex::RelativeStrengthIndexImpl::RelativeStrengthIndexImpl(unsigned int period) :
-	period_(period)
+
+void RelativeStrengthIndex::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
 {
-	size_ = 0;
-	pVal_ = cVal_ = 0;
-	pSUp_ = cSUp_ = 0;
-	pSDown_ = cSDown_ = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
 }
 
-RelativeStrengthIndex::RelativeStrengthIndexImpl::~RelativeStrengthIndexImpl()
+RelativeStrengthIndex::RelativeStrengthIndexImpl::RelativeStrengthIndexImpl(unsigned int period) :
+	strength_(period)
 {
 }
 
-RelativeStrengthIndex::array_type RelativeStrengthIndex::RelativeStrengthIndexImpl::computeIndicatorPoint(const double sample)
+RelativeStrengthIndex::RelativeStrengthIndexImpl::~RelativeStrengthIndexImpl()
 {
-	// last modified values get stored into the p values;
-	pVal_ = cVal_;
-	pSUp_ = cSUp_;
-	pSDown_ = cSDown_;
-
-	// account for number of inputs for when num of inputs
-	// hasn't reached period_, we output results using current 
-	// size as the period
-	if (size_ < period_)
-		++size_;
-
-	double up, down;
-	sample > pVal_ ? up = sample - pVal_ : up = 0;
-	sample < pVal_ ? down = pVal_ - sample : down = 0;
-
-	//cVal is now the newest value.
-	cVal_ = sample;
-
-	// calculate the newest current sup and sdown values
-	cSUp_ = (size_ - 1) * pSUp_ / size_ + up / size_;
-	cSDown_ = (size_ - 1) * pSDown_ / size_ + down / size_;
-
-	return array_type{ 100 - 100 / (1 + cSUp_ / cSDown_) };
 }
 
-RelativeStrengthIndex::array_type RelativeStrengthIndex::RelativeStrengthIndexImpl::recomputeIndicatorPoint(const double sample)
+RelativeStrengthIndex::array_type RelativeStrengthIndex::RelativeStrengthIndexImpl::update(const double sample, bool newBar)
 {
-	double up, down;
-
-	// compare with pVal_ to assign up and down. we compute relative
-	// to the previous input
-	sample > pVal_ ? up = sample - pVal_ : up = 0;
-	sample < pVal_ ? down = pVal_ - sample : down = 0;
-
-	//cVal is now the newest value.
-	cVal_ = sample;
-
-	// calculate the current sup and sdown values and store them.
-	// they get transferred to p sup and sdown when new values in come
-	cSUp_ = (size_ - 1) * pSUp_ / size_ + up / size_;
-	cSDown_ = (size_ - 1) * pSDown_ / size_ + down / size_;
-
-	return array_type{ 100 - 100 / (1 + cSUp_ / cSDown_) };
+	return array_type{ strength_.update(sample, newBar) };
 }
-
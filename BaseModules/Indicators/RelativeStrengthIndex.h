@@ -17,6 +17,7 @@ public:
 	using array_type = std::array<double, SIZE>;
 	array_type computeIndicatorPoint(const double sample);
 	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
 
 private:
 	class RelativeStrengthIndexImpl;
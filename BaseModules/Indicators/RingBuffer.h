@@ -0,0 +1,160 @@
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+//
+// Fixed size window of the most recent samples used by the window based indicators. The storage is
+// allocated once in the constructor. Pushing into a full window overwrites the oldest sample and hands
+// it back so that running sums can be updated in O(1).
+//
+template<typename T>
+class RingBuffer
+{
+public:
+	explicit RingBuffer(size_t capacity) :
+		buffer_(capacity),
+		head_(0),
+		size_(0)
+	{
+		if (capacity == 0)
+		{
+			throw std::invalid_argument("Indicator period must be positive.");
+		}
+	}
+
+	//
+	// adds sample as the newest value. returns true and sets evicted to the oldest value if the
+	// window was already full
+	//
+	bool push(const T& sample, T& evicted)
+	{
+		bool full = size_ == buffer_.size();
+		if (full)
+		{
+			evicted = buffer_[head_];
+		}
+		else
+		{
+			++size_;
+		}
+
+		buffer_[head_] = sample;
+		head_ = head_ + 1 == buffer_.size() ? 0 : head_ + 1;
+		return full;
+	}
+
+	T& newest()
+	{
+		return buffer_[head_ == 0 ? buffer_.size() - 1 : head_ - 1];
+	}
+
+	//
+	// index 0 is the oldest value in the window
+	//
+	const T& operator[](size_t index) const
+	{
+		size_t position = head_ + buffer_.size() - size_ + index;
+		return buffer_[position >= buffer_.size() ? position - buffer_.size() : position];
+	}
+
+	size_t size() const
+	{
+		return size_;
+	}
+
+	bool empty() const
+	{
+		return size_ == 0;
+	}
+
+	size_t capacity() const
+	{
+		return buffer_.size();
+	}
+
+private:
+	std::vector<T> buffer_;
+
+	// position the next sample is written to
+	size_t head_;
+	size_t size_;
+};
+
+//
+// Same window with its storage held inline, for the windows whose size is known at compile time. It
+// needs no allocation and the wrap around compares against a constant, so the loops over the window
+// can be unrolled and vectorized.
+//
+template<typename T, size_t Capacity>
+class FixedRingBuffer
+{
+	static_assert(Capacity > 0, "Indicator period must be positive.");
+
+public:
+	//
+	// capacity is only taken so that the kernels can build either window the same way. it must be
+	// Capacity
+	//
+	explicit FixedRingBuffer(size_t capacity) :
+		buffer_(),
+		head_(0),
+		size_(0)
+	{
+		if (capacity != Capacity)
+		{
+			throw std::invalid_argument("Window size does not match its storage.");
+		}
+	}
+
+	bool push(const T& sample, T& evicted)
+	{
+		bool full = size_ == Capacity;
+		if (full)
+		{
+			evicted = buffer_[head_];
+		}
+		else
+		{
+			++size_;
+		}
+
+		buffer_[head_] = sample;
+		head_ = head_ + 1 == Capacity ? 0 : head_ + 1;
+		return full;
+	}
+
+	T& newest()
+	{
+		return buffer_[head_ == 0 ? Capacity - 1 : head_ - 1];
+	}
+
+	const T& operator[](size_t index) const
+	{
+		size_t position = head_ + Capacity - size_ + index;
+		return buffer_[position >= Capacity ? position - Capacity : position];
+	}
+
+	size_t size() const
+	{
+		return size_;
+	}
+
+	bool empty() const
+	{
+		return size_ == 0;
+	}
+
+	size_t capacity() const
+	{
+		return Capacity;
+	}
+
+private:
+	std::array<T, Capacity> buffer_;
+
+	// position the next sample is written to
+	size_t head_;
+	size_t size_;
+};
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+//
+// Streaming extremum of the last period samples using a monotonic deque. Each committed sample is
+// pushed and popped at most once, so adding a sample is amortized O(1) no matter the period.
+//
+// The newest sample is provisional. It can be replaced any number of times, which is how the
+// indicators recompute the in-progress bar, and is only pushed into the deque when the next sample
+// is added. Keeping it out of the deque means replacing it never has to bring back the samples it
+// would have popped.
+//
+// Compare(a, b) is true when a is strictly more extreme than b. Ties resolve to the most recent sample.
+//
+template<typename Compare>
+class RollingExtremum
+{
+public:
+	explicit RollingExtremum(size_t period) :
+		deque_(period),
+		head_(0),
+		size_(0),
+		count_(0),
+		provisional_(0)
+	{
+		if (period == 0)
+		{
+			throw std::invalid_argument("Indicator period must be positive.");
+		}
+	}
+
+	//
+	// commits the newest sample and starts a new one
+	//
+	void add(double sample)
+	{
+		if (count_ > 0)
+		{
+			commit();
+		}
+		++count_;
+
+		// drop the samples which fall out of the window now that the new one is in
+		while (size_ > 0 && front().index + deque_.size() <= count_ - 1)
+		{
+			head_ = next(head_);
+			--size_;
+		}
+
+		provisional_ = sample;
+	}
+
+	//
+	// replaces the newest sample
+	//
+	void replace(double sample)
+	{
+		if (count_ == 0)
+		{
+			add(sample);
+			return;
+		}
+		provisional_ = sample;
+	}
+
+	//
+	// adds or replaces the newest sample, same as the building blocks in IndicatorKernels.h
+	//
+	void update(double sample, bool newBar)
+	{
+		if (newBar)
+		{
+			add(sample);
+		}
+		else
+		{
+			replace(sample);
+		}
+	}
+
+	double value() const
+	{
+		return providesExtremum() ? provisional_ : front().value;
+	}
+
+	//
+	// number of samples since the extremum. 0 when the newest sample is the extremum
+	//
+	size_t age() const
+	{
+		return providesExtremum() ? 0 : static_cast<size_t>(count_ - 1 - front().index);
+	}
+
+	//
+	// number of samples in the window
+	//
+	size_t size() const
+	{
+		return count_ < deque_.size() ? static_cast<size_t>(count_) : deque_.size();
+	}
+
+private:
+	struct Entry
+	{
+		unsigned long long index;
+		double value;
+	};
+
+	// preallocated ring holding the deque. it never holds more than period committed samples
+	std::vector<Entry> deque_;
+	size_t head_;
+	size_t size_;
+
+	// number of samples added. the provisional sample has index count_ - 1
+	unsigned long long count_;
+	double provisional_;
+
+	Compare compare_;
+
+	void commit()
+	{
+		// the samples the provisional sample is at least as extreme as can never be the extremum again
+		while (size_ > 0 && !compare_(back().value, provisional_))
+		{
+			--size_;
+		}
+
+		deque_[position(size_)] = Entry{ count_ - 1, provisional_ };
+		++size_;
+	}
+
+	bool providesExtremum() const
+	{
+		return size_ == 0 || !compare_(front().value, provisional_);
+	}
+
+	const Entry& front() const
+	{
+		return deque_[head_];
+	}
+
+	const Entry& back() const
+	{
+		return deque_[position(size_ - 1)];
+	}
+
+	size_t position(size_t offset) const
+	{
+		size_t position = head_ + offset;
+		return position >= deque_.size() ? position - deque_.size() : position;
+	}
+
+	size_t next(size_t position) const
+	{
+		return position + 1 == deque_.size() ? 0 : position + 1;
+	}
+};
+
+using RollingMaximum = RollingExtremum<std::greater<double>>;
+using RollingMinimum = RollingExtremum<std::less<double>>;
@@ -1,5 +1,5 @@
 #include "SimpleMovingAverage.h"
-#include <deque>
+#include "IndicatorKernels.h"
 
 class SimpleMovingAverage::SimpleMovingAverageImpl
 {
@@ -7,15 +7,14 @@ public:
 	SimpleMovingAverageImpl(int period);
 	~SimpleMovingAverageImpl();
 
-	SimpleMovingAverage::array_type computeIndicatorPoint(const double sample);
-	SimpleMovingAverage::array_type recomputeIndicatorPoint(const double sample);
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
 private:
-	const int period_;
-	double sum_;
-
-	// this queue is the size of the period. It holds the values of the history. When a new value is added it is pushed into the queue and
-	// the value is added to the sum. At the same time, the oldest value is popped from the back and subtracted from the sum.
-	std::deque<double> window_;
+	// holds the last period samples and their sum. until the window has grown to the size of the
+	// period we average what it holds, so averaging begins with the first received point
+	RollingWindow window_;
 };
 
 SimpleMovingAverage::SimpleMovingAverage(int period):
@@ -30,55 +29,33 @@ SimpleMovingAverage::~SimpleMovingAverage()
 
 SimpleMovingAverage::array_type SimpleMovingAverage::computeIndicatorPoint(const double sample)
 {
-	return impl_->computeIndicatorPoint(sample);
+	return impl_->update(sample, true);
 }
 
 SimpleMovingAverage::array_type SimpleMovingAverage::recomputeIndicatorPoint(const double sample)
 {
-	return impl_->recomputeIndicatorPoint(sample);
+	return impl_->update(sample, false);
 }
 
-SimpleMovingAverage::SimpleMovingAverageImpl::SimpleMovingAverageImpl(int period):
-	period_(period),
-	sum_(0)
+void SimpleMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
 {
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
 }
 
-SimpleMovingAverage::SimpleMovingAverageImpl::~SimpleMovingAverageImpl()
+SimpleMovingAverage::SimpleMovingAverageImpl::SimpleMovingAverageImpl(int period):
+	window_(period > 0 ? static_cast<unsigned int>(period) : 0)
 {
 }
 
-SimpleMovingAverage::array_type SimpleMovingAverage::SimpleMovingAverageImpl::computeIndicatorPoint(const double sample)
+SimpleMovingAverage::SimpleMovingAverageImpl::~SimpleMovingAverageImpl()
 {
-	window_.push_front(sample);
-	sum_ += sample;
-	
-	// we only need to start removing from the back of window_
-	// when the window_ has grown to the size > period_. 
-	// otherwise, we simply take the average until the
-	// window_ reaches a constant size. this way, we begin
-	// averaging with the first received point
-	if (window_.size() > period_)
-	{
-		sum_ -= window_.back();
-		window_.pop_back();
-	}
-
-	return array_type{sum_ / window_.size()};
 }
 
-SimpleMovingAverage::array_type SimpleMovingAverage::SimpleMovingAverageImpl::recomputeIndicatorPoint(const double sample)
+SimpleMovingAverage::array_type SimpleMovingAverage::SimpleMovingAverageImpl::update(const double sample, bool newBar)
 {
-
-	// recompute the current moving average by replacing the latest point with sample
-
-	sum_ -= window_.front();
-
-	//replace the front with the current value
-	window_.front() = sample;
-
-	sum_ += sample;
-
-	return array_type{ sum_ / window_.size()};
-
+	window_.update(sample, newBar);
+	return array_type{ window_.mean() };
 }
@@ -0,0 +1,59 @@
+#include "StandardDeviation.h"
+#include "IndicatorKernels.h"
+
+class StandardDeviation::StandardDeviationImpl
+{
+public:
+	StandardDeviationImpl(unsigned int period);
+	~StandardDeviationImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMoments moments_;
+};
+
+StandardDeviation::StandardDeviation(unsigned int period) :
+	impl_(new StandardDeviationImpl(period))
+{
+}
+
+StandardDeviation::~StandardDeviation()
+{
+	delete impl_;
+}
+
+StandardDeviation::array_type StandardDeviation::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+StandardDeviation::array_type StandardDeviation::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void StandardDeviation::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+StandardDeviation::StandardDeviationImpl::StandardDeviationImpl(unsigned int period) :
+	moments_(period)
+{
+}
+
+StandardDeviation::StandardDeviationImpl::~StandardDeviationImpl()
+{
+}
+
+StandardDeviation::array_type StandardDeviation::StandardDeviationImpl::update(const double sample, bool newBar)
+{
+	moments_.update(sample, newBar);
+	return array_type{ moments_.standardDeviation() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Population standard deviation of the last period samples
+//
+class INDICATORSDLL StandardDeviation
+{
+public:
+	StandardDeviation(unsigned int period);
+	~StandardDeviation();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		STANDARD_DEVIATION,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class StandardDeviationImpl;
+	StandardDeviationImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "StandardError.h"
+#include "IndicatorKernels.h"
+
+class StandardError::StandardErrorImpl
+{
+public:
+	StandardErrorImpl(unsigned int period);
+	~StandardErrorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMoments moments_;
+};
+
+StandardError::StandardError(unsigned int period) :
+	impl_(new StandardErrorImpl(period))
+{
+}
+
+StandardError::~StandardError()
+{
+	delete impl_;
+}
+
+StandardError::array_type StandardError::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+StandardError::array_type StandardError::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void StandardError::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+StandardError::StandardErrorImpl::StandardErrorImpl(unsigned int period) :
+	moments_(period)
+{
+}
+
+StandardError::StandardErrorImpl::~StandardErrorImpl()
+{
+}
+
+StandardError::array_type StandardError::StandardErrorImpl::update(const double sample, bool newBar)
+{
+	moments_.update(sample, newBar);
+	return array_type{ moments_.standardDeviation() / std::sqrt(static_cast<double>(moments_.size())) };
+}
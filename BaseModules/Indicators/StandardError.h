@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Standard error of the mean of the last period samples
+//
+class INDICATORSDLL StandardError
+{
+public:
+	StandardError(unsigned int period);
+	~StandardError();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		STANDARD_ERROR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class StandardErrorImpl;
+	StandardErrorImpl* impl_;
+};
@@ -0,0 +1,92 @@
+#include "StochasticOscillator.h"
+#include "IndicatorKernels.h"
+#include "RollingExtremum.h"
+
+class StochasticOscillator::StochasticOscillatorImpl
+{
+public:
+	StochasticOscillatorImpl(unsigned int kPeriod, unsigned int kSlowingPeriod, unsigned int dPeriod);
+	~StochasticOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	RollingMaximum highest_;
+	RollingMinimum lowest_;
+
+	// %K is smoothed by kSlowing_ and %D is the average of the smoothed %K. both follow the
+	// compute/recompute of the latest candle
+	RollingWindow kSlowing_;
+	RollingWindow d_;
+
+private:
+	double fastK(double close) const;
+};
+
+StochasticOscillator::StochasticOscillator(unsigned int kPeriod, unsigned int kSlowingPeriod, unsigned int dPeriod) :
+	impl_(new StochasticOscillatorImpl(kPeriod, kSlowingPeriod, dPeriod))
+{
+}
+
+StochasticOscillator::~StochasticOscillator()
+{
+	delete impl_;
+}
+
+StochasticOscillator::array_type StochasticOscillator::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+StochasticOscillator::array_type StochasticOscillator::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void StochasticOscillator::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+StochasticOscillator::StochasticOscillatorImpl::StochasticOscillatorImpl(unsigned int kPeriod, unsigned int kSlowingPeriod, unsigned int dPeriod) :
+	highest_(kPeriod),
+	lowest_(kPeriod),
+	kSlowing_(kSlowingPeriod),
+	d_(dPeriod)
+{
+}
+
+StochasticOscillator::StochasticOscillatorImpl::~StochasticOscillatorImpl()
+{
+}
+
+StochasticOscillator::array_type StochasticOscillator::StochasticOscillatorImpl::update(const SamplePoint& sample, bool newBar)
+{
+	highest_.update(sample.high, newBar);
+	lowest_.update(sample.low, newBar);
+
+	kSlowing_.update(fastK(sample.close), newBar);
+	d_.update(kSlowing_.mean(), newBar);
+
+	array_type result;
+	result[K] = kSlowing_.mean();
+	result[D] = d_.mean();
+	return result;
+}
+
+double StochasticOscillator::StochasticOscillatorImpl::fastK(double close) const
+{
+	auto range = highest_.value() - lowest_.value();
+
+	// flat range, the close is both the high and the low
+	if (range <= 0)
+	{
+		return 0;
+	}
+	return 100 * (close - lowest_.value()) / range;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Position of the close within the high/low range of the last kPeriod candles, from 0 to 100.
+// %K is smoothed by a kSlowingPeriod simple moving average and %D is the dPeriod simple moving
+// average of %K. A kSlowingPeriod of 1 gives the fast stochastic.
+//
+class INDICATORSDLL StochasticOscillator
+{
+public:
+	StochasticOscillator(unsigned int kPeriod, unsigned int kSlowingPeriod, unsigned int dPeriod);
+	~StochasticOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		K,
+		D,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class StochasticOscillatorImpl;
+	StochasticOscillatorImpl* impl_;
+};
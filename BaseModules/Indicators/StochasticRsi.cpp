@@ -0,0 +1,68 @@
+#include "StochasticRsi.h"
+#include "IndicatorKernels.h"
+#include "RollingExtremum.h"
+
+class StochasticRsi::StochasticRsiImpl
+{
+public:
+	StochasticRsiImpl(unsigned int period);
+	~StochasticRsiImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RelativeStrength strength_;
+	RollingMaximum highest_;
+	RollingMinimum lowest_;
+};
+
+StochasticRsi::StochasticRsi(unsigned int period) :
+	impl_(new StochasticRsiImpl(period))
+{
+}
+
+StochasticRsi::~StochasticRsi()
+{
+	delete impl_;
+}
+
+StochasticRsi::array_type StochasticRsi::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+StochasticRsi::array_type StochasticRsi::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void StochasticRsi::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+StochasticRsi::StochasticRsiImpl::StochasticRsiImpl(unsigned int period) :
+	strength_(period),
+	highest_(period),
+	lowest_(period)
+{
+}
+
+StochasticRsi::StochasticRsiImpl::~StochasticRsiImpl()
+{
+}
+
+StochasticRsi::array_type StochasticRsi::StochasticRsiImpl::update(const double sample, bool newBar)
+{
+	auto rsi = strength_.update(sample, newBar);
+
+	highest_.update(rsi, newBar);
+	lowest_.update(rsi, newBar);
+	auto range = highest_.value() - lowest_.value();
+	return array_type{ range > 0 ? (rsi - lowest_.value()) / range : 0 };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Position of the relative strength index within its range over the last period samples, from 0 to 1.
+// The relative strength index is averaged with Wilder's smoothing
+//
+class INDICATORSDLL StochasticRsi
+{
+public:
+	StochasticRsi(unsigned int period);
+	~StochasticRsi();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		STOCHASTIC_RSI,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class StochasticRsiImpl;
+	StochasticRsiImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "SumOverPeriod.h"
+#include "IndicatorKernels.h"
+
+class SumOverPeriod::SumOverPeriodImpl
+{
+public:
+	SumOverPeriodImpl(unsigned int period);
+	~SumOverPeriodImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow window_;
+};
+
+SumOverPeriod::SumOverPeriod(unsigned int period) :
+	impl_(new SumOverPeriodImpl(period))
+{
+}
+
+SumOverPeriod::~SumOverPeriod()
+{
+	delete impl_;
+}
+
+SumOverPeriod::array_type SumOverPeriod::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+SumOverPeriod::array_type SumOverPeriod::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void SumOverPeriod::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+SumOverPeriod::SumOverPeriodImpl::SumOverPeriodImpl(unsigned int period) :
+	window_(period)
+{
+}
+
+SumOverPeriod::SumOverPeriodImpl::~SumOverPeriodImpl()
+{
+}
+
+SumOverPeriod::array_type SumOverPeriod::SumOverPeriodImpl::update(const double sample, bool newBar)
+{
+	window_.update(sample, newBar);
+	return array_type{ window_.sum() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Sum of the last period samples
+//
+class INDICATORSDLL SumOverPeriod
+{
+public:
+	SumOverPeriod(unsigned int period);
+	~SumOverPeriod();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		SUM,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class SumOverPeriodImpl;
+	SumOverPeriodImpl* impl_;
+};
@@ -0,0 +1,59 @@
+#include "TimeSeriesForecast.h"
+#include "IndicatorKernels.h"
+
+class TimeSeriesForecast::TimeSeriesForecastImpl
+{
+public:
+	TimeSeriesForecastImpl(unsigned int period);
+	~TimeSeriesForecastImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingRegression regression_;
+};
+
+TimeSeriesForecast::TimeSeriesForecast(unsigned int period) :
+	impl_(new TimeSeriesForecastImpl(period))
+{
+}
+
+TimeSeriesForecast::~TimeSeriesForecast()
+{
+	delete impl_;
+}
+
+TimeSeriesForecast::array_type TimeSeriesForecast::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+TimeSeriesForecast::array_type TimeSeriesForecast::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void TimeSeriesForecast::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+TimeSeriesForecast::TimeSeriesForecastImpl::TimeSeriesForecastImpl(unsigned int period) :
+	regression_(period)
+{
+}
+
+TimeSeriesForecast::TimeSeriesForecastImpl::~TimeSeriesForecastImpl()
+{
+}
+
+TimeSeriesForecast::array_type TimeSeriesForecast::TimeSeriesForecastImpl::update(const double sample, bool newBar)
+{
+	regression_.update(sample, newBar);
+	return array_type{ regression_.valueAt(1) };
+}
@@ -0,0 +1,62 @@
+#include "TriangularMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class TriangularMovingAverage::TriangularMovingAverageImpl
+{
+public:
+	TriangularMovingAverageImpl(unsigned int period);
+	~TriangularMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow first_;
+	RollingWindow second_;
+};
+
+TriangularMovingAverage::TriangularMovingAverage(unsigned int period) :
+	impl_(new TriangularMovingAverageImpl(period))
+{
+}
+
+TriangularMovingAverage::~TriangularMovingAverage()
+{
+	delete impl_;
+}
+
+TriangularMovingAverage::array_type TriangularMovingAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+TriangularMovingAverage::array_type TriangularMovingAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void TriangularMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+TriangularMovingAverage::TriangularMovingAverageImpl::TriangularMovingAverageImpl(unsigned int period) :
+	first_(checkPeriod(period) / 2 + 1),
+	second_((period + 1) / 2)
+{
+}
+
+TriangularMovingAverage::TriangularMovingAverageImpl::~TriangularMovingAverageImpl()
+{
+}
+
+TriangularMovingAverage::array_type TriangularMovingAverage::TriangularMovingAverageImpl::update(const double sample, bool newBar)
+{
+	first_.update(sample, newBar);
+	second_.update(first_.mean(), newBar);
+	return array_type{ second_.mean() };
+}
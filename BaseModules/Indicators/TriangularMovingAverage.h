@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Triangular moving average. Simple moving average of a simple moving average, which together
+// span period samples
+//
+class INDICATORSDLL TriangularMovingAverage
+{
+public:
+	TriangularMovingAverage(unsigned int period);
+	~TriangularMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		TRIANGULAR_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class TriangularMovingAverageImpl;
+	TriangularMovingAverageImpl* impl_;
+};
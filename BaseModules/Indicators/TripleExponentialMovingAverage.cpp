@@ -0,0 +1,65 @@
+#include "TripleExponentialMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class TripleExponentialMovingAverage::TripleExponentialMovingAverageImpl
+{
+public:
+	TripleExponentialMovingAverageImpl(unsigned int period);
+	~TripleExponentialMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	Ema ema1_;
+	Ema ema2_;
+	Ema ema3_;
+};
+
+TripleExponentialMovingAverage::TripleExponentialMovingAverage(unsigned int period) :
+	impl_(new TripleExponentialMovingAverageImpl(period))
+{
+}
+
+TripleExponentialMovingAverage::~TripleExponentialMovingAverage()
+{
+	delete impl_;
+}
+
+TripleExponentialMovingAverage::array_type TripleExponentialMovingAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+TripleExponentialMovingAverage::array_type TripleExponentialMovingAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void TripleExponentialMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+TripleExponentialMovingAverage::TripleExponentialMovingAverageImpl::TripleExponentialMovingAverageImpl(unsigned int period) :
+	ema1_(emaAlpha(period)),
+	ema2_(emaAlpha(period)),
+	ema3_(emaAlpha(period))
+{
+}
+
+TripleExponentialMovingAverage::TripleExponentialMovingAverageImpl::~TripleExponentialMovingAverageImpl()
+{
+}
+
+TripleExponentialMovingAverage::array_type TripleExponentialMovingAverage::TripleExponentialMovingAverageImpl::update(const double sample, bool newBar)
+{
+	auto ema1 = ema1_.update(sample, newBar);
+	auto ema2 = ema2_.update(ema1, newBar);
+	auto ema3 = ema3_.update(ema2, newBar);
+	return array_type{ 3 * ema1 - 3 * ema2 + ema3 };
+}
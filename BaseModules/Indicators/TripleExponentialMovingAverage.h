@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Triple exponential moving average. 3 * ema - 3 * ema of ema + ema of ema of ema
+//
+class INDICATORSDLL TripleExponentialMovingAverage
+{
+public:
+	TripleExponentialMovingAverage(unsigned int period);
+	~TripleExponentialMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		TRIPLE_EXPONENTIAL_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class TripleExponentialMovingAverageImpl;
+	TripleExponentialMovingAverageImpl* impl_;
+};
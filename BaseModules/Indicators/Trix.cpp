@@ -0,0 +1,67 @@
+#include "Trix.h"
+#include "IndicatorKernels.h"
+
+class Trix::TrixImpl
+{
+public:
+	TrixImpl(unsigned int period);
+	~TrixImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	Ema ema1_;
+	Ema ema2_;
+	Ema ema3_;
+};
+
+Trix::Trix(unsigned int period) :
+	impl_(new TrixImpl(period))
+{
+}
+
+Trix::~Trix()
+{
+	delete impl_;
+}
+
+Trix::array_type Trix::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+Trix::array_type Trix::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Trix::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Trix::TrixImpl::TrixImpl(unsigned int period) :
+	ema1_(emaAlpha(period)),
+	ema2_(emaAlpha(period)),
+	ema3_(emaAlpha(period))
+{
+}
+
+Trix::TrixImpl::~TrixImpl()
+{
+}
+
+Trix::array_type Trix::TrixImpl::update(const double sample, bool newBar)
+{
+	auto ema = ema3_.update(ema2_.update(ema1_.update(sample, newBar), newBar), newBar);
+	if (ema3_.bars() < 2 || ema3_.previous() == 0)
+	{
+		return array_type{ 0 };
+	}
+	return array_type{ 100 * (ema - ema3_.previous()) / ema3_.previous() };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Percentage change of the triple exponential smoothing of the sample from the previous bar
+//
+class INDICATORSDLL Trix
+{
+public:
+	Trix(unsigned int period);
+	~Trix();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		TRIX,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class TrixImpl;
+	TrixImpl* impl_;
+};
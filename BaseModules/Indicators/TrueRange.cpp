@@ -0,0 +1,60 @@
+#include "TrueRange.h"
+#include "IndicatorKernels.h"
+
+class TrueRange::TrueRangeImpl
+{
+public:
+	TrueRangeImpl();
+	~TrueRangeImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> close_;
+};
+
+TrueRange::TrueRange() :
+	impl_(new TrueRangeImpl())
+{
+}
+
+TrueRange::~TrueRange()
+{
+	delete impl_;
+}
+
+TrueRange::array_type TrueRange::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+TrueRange::array_type TrueRange::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void TrueRange::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+TrueRange::TrueRangeImpl::TrueRangeImpl()
+{
+}
+
+TrueRange::TrueRangeImpl::~TrueRangeImpl()
+{
+}
+
+TrueRange::array_type TrueRange::TrueRangeImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& close = close_.begin(newBar);
+	auto range = trueRange(sample, close_.bars() > 1, close);
+	close = sample.close;
+	return array_type{ range };
+}
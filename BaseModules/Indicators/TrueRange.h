@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Greatest of the range of the candle and the gaps from the previous close
+//
+class INDICATORSDLL TrueRange
+{
+public:
+	TrueRange();
+	~TrueRange();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		TRUE_RANGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class TrueRangeImpl;
+	TrueRangeImpl* impl_;
+};
@@ -0,0 +1,55 @@
+#include "TypicalPrice.h"
+
+class TypicalPrice::TypicalPriceImpl
+{
+public:
+	TypicalPriceImpl();
+	~TypicalPriceImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+};
+
+TypicalPrice::TypicalPrice() :
+	impl_(new TypicalPriceImpl())
+{
+}
+
+TypicalPrice::~TypicalPrice()
+{
+	delete impl_;
+}
+
+TypicalPrice::array_type TypicalPrice::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+TypicalPrice::array_type TypicalPrice::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void TypicalPrice::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+TypicalPrice::TypicalPriceImpl::TypicalPriceImpl()
+{
+}
+
+TypicalPrice::TypicalPriceImpl::~TypicalPriceImpl()
+{
+}
+
+TypicalPrice::array_type TypicalPrice::TypicalPriceImpl::update(const SamplePoint& sample, bool)
+{
+	return array_type{ (sample.high + sample.low + sample.close) / 3 };
+}
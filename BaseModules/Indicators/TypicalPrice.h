@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Average of the high, low and close
+//
+class INDICATORSDLL TypicalPrice
+{
+public:
+	TypicalPrice();
+	~TypicalPrice();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		TYPICAL_PRICE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class TypicalPriceImpl;
+	TypicalPriceImpl* impl_;
+};
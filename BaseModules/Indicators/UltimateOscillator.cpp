@@ -0,0 +1,76 @@
+#include "UltimateOscillator.h"
+#include "IndicatorKernels.h"
+
+class UltimateOscillator::UltimateOscillatorImpl
+{
+public:
+	UltimateOscillatorImpl(unsigned int shortPeriod, unsigned int mediumPeriod, unsigned int longPeriod);
+	~UltimateOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	BarState<double> close_;
+
+	// buying pressure and true range for the short, medium and long periods
+	RollingWindow pressure_[3];
+	RollingWindow range_[3];
+};
+
+UltimateOscillator::UltimateOscillator(unsigned int shortPeriod, unsigned int mediumPeriod, unsigned int longPeriod) :
+	impl_(new UltimateOscillatorImpl(shortPeriod, mediumPeriod, longPeriod))
+{
+}
+
+UltimateOscillator::~UltimateOscillator()
+{
+	delete impl_;
+}
+
+UltimateOscillator::array_type UltimateOscillator::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+UltimateOscillator::array_type UltimateOscillator::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void UltimateOscillator::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+UltimateOscillator::UltimateOscillatorImpl::UltimateOscillatorImpl(unsigned int shortPeriod, unsigned int mediumPeriod, unsigned int longPeriod) :
+	pressure_{ RollingWindow(shortPeriod), RollingWindow(mediumPeriod), RollingWindow(longPeriod) },
+	range_{ RollingWindow(shortPeriod), RollingWindow(mediumPeriod), RollingWindow(longPeriod) }
+{
+}
+
+UltimateOscillator::UltimateOscillatorImpl::~UltimateOscillatorImpl()
+{
+}
+
+UltimateOscillator::array_type UltimateOscillator::UltimateOscillatorImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& close = close_.begin(newBar);
+	bool hasPrevious = close_.bars() > 1;
+	auto low = hasPrevious ? (std::min)(sample.low, close) : sample.low;
+	auto range = trueRange(sample, hasPrevious, close);
+	close = sample.close;
+
+	double average[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		pressure_[i].update(sample.close - low, newBar);
+		range_[i].update(range, newBar);
+		average[i] = range_[i].sum() > 0 ? pressure_[i].sum() / range_[i].sum() : 0;
+	}
+	return array_type{ 100 * (4 * average[0] + 2 * average[1] + average[2]) / 7 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Weighted average of the buying pressure over the true range for three periods, from 0 to 100
+//
+class INDICATORSDLL UltimateOscillator
+{
+public:
+	UltimateOscillator(unsigned int shortPeriod, unsigned int mediumPeriod, unsigned int longPeriod);
+	~UltimateOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ULTIMATE_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class UltimateOscillatorImpl;
+	UltimateOscillatorImpl* impl_;
+};
@@ -0,0 +1,69 @@
+#include "VariableIndexDynamicAverage.h"
+#include "IndicatorKernels.h"
+
+class VariableIndexDynamicAverage::VariableIndexDynamicAverageImpl
+{
+public:
+	VariableIndexDynamicAverageImpl(unsigned int shortPeriod, unsigned int longPeriod, double alpha);
+	~VariableIndexDynamicAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	const double alpha_;
+	RollingMoments short_;
+	RollingMoments long_;
+	Ema vidya_;
+};
+
+VariableIndexDynamicAverage::VariableIndexDynamicAverage(unsigned int shortPeriod, unsigned int longPeriod, double alpha) :
+	impl_(new VariableIndexDynamicAverageImpl(shortPeriod, longPeriod, alpha))
+{
+}
+
+VariableIndexDynamicAverage::~VariableIndexDynamicAverage()
+{
+	delete impl_;
+}
+
+VariableIndexDynamicAverage::array_type VariableIndexDynamicAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+VariableIndexDynamicAverage::array_type VariableIndexDynamicAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void VariableIndexDynamicAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+VariableIndexDynamicAverage::VariableIndexDynamicAverageImpl::VariableIndexDynamicAverageImpl(unsigned int shortPeriod, unsigned int longPeriod, double alpha) :
+	alpha_(alpha),
+	short_(shortPeriod),
+	long_(longPeriod),
+	vidya_(alpha)
+{
+}
+
+VariableIndexDynamicAverage::VariableIndexDynamicAverageImpl::~VariableIndexDynamicAverageImpl()
+{
+}
+
+VariableIndexDynamicAverage::array_type VariableIndexDynamicAverage::VariableIndexDynamicAverageImpl::update(const double sample, bool newBar)
+{
+	short_.update(sample, newBar);
+	long_.update(sample, newBar);
+
+	auto longDeviation = long_.standardDeviation();
+	auto ratio = longDeviation > 0 ? short_.standardDeviation() / longDeviation : 0;
+	return array_type{ vidya_.update(sample, alpha_ * ratio, newBar) };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Variable index dynamic average. Exponential average whose smoothing is alpha scaled by the
+// standard deviation of the last shortPeriod samples over the one of the last longPeriod samples
+//
+class INDICATORSDLL VariableIndexDynamicAverage
+{
+public:
+	VariableIndexDynamicAverage(unsigned int shortPeriod, unsigned int longPeriod, double alpha);
+	~VariableIndexDynamicAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VARIABLE_INDEX_DYNAMIC_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class VariableIndexDynamicAverageImpl;
+	VariableIndexDynamicAverageImpl* impl_;
+};
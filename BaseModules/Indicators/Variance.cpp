@@ -0,0 +1,59 @@
+#include "Variance.h"
+#include "IndicatorKernels.h"
+
+class Variance::VarianceImpl
+{
+public:
+	VarianceImpl(unsigned int period);
+	~VarianceImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMoments moments_;
+};
+
+Variance::Variance(unsigned int period) :
+	impl_(new VarianceImpl(period))
+{
+}
+
+Variance::~Variance()
+{
+	delete impl_;
+}
+
+Variance::array_type Variance::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+Variance::array_type Variance::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void Variance::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+Variance::VarianceImpl::VarianceImpl(unsigned int period) :
+	moments_(period)
+{
+}
+
+Variance::VarianceImpl::~VarianceImpl()
+{
+}
+
+Variance::array_type Variance::VarianceImpl::update(const double sample, bool newBar)
+{
+	moments_.update(sample, newBar);
+	return array_type{ moments_.variance() };
+}
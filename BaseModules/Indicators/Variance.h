@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Population variance of the last period samples
+//
+class INDICATORSDLL Variance
+{
+public:
+	Variance(unsigned int period);
+	~Variance();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VARIANCE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class VarianceImpl;
+	VarianceImpl* impl_;
+};
@@ -0,0 +1,72 @@
+#include "VerticalHorizontalFilter.h"
+#include "IndicatorKernels.h"
+#include "RollingExtremum.h"
+
+class VerticalHorizontalFilter::VerticalHorizontalFilterImpl
+{
+public:
+	VerticalHorizontalFilterImpl(unsigned int period);
+	~VerticalHorizontalFilterImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingMaximum highest_;
+	RollingMinimum lowest_;
+	RollingWindow changes_;
+	BarState<double> previous_;
+};
+
+VerticalHorizontalFilter::VerticalHorizontalFilter(unsigned int period) :
+	impl_(new VerticalHorizontalFilterImpl(period))
+{
+}
+
+VerticalHorizontalFilter::~VerticalHorizontalFilter()
+{
+	delete impl_;
+}
+
+VerticalHorizontalFilter::array_type VerticalHorizontalFilter::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+VerticalHorizontalFilter::array_type VerticalHorizontalFilter::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void VerticalHorizontalFilter::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+VerticalHorizontalFilter::VerticalHorizontalFilterImpl::VerticalHorizontalFilterImpl(unsigned int period) :
+	highest_(period),
+	lowest_(period),
+	changes_(period)
+{
+}
+
+VerticalHorizontalFilter::VerticalHorizontalFilterImpl::~VerticalHorizontalFilterImpl()
+{
+}
+
+VerticalHorizontalFilter::array_type VerticalHorizontalFilter::VerticalHorizontalFilterImpl::update(const double sample, bool newBar)
+{
+	highest_.update(sample, newBar);
+	lowest_.update(sample, newBar);
+
+	auto& previous = previous_.begin(newBar);
+	changes_.update(previous_.bars() > 1 ? std::fabs(sample - previous) : 0, newBar);
+	previous = sample;
+
+	auto volatility = changes_.sum();
+	return array_type{ volatility > 0 ? (highest_.value() - lowest_.value()) / volatility : 0 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Range of the last period samples over the sum of their absolute changes
+//
+class INDICATORSDLL VerticalHorizontalFilter
+{
+public:
+	VerticalHorizontalFilter(unsigned int period);
+	~VerticalHorizontalFilter();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VERTICAL_HORIZONTAL_FILTER,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class VerticalHorizontalFilterImpl;
+	VerticalHorizontalFilterImpl* impl_;
+};
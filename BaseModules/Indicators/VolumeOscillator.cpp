@@ -0,0 +1,62 @@
+#include "VolumeOscillator.h"
+#include "IndicatorKernels.h"
+
+class VolumeOscillator::VolumeOscillatorImpl
+{
+public:
+	VolumeOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod);
+	~VolumeOscillatorImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow short_;
+	RollingWindow long_;
+};
+
+VolumeOscillator::VolumeOscillator(unsigned int shortPeriod, unsigned int longPeriod) :
+	impl_(new VolumeOscillatorImpl(shortPeriod, longPeriod))
+{
+}
+
+VolumeOscillator::~VolumeOscillator()
+{
+	delete impl_;
+}
+
+VolumeOscillator::array_type VolumeOscillator::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+VolumeOscillator::array_type VolumeOscillator::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void VolumeOscillator::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+VolumeOscillator::VolumeOscillatorImpl::VolumeOscillatorImpl(unsigned int shortPeriod, unsigned int longPeriod) :
+	short_(shortPeriod),
+	long_(longPeriod)
+{
+}
+
+VolumeOscillator::VolumeOscillatorImpl::~VolumeOscillatorImpl()
+{
+}
+
+VolumeOscillator::array_type VolumeOscillator::VolumeOscillatorImpl::update(const double sample, bool newBar)
+{
+	short_.update(sample, newBar);
+	long_.update(sample, newBar);
+	return array_type{ long_.mean() != 0 ? 100 * (short_.mean() - long_.mean()) / long_.mean() : 0 };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Difference between the short and the long simple moving averages of the volume, as a percentage
+// of the long one
+//
+class INDICATORSDLL VolumeOscillator
+{
+public:
+	VolumeOscillator(unsigned int shortPeriod, unsigned int longPeriod);
+	~VolumeOscillator();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VOLUME_OSCILLATOR,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class VolumeOscillatorImpl;
+	VolumeOscillatorImpl* impl_;
+};
@@ -0,0 +1,62 @@
+#include "VolumeWeightedMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class VolumeWeightedMovingAverage::VolumeWeightedMovingAverageImpl
+{
+public:
+	VolumeWeightedMovingAverageImpl(unsigned int period);
+	~VolumeWeightedMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	RollingWindow weightedCloses_;
+	RollingWindow volumes_;
+};
+
+VolumeWeightedMovingAverage::VolumeWeightedMovingAverage(unsigned int period) :
+	impl_(new VolumeWeightedMovingAverageImpl(period))
+{
+}
+
+VolumeWeightedMovingAverage::~VolumeWeightedMovingAverage()
+{
+	delete impl_;
+}
+
+VolumeWeightedMovingAverage::array_type VolumeWeightedMovingAverage::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+VolumeWeightedMovingAverage::array_type VolumeWeightedMovingAverage::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void VolumeWeightedMovingAverage::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+VolumeWeightedMovingAverage::VolumeWeightedMovingAverageImpl::VolumeWeightedMovingAverageImpl(unsigned int period) :
+	weightedCloses_(period),
+	volumes_(period)
+{
+}
+
+VolumeWeightedMovingAverage::VolumeWeightedMovingAverageImpl::~VolumeWeightedMovingAverageImpl()
+{
+}
+
+VolumeWeightedMovingAverage::array_type VolumeWeightedMovingAverage::VolumeWeightedMovingAverageImpl::update(const SamplePoint& sample, bool newBar)
+{
+	weightedCloses_.update(sample.close * sample.volume, newBar);
+	volumes_.update(sample.volume, newBar);
+	return array_type{ volumes_.sum() > 0 ? weightedCloses_.sum() / volumes_.sum() : sample.close };
+}
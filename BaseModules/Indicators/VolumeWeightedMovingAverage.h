@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Volume weighted moving average of the close over the last period candles
+//
+class INDICATORSDLL VolumeWeightedMovingAverage
+{
+public:
+	VolumeWeightedMovingAverage(unsigned int period);
+	~VolumeWeightedMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		VOLUME_WEIGHTED_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class VolumeWeightedMovingAverageImpl;
+	VolumeWeightedMovingAverageImpl* impl_;
+};
@@ -0,0 +1,55 @@
+#include "WeightedClosePrice.h"
+
+class WeightedClosePrice::WeightedClosePriceImpl
+{
+public:
+	WeightedClosePriceImpl();
+	~WeightedClosePriceImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+};
+
+WeightedClosePrice::WeightedClosePrice() :
+	impl_(new WeightedClosePriceImpl())
+{
+}
+
+WeightedClosePrice::~WeightedClosePrice()
+{
+	delete impl_;
+}
+
+WeightedClosePrice::array_type WeightedClosePrice::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+WeightedClosePrice::array_type WeightedClosePrice::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void WeightedClosePrice::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+WeightedClosePrice::WeightedClosePriceImpl::WeightedClosePriceImpl()
+{
+}
+
+WeightedClosePrice::WeightedClosePriceImpl::~WeightedClosePriceImpl()
+{
+}
+
+WeightedClosePrice::array_type WeightedClosePrice::WeightedClosePriceImpl::update(const SamplePoint& sample, bool)
+{
+	return array_type{ (sample.high + sample.low + 2 * sample.close) / 4 };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Average of the high, low and close with the close counted twice
+//
+class INDICATORSDLL WeightedClosePrice
+{
+public:
+	WeightedClosePrice();
+	~WeightedClosePrice();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		WEIGHTED_CLOSE_PRICE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class WeightedClosePriceImpl;
+	WeightedClosePriceImpl* impl_;
+};
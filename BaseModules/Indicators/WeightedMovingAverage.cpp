@@ -0,0 +1,59 @@
+#include "WeightedMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class WeightedMovingAverage::WeightedMovingAverageImpl
+{
+public:
+	WeightedMovingAverageImpl(unsigned int period);
+	~WeightedMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingRegression window_;
+};
+
+WeightedMovingAverage::WeightedMovingAverage(unsigned int period) :
+	impl_(new WeightedMovingAverageImpl(period))
+{
+}
+
+WeightedMovingAverage::~WeightedMovingAverage()
+{
+	delete impl_;
+}
+
+WeightedMovingAverage::array_type WeightedMovingAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+WeightedMovingAverage::array_type WeightedMovingAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void WeightedMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+WeightedMovingAverage::WeightedMovingAverageImpl::WeightedMovingAverageImpl(unsigned int period) :
+	window_(period)
+{
+}
+
+WeightedMovingAverage::WeightedMovingAverageImpl::~WeightedMovingAverageImpl()
+{
+}
+
+WeightedMovingAverage::array_type WeightedMovingAverage::WeightedMovingAverageImpl::update(const double sample, bool newBar)
+{
+	window_.update(sample, newBar);
+	return array_type{ window_.weightedMean() };
+}
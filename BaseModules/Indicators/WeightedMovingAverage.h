@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Linearly weighted moving average. The latest sample has weight period, the oldest weight 1
+//
+class INDICATORSDLL WeightedMovingAverage
+{
+public:
+	WeightedMovingAverage(unsigned int period);
+	~WeightedMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		WEIGHTED_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class WeightedMovingAverageImpl;
+	WeightedMovingAverageImpl* impl_;
+};
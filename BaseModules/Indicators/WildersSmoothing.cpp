@@ -0,0 +1,58 @@
+#include "WildersSmoothing.h"
+#include "IndicatorKernels.h"
+
+class WildersSmoothing::WildersSmoothingImpl
+{
+public:
+	WildersSmoothingImpl(unsigned int period);
+	~WildersSmoothingImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	WilderAverage wilders_;
+};
+
+WildersSmoothing::WildersSmoothing(unsigned int period) :
+	impl_(new WildersSmoothingImpl(period))
+{
+}
+
+WildersSmoothing::~WildersSmoothing()
+{
+	delete impl_;
+}
+
+WildersSmoothing::array_type WildersSmoothing::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+WildersSmoothing::array_type WildersSmoothing::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void WildersSmoothing::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+WildersSmoothing::WildersSmoothingImpl::WildersSmoothingImpl(unsigned int period) :
+	wilders_(period)
+{
+}
+
+WildersSmoothing::WildersSmoothingImpl::~WildersSmoothingImpl()
+{
+}
+
+WildersSmoothing::array_type WildersSmoothing::WildersSmoothingImpl::update(const double sample, bool newBar)
+{
+	return array_type{ wilders_.update(sample, newBar) };
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Wilder's smoothing. The average of the samples until period samples are added, then each sample
+// moves it by 1 / period of the difference
+//
+class INDICATORSDLL WildersSmoothing
+{
+public:
+	WildersSmoothing(unsigned int period);
+	~WildersSmoothing();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		WILDERS_SMOOTHING,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class WildersSmoothingImpl;
+	WildersSmoothingImpl* impl_;
+};
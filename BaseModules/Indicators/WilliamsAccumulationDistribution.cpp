@@ -0,0 +1,72 @@
+#include "WilliamsAccumulationDistribution.h"
+#include "IndicatorKernels.h"
+
+class WilliamsAccumulationDistribution::WilliamsAccumulationDistributionImpl
+{
+public:
+	WilliamsAccumulationDistributionImpl();
+	~WilliamsAccumulationDistributionImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	struct Total
+	{
+		double close;
+		double total;
+	};
+
+	BarState<Total> state_;
+};
+
+WilliamsAccumulationDistribution::WilliamsAccumulationDistribution() :
+	impl_(new WilliamsAccumulationDistributionImpl())
+{
+}
+
+WilliamsAccumulationDistribution::~WilliamsAccumulationDistribution()
+{
+	delete impl_;
+}
+
+WilliamsAccumulationDistribution::array_type WilliamsAccumulationDistribution::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+WilliamsAccumulationDistribution::array_type WilliamsAccumulationDistribution::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void WilliamsAccumulationDistribution::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+WilliamsAccumulationDistribution::WilliamsAccumulationDistributionImpl::WilliamsAccumulationDistributionImpl()
+{
+}
+
+WilliamsAccumulationDistribution::WilliamsAccumulationDistributionImpl::~WilliamsAccumulationDistributionImpl()
+{
+}
+
+WilliamsAccumulationDistribution::array_type WilliamsAccumulationDistribution::WilliamsAccumulationDistributionImpl::update(const SamplePoint& sample, bool newBar)
+{
+	auto& total = state_.begin(newBar);
+	if (state_.bars() > 1)
+	{
+		if (sample.close > total.close)
+			total.total += sample.close - (std::min)(sample.low, total.close);
+		else if (sample.close < total.close)
+			total.total += sample.close - (std::max)(sample.high, total.close);
+	}
+	total.close = sample.close;
+	return array_type{ total.total };
+}
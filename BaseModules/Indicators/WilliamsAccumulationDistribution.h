@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Running total of the close minus the true low on rising closes, or the true high on falling closes
+//
+class INDICATORSDLL WilliamsAccumulationDistribution
+{
+public:
+	WilliamsAccumulationDistribution();
+	~WilliamsAccumulationDistribution();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		WILLIAMS_ACCUMULATION_DISTRIBUTION,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class WilliamsAccumulationDistributionImpl;
+	WilliamsAccumulationDistributionImpl* impl_;
+};
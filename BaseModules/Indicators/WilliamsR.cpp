@@ -0,0 +1,77 @@
+#include "WilliamsR.h"
+#include "RollingExtremum.h"
+
+class WilliamsR::WilliamsRImpl
+{
+public:
+	WilliamsRImpl(unsigned int period);
+	~WilliamsRImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const SamplePoint& sample, bool newBar);
+private:
+	RollingMaximum highest_;
+	RollingMinimum lowest_;
+
+private:
+	double williamsR(double close) const;
+};
+
+WilliamsR::WilliamsR(unsigned int period) :
+	impl_(new WilliamsRImpl(period))
+{
+}
+
+WilliamsR::~WilliamsR()
+{
+	delete impl_;
+}
+
+WilliamsR::array_type WilliamsR::computeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, true);
+}
+
+WilliamsR::array_type WilliamsR::recomputeIndicatorPoint(const SamplePoint& sample)
+{
+	return impl_->update(sample, false);
+}
+
+void WilliamsR::computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+WilliamsR::WilliamsRImpl::WilliamsRImpl(unsigned int period) :
+	highest_(period),
+	lowest_(period)
+{
+}
+
+WilliamsR::WilliamsRImpl::~WilliamsRImpl()
+{
+}
+
+WilliamsR::array_type WilliamsR::WilliamsRImpl::update(const SamplePoint& sample, bool newBar)
+{
+	highest_.update(sample.high, newBar);
+	lowest_.update(sample.low, newBar);
+	return array_type{ williamsR(sample.close) };
+}
+
+double WilliamsR::WilliamsRImpl::williamsR(double close) const
+{
+	auto range = highest_.value() - lowest_.value();
+
+	// flat range, the close is both the high and the low
+	if (range <= 0)
+	{
+		return 0;
+	}
+	return -100 * (highest_.value() - close) / range;
+}
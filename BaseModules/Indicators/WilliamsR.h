@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Position of the close below the highest high of the last period candles, from -100 to 0
+//
+class INDICATORSDLL WilliamsR
+{
+public:
+	WilliamsR(unsigned int period);
+	~WilliamsR();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		WILLIAMS_R,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const SamplePoint& sample);
+	array_type recomputeIndicatorPoint(const SamplePoint& sample);
+	void computeIndicatorPoints(const SamplePoint* samples, size_t count, array_type* points);
+
+private:
+	class WilliamsRImpl;
+	WilliamsRImpl* impl_;
+};
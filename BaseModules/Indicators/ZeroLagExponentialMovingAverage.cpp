@@ -0,0 +1,61 @@
+#include "ZeroLagExponentialMovingAverage.h"
+#include "IndicatorKernels.h"
+
+class ZeroLagExponentialMovingAverage::ZeroLagExponentialMovingAverageImpl
+{
+public:
+	ZeroLagExponentialMovingAverageImpl(unsigned int period);
+	~ZeroLagExponentialMovingAverageImpl();
+
+	//
+	// begins a new bar with the sample if newBar is true, otherwise replaces the latest bar
+	//
+	array_type update(const double sample, bool newBar);
+private:
+	RollingWindow prices_;
+	Ema ema_;
+};
+
+ZeroLagExponentialMovingAverage::ZeroLagExponentialMovingAverage(unsigned int period) :
+	impl_(new ZeroLagExponentialMovingAverageImpl(period))
+{
+}
+
+ZeroLagExponentialMovingAverage::~ZeroLagExponentialMovingAverage()
+{
+	delete impl_;
+}
+
+ZeroLagExponentialMovingAverage::array_type ZeroLagExponentialMovingAverage::computeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, true);
+}
+
+ZeroLagExponentialMovingAverage::array_type ZeroLagExponentialMovingAverage::recomputeIndicatorPoint(const double sample)
+{
+	return impl_->update(sample, false);
+}
+
+void ZeroLagExponentialMovingAverage::computeIndicatorPoints(const double* samples, size_t count, array_type* points)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		points[i] = impl_->update(samples[i], true);
+	}
+}
+
+ZeroLagExponentialMovingAverage::ZeroLagExponentialMovingAverageImpl::ZeroLagExponentialMovingAverageImpl(unsigned int period) :
+	prices_((checkPeriod(period) - 1) / 2 + 1),
+	ema_(emaAlpha(period))
+{
+}
+
+ZeroLagExponentialMovingAverage::ZeroLagExponentialMovingAverageImpl::~ZeroLagExponentialMovingAverageImpl()
+{
+}
+
+ZeroLagExponentialMovingAverage::array_type ZeroLagExponentialMovingAverage::ZeroLagExponentialMovingAverageImpl::update(const double sample, bool newBar)
+{
+	prices_.update(sample, newBar);
+	return array_type{ ema_.update(2 * sample - prices_.oldest(), newBar) };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Indicators.h"
+
+//
+// Zero lag exponential moving average. Ema of the sample plus its change over (period - 1) / 2 samples
+//
+class INDICATORSDLL ZeroLagExponentialMovingAverage
+{
+public:
+	ZeroLagExponentialMovingAverage(unsigned int period);
+	~ZeroLagExponentialMovingAverage();
+
+	// indices for output datapoints for this indicator
+	enum
+	{
+		ZERO_LAG_EXPONENTIAL_MOVING_AVERAGE,
+		SIZE
+	};
+
+	using array_type = std::array<double, SIZE>;
+
+	array_type computeIndicatorPoint(const double sample);
+	array_type recomputeIndicatorPoint(const double sample);
+	void computeIndicatorPoints(const double* samples, size_t count, array_type* points);
+
+private:
+	class ZeroLagExponentialMovingAverageImpl;
+	ZeroLagExponentialMovingAverageImpl* impl_;
+};
@@ -206,6 +206,10 @@ int EClient::bufferedSend(const std::string& msg) {
 	return m_transport->send(&emsg);
 }
 
+bool EClient::sendEncoded(const char* buf, size_t sz) {
+	return bufferedSend(std::string(buf, sz)) != -1;
+}
+
 void EClient::reqMktData(TickerId tickerId, const Contract& contract,
 						 const std::string& genericTicks, bool snapshot, bool regulatorySnaphsot, const TagValueListSPtr& mktDataOptions)
 {
@@ -1136,6 +1140,131 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		return;
 	}
 
+	std::stringstream msg;
+	prepareBuffer( msg);
+
+	if( !encodePlaceOrder( msg, id, contract, order)) {
+		return;
+	}
+
+	closeAndSend( msg.str());
+}
+
+namespace
+{
+	// values the template fields are encoded with. they are chosen so that no other field of a
+	// place order message can be encoded the same way
+	const OrderId TEMPLATE_ORDER_ID = 1999999937;
+	const double TEMPLATE_QUANTITY = 1234567.5;
+	const double TEMPLATE_LIMIT_PRICE = 7654321.25;
+}
+
+OrderTemplate EClient::createOrderTemplate( const Contract& contract, const Order& order)
+{
+	// the server version is kept even if the template turns out invalid, so that the caller
+	// doesn't try to encode it again until the server changes
+	OrderTemplate orderTemplate;
+	orderTemplate.serverVersion_ = m_serverVersion;
+
+	Order sentinelOrder = order;
+	sentinelOrder.totalQuantity = TEMPLATE_QUANTITY;
+	if( order.lmtPrice != UNSET_DOUBLE) {
+		sentinelOrder.lmtPrice = TEMPLATE_LIMIT_PRICE;
+	}
+
+	std::stringstream msg;
+	prepareBuffer( msg);
+	const size_t headerLength = static_cast<size_t>(msg.tellp());
+	if( !encodePlaceOrder( msg, TEMPLATE_ORDER_ID, contract, sentinelOrder)) {
+		return orderTemplate;
+	}
+	const std::string encoded = msg.str();
+
+	// the same sentinels formatted the way the generic encoder may have written them. the
+	// quantity is truncated to a long by servers without fractional positions
+	struct Sentinel
+	{
+		std::string text;
+		OrderTemplate::Field field;
+		OrderTemplate::Format format;
+	};
+	std::stringstream orderId, quantityDecimal, quantityInteger, limitPrice;
+	EncodeField( orderId, TEMPLATE_ORDER_ID);
+	EncodeField( quantityDecimal, TEMPLATE_QUANTITY);
+	EncodeField( quantityInteger, (long)TEMPLATE_QUANTITY);
+	EncodeField( limitPrice, TEMPLATE_LIMIT_PRICE);
+	const Sentinel sentinels[] = {
+		{ orderId.str(), OrderTemplate::Field::ORDER_ID, OrderTemplate::Format::INTEGER },
+		{ quantityDecimal.str(), OrderTemplate::Field::QUANTITY, OrderTemplate::Format::DECIMAL },
+		{ quantityInteger.str(), OrderTemplate::Field::QUANTITY, OrderTemplate::Format::INTEGER },
+		{ limitPrice.str(), OrderTemplate::Field::LIMIT_PRICE, OrderTemplate::Format::DECIMAL },
+	};
+
+	// walk the fields. every field is terminated by '\0' and the header may contain zeros so it
+	// is skipped. each sentinel field becomes a slot and everything else stays in the segments
+	size_t segmentStart = 0;
+	size_t fieldStart = headerLength;
+	while( fieldStart < encoded.size()) {
+		const size_t fieldEnd = encoded.find( '\0', fieldStart);
+		if( fieldEnd == std::string::npos) {
+			return orderTemplate;
+		}
+
+		for( const Sentinel& sentinel : sentinels) {
+			// the sentinel text includes the terminator
+			if( sentinel.text.size() - 1 == fieldEnd - fieldStart &&
+				encoded.compare( fieldStart, fieldEnd - fieldStart + 1, sentinel.text) == 0) {
+				orderTemplate.segments_.push_back( encoded.substr( segmentStart, fieldStart - segmentStart));
+				orderTemplate.slots_.push_back( OrderTemplate::Slot{ sentinel.field, sentinel.format });
+				segmentStart = fieldEnd;
+				break;
+			}
+		}
+		fieldStart = fieldEnd + 1;
+	}
+	orderTemplate.segments_.push_back( encoded.substr( segmentStart));
+
+	// every field that varies must have been found exactly once. otherwise a sentinel collided
+	// with another field and the template can't be trusted
+	int orderIdSlots = 0, quantitySlots = 0, limitPriceSlots = 0;
+	for( const OrderTemplate::Slot& slot : orderTemplate.slots_) {
+		orderIdSlots += slot.field == OrderTemplate::Field::ORDER_ID;
+		quantitySlots += slot.field == OrderTemplate::Field::QUANTITY;
+		limitPriceSlots += slot.field == OrderTemplate::Field::LIMIT_PRICE;
+	}
+	if( orderIdSlots != 1 || quantitySlots != 1 || limitPriceSlots != (order.lmtPrice != UNSET_DOUBLE ? 1 : 0)) {
+		orderTemplate.segments_.clear();
+		orderTemplate.slots_.clear();
+		return orderTemplate;
+	}
+
+	orderTemplate.headerLength_ = headerLength;
+	orderTemplate.valid_ = true;
+	return orderTemplate;
+}
+
+bool EClient::placeOrder( const OrderTemplate& orderTemplate, OrderId id, double quantity, double limitPrice)
+{
+	// not connected?
+	if( !isConnected()) {
+		m_pEWrapper->error( id, NOT_CONNECTED.code(), NOT_CONNECTED.msg());
+		return true;
+	}
+
+	if( !orderTemplate.valid() || orderTemplate.serverVersion() != m_serverVersion) {
+		return false;
+	}
+
+	// the buffer keeps its capacity so that placing orders from a thread doesn't allocate
+	// after its first order
+	thread_local std::vector<char> buffer;
+	orderTemplate.encode( buffer, id, quantity, limitPrice);
+	sendEncoded( buffer.data(), buffer.size());
+	return true;
+}
+
+bool EClient::encodePlaceOrder( std::ostream& msg, OrderId id, const Contract& contract, const Order& order)
+{
 	// Not needed anymore validation
 	//if( m_serverVersion < MIN_SERVER_VER_SCALE_ORDERS) {
 	//	if( order.scaleNumComponents != UNSET_INTEGER ||
@@ -1178,7 +1307,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( contract.deltaNeutralContract) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support delta-neutral orders.");
-			return;
+			return false;
 		}
 	}
 
@@ -1186,7 +1315,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( order.scaleSubsLevelSize != UNSET_INTEGER) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support Subsequent Level Size for Scale orders.");
-			return;
+			return false;
 		}
 	}
 
@@ -1195,7 +1324,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !order.algoStrategy.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support algo orders.");
-			return;
+			return false;
 		}
 	}
 
@@ -1203,7 +1332,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if (order.notHeld) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support notHeld parameter.");
-			return;
+			return false;
 		}
 	}
 
@@ -1211,7 +1340,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !contract.secIdType.empty() || !contract.secId.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support secIdType and secId parameters.");
-			return;
+			return false;
 		}
 	}
 
@@ -1219,7 +1348,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( contract.conId > 0) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support conId parameter.");
-			return;
+			return false;
 		}
 	}
 
@@ -1227,7 +1356,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( order.exemptCode != -1) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support exemptCode parameter.");
-			return;
+			return false;
 		}
 	}
 
@@ -1240,7 +1369,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 			if( comboLeg->exemptCode != -1 ){
 				m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 					"  It does not support exemptCode parameter.");
-				return;
+				return false;
 			}
 		}
 	}
@@ -1249,7 +1378,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !order.hedgeType.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support hedge orders.");
-			return;
+			return false;
 		}
 	}
 
@@ -1257,7 +1386,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if (order.optOutSmartRouting) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support optOutSmartRouting parameter.");
-			return;
+			return false;
 		}
 	}
 
@@ -1269,7 +1398,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 			) {
 				m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 					"  It does not support deltaNeutral parameters: ConId, SettlingFirm, ClearingAccount, ClearingIntent.");
-				return;
+				return false;
 		}
 	}
 
@@ -1281,7 +1410,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 			) {
 				m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() + 
 					"  It does not support deltaNeutral parameters: OpenClose, ShortSale, ShortSaleSlot, DesignatedLocation.");
-				return;
+				return false;
 		}
 	}
 
@@ -1297,7 +1426,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 					m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 						"  It does not support Scale order parameters: PriceAdjustValue, PriceAdjustInterval, " +
 						"ProfitOffset, AutoReset, InitPosition, InitFillQty and RandomPercent");
-					return;
+					return false;
 			}
 		}
 	}
@@ -1311,7 +1440,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 			if( orderComboLeg->price != UNSET_DOUBLE) {
 				m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 					"  It does not support per-leg prices for order combo legs.");
-				return;
+				return false;
 			}
 		}
 	}
@@ -1320,7 +1449,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if (order.trailingPercent != UNSET_DOUBLE) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support trailing percent parameter");
-			return;
+			return false;
 		}
 	}
 
@@ -1328,7 +1457,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !contract.tradingClass.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support tradingClass parameter in placeOrder.");
-			return;
+			return false;
 		}
 	}
 
@@ -1336,7 +1465,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !order.scaleTable.empty() || !order.activeStartTime.empty() || !order.activeStopTime.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support scaleTable, activeStartTime and activeStopTime parameters");
-			return;
+			return false;
 		}
 	}
 
@@ -1344,7 +1473,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !order.algoId.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support algoId parameter");
-			return;
+			return false;
 		}
 	}
 
@@ -1352,7 +1481,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if (order.solicited) {
 			m_pEWrapper->error(id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support order solicited parameter.");
-			return;
+			return false;
 		}
 	}
 
@@ -1360,7 +1489,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !order.modelCode.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support model code parameter.");
-			return;
+			return false;
 		}
 	}
 
@@ -1368,7 +1497,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if( !order.extOperator.empty()) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support ext operator parameter");
-			return;
+			return false;
 		}
 	}
 
@@ -1378,7 +1507,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		{
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				" It does not support soft dollar tier");
-			return;
+			return false;
 		}
 	}
 
@@ -1386,7 +1515,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
 		if (order.cashQty != UNSET_DOUBLE) {
 			m_pEWrapper->error( id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
 				"  It does not support cash quantity parameter");
-			return;
+			return false;
 		}
 	}
 
@@ -1395,7 +1524,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
             || !order.mifid2DecisionAlgo.empty())) {
             m_pEWrapper->error(id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
                 " It does not support MIFID II decision maker parameters");
-            return;
+            return false;
     }
 
     if (m_serverVersion < MIN_SERVER_VER_MIFID_EXECUTION
@@ -1403,18 +1532,16 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
             || !order.mifid2ExecutionAlgo.empty())) {
             m_pEWrapper->error(id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
                 " It does not support MIFID II execution parameters");
-            return;
+            return false;
     }
 
     if (m_serverVersion < MIN_SERVER_VER_AUTO_PRICE_FOR_HEDGE
         && order.dontUseAutoPriceForHedge) {
             m_pEWrapper->error(id, UPDATE_TWS.code(), UPDATE_TWS.msg() +
                 " It does not support don't use auto price for hedge parameter");
-            return;
+            return false;
     }
 
-	std::stringstream msg;
-	prepareBuffer( msg);
 
 	int VERSION = (m_serverVersion < MIN_SERVER_VER_NOT_HELD) ? 27 : 45;
 
@@ -1813,7 +1940,7 @@ void EClient::placeOrder( OrderId id, const Contract& contract, const Order& ord
         ENCODE_FIELD(order.dontUseAutoPriceForHedge);
     }
 
-	closeAndSend( msg.str());
+	return true;
 }
 
 void EClient::cancelOrder( OrderId id)
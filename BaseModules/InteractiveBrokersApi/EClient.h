@@ -13,6 +13,7 @@
 #include "CommonDefs.h"
 #include "TagValue.h"
 #include "Contract.h"
+#include "OrderTemplate.h"
 
 namespace ibapi {
 namespace client_constants {
@@ -267,6 +268,12 @@ public:
 		const std::string& genericTicks, bool snapshot, bool regulatorySnaphsot, const TagValueListSPtr& mktDataOptions);
 	void cancelMktData(TickerId id);
 	void placeOrder(OrderId id, const Contract& contract, const Order& order);
+
+	// order fast path. the template is encoded once for a contract, order type and action. placing
+	// an order from it only writes the order id, quantity and limit price. returns false without
+	// sending anything if the template was not encoded for the current server version
+	OrderTemplate createOrderTemplate(const Contract& contract, const Order& order);
+	bool placeOrder(const OrderTemplate& orderTemplate, OrderId id, double quantity, double limitPrice);
 	void cancelOrder(OrderId id) ;
 	void reqOpenOrders();
 	void reqAccountUpdates(bool subscribe, const std::string& acctCode);
@@ -363,6 +370,10 @@ protected:
 	virtual void prepareBuffer(std::ostream&) const = 0;
 	virtual bool closeAndSend(std::string msg, unsigned offset = 0) = 0;
 	virtual int bufferedSend(const std::string& msg);
+	// sends a message which already has its length header. used by the order fast path
+	virtual bool sendEncoded(const char* buf, size_t sz);
+
+	bool encodePlaceOrder(std::ostream& msg, OrderId id, const Contract& contract, const Order& order);
 
 
    	// encoders
@@ -203,6 +203,17 @@ bool EClientSocket::closeAndSend(std::string msg, unsigned offset)
     return true;
 }
 
+bool EClientSocket::sendEncoded(const char* buf, size_t sz)
+{
+	assert( sz > 0);
+
+	// goes straight to the socket without copying the message into an EMessage first
+	if (getTransport()->bufferedSend(buf, sz) == -1)
+        return handleSocketError();
+
+    return true;
+}
+
 void EClientSocket::prepareBufferImpl(std::ostream& buf) const
 {
 	assert( m_useV100Plus);
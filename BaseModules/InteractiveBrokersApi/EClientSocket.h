@@ -19,6 +19,7 @@ protected:
     virtual void prepareBufferImpl(std::ostream&) const;
 	virtual void prepareBuffer(std::ostream&) const;
 	virtual bool closeAndSend(std::string msg, unsigned offset = 0);
+	virtual bool sendEncoded(const char* buf, size_t sz);
 
 public:
 
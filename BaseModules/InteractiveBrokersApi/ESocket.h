@@ -10,7 +10,6 @@ class ESocket :
     int m_fd;
 	std::vector<char> m_outBuffer;
 
-    int bufferedSend(const char* buf, size_t sz);
     int send(const char* buf, size_t sz);
     void CleanupBuffer(std::vector<char>& buffer, int processed);
 
@@ -19,6 +18,7 @@ public:
     virtual ~ESocket(void);
 
     int send(EMessage *pMsg);
+    int bufferedSend(const char* buf, size_t sz);
     bool isOutBufferEmpty() const;
     int sendBufferedData();
     void fd(int fd);
@@ -40,6 +40,7 @@
 
 const int PING_DEADLINE = 2; // seconds
 const int SLEEP_BETWEEN_PINGS = 30; // seconds
+const int FIRST_REQUEST_ID = 1000000000;
 
 ///////////////////////////////////////////////////////////
 									// member funcs
@@ -49,9 +50,11 @@ InteractiveBrokersApi::InteractiveBrokersApi() :
 	, m_pClient(new EClientSocket(this, &m_osSignal))
 	, m_sleepDeadline(0)
 	, m_orderId(0)
+	, m_requestId(FIRST_REQUEST_ID)
 	, m_pReader(0)
 	, m_extraAuth(false)
 	, ready(false)
+	, orderTemplates(std::make_shared<const OrderTemplateMap>())
 {
 }
 //! [socket_init]
@@ -206,6 +209,11 @@ void InteractiveBrokersApi::orderStatus(OrderId orderId, const std::string& stat
 
 	printf("OrderStatus. Id: %ld, Status: %s, Filled: %g, Remaining: %g, AvgFillPrice: %g, PermId: %d, LastFillPrice: %g, ClientId: %d, WhyHeld: %s, MktCapPrice: %g\n", orderId, status.c_str(), filled, remaining, avgFillPrice, permId, lastFillPrice, clientId, whyHeld.c_str(), mktCapPrice);
 	std::cout << std::endl;
+
+	if (orderStatusUpdateCallback != nullptr)
+	{
+		orderStatusUpdateCallback(orderId, status, filled, remaining);
+	}
 }
 //! [orderstatus]
 
@@ -265,6 +273,11 @@ void InteractiveBrokersApi::contractDetails(int reqId, const ContractDetails& co
 	printContractMsg(contractDetails.contract);
 	printContractDetailsMsg(contractDetails);
 	printf("ContractDetails end. ReqId: %d\n", reqId);
+
+	if (contractDetailsCallback != nullptr)
+	{
+		contractDetailsCallback(reqId, contractDetails);
+	}
 }
 //! [contractdetails]
 
@@ -369,11 +382,94 @@ void InteractiveBrokersApi::printBondContractDetailsMsg(const ContractDetails& c
 
 OrderId InteractiveBrokersApi::placeOrder(const Contract & contract, const Order & order)
 {
-	OrderId oid = m_orderId.fetch_add(1);
-	m_pClient->placeOrder(oid, contract, order);
+	OrderId oid = nextOrderId();
+	placeOrder(oid, contract, order);
 	return oid;
 }
 
+OrderId InteractiveBrokersApi::nextOrderId()
+{
+	return m_orderId.fetch_add(1);
+}
+
+void InteractiveBrokersApi::placeOrder(OrderId oid, const Contract & contract, const Order & order)
+{
+	m_pClient->placeOrder(oid, contract, order);
+}
+
+void InteractiveBrokersApi::placeTemplateOrder(OrderId oid, const Contract & contract, const std::string & action, double quantity, double limitPrice)
+{
+	const bool limit = limitPrice != UNSET_DOUBLE;
+	auto cachedTemplate = orderTemplate(contract, action, limit);
+	if (cachedTemplate != nullptr && m_pClient->placeOrder(*cachedTemplate, oid, quantity, limitPrice))
+	{
+		return;
+	}
+
+	// no template for this order or it could not be encoded for this server. use the generic encoder
+	placeOrder(oid, contract, limit ? OrderSamples::LimitOrder(action, quantity, limitPrice) : OrderSamples::MarketOrder(action, quantity));
+}
+
+namespace
+{
+	// a template is encoded from the whole contract, but only resolved contracts get one and those
+	// are the compact contracts which carry nothing but their conId and exchange. the conId alone
+	// identifies them
+	bool orderTemplateKey(const Contract & contract, const std::string & action, bool limit, uint64_t & key)
+	{
+		if (contract.conId <= 0)
+		{
+			return false;
+		}
+
+		uint64_t actionIndex = 0;
+		if (action == "BUY")
+		{
+			actionIndex = 0;
+		}
+		else if (action == "SELL")
+		{
+			actionIndex = 1;
+		}
+		else
+		{
+			return false;
+		}
+
+		key = (static_cast<uint64_t>(contract.conId) << 2) | (actionIndex << 1) | (limit ? 1 : 0);
+		return true;
+	}
+}
+
+std::shared_ptr<const OrderTemplate> InteractiveBrokersApi::orderTemplate(const Contract & contract, const std::string & action, bool limit)
+{
+	uint64_t key = 0;
+	if (!orderTemplateKey(contract, action, limit, key))
+	{
+		return nullptr;
+	}
+
+	// templates are tied to the server version. encode again after reconnecting to a different server
+	const int serverVersion = m_pClient->EClient::serverVersion();
+	{
+		auto templates = std::atomic_load(&orderTemplates);
+		auto cachedTemplate = templates->find(key);
+		if (cachedTemplate != templates->end() && cachedTemplate->second->serverVersion() == serverVersion)
+		{
+			return cachedTemplate->second;
+		}
+	}
+
+	// first order of this kind. two threads may both encode it, the last one simply wins
+	std::lock_guard<std::mutex> lock(orderTemplatesMtx);
+	auto templates = std::make_shared<OrderTemplateMap>(*std::atomic_load(&orderTemplates));
+	auto order = limit ? OrderSamples::LimitOrder(action, 1, 1) : OrderSamples::MarketOrder(action, 1);
+	auto createdTemplate = std::make_shared<const OrderTemplate>(m_pClient->createOrderTemplate(contract, order));
+	(*templates)[key] = createdTemplate;
+	std::atomic_store(&orderTemplates, std::shared_ptr<const OrderTemplateMap>(std::move(templates)));
+	return createdTemplate;
+}
+
 void InteractiveBrokersApi::cancelOrder(int orderId)
 {
 	m_pClient->cancelOrder(orderId);
@@ -384,6 +480,11 @@ void InteractiveBrokersApi::registerOrderStatusCallback(const OrderExecutionCall
 	orderStatusCallback = callback;
 }
 
+void InteractiveBrokersApi::registerOrderStatusUpdateCallback(const OrderStatusUpdateCallbackType & callback)
+{
+	orderStatusUpdateCallback = callback;
+}
+
 void InteractiveBrokersApi::registerRealtimeTickCallback(const RealtimeTickCallbackType & callback)
 {
 	realTimeTickCallback = callback;
@@ -415,9 +516,27 @@ void InteractiveBrokersApi::cancelRealtimeTicks(OrderId oid)
 	m_pClient->cancelTickByTickData(oid);
 }
 
+void InteractiveBrokersApi::registerContractDetailsCallback(const ContractDetailsCallbackType & callback, const ContractDetailsEndCallbackType & endCallback)
+{
+	contractDetailsCallback = callback;
+	contractDetailsEndCallback = endCallback;
+}
+
+int InteractiveBrokersApi::requestContractDetails(const Contract & contract)
+{
+	int reqId = m_requestId.fetch_add(1);
+	m_pClient->reqContractDetails(reqId, contract);
+	return reqId;
+}
+
 //! [contractdetailsend]
 void InteractiveBrokersApi::contractDetailsEnd(int reqId) {
 	printf("ContractDetailsEnd. %d\n", reqId);
+
+	if (contractDetailsEndCallback != nullptr)
+	{
+		contractDetailsEndCallback(reqId);
+	}
 }
 //! [contractdetailsend]
 
@@ -11,6 +11,7 @@
 #include "EClientSocket.h"
 #include "Tick.h"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
@@ -155,12 +156,26 @@ private:
 	// we need m_orderId to be synchronized since it is accessed and changed
 	// in multiple threads
 	std::atomic<OrderId> m_orderId;
+
+	// ids of requests which are not orders, such as contract details, so that they don't use up
+	// order ids. starts far above any order id so both can be told apart in error messages
+	std::atomic<int> m_requestId;
 	EReader *m_pReader;
 	bool m_extraAuth;
 	std::string m_bboExchange;
 
 	std::atomic<bool> ready;
 
+	// pre-encoded orders keyed by conId, action and order type. the map is immutable and replaced as
+	// a whole when a template is added, so placing an order only loads a shared pointer. only read
+	// through std::atomic_load. replaced under orderTemplatesMtx
+	using OrderTemplateMap = std::unordered_map<uint64_t, std::shared_ptr<const OrderTemplate>>;
+	std::shared_ptr<const OrderTemplateMap> orderTemplates;
+	std::mutex orderTemplatesMtx;
+
+	// returns nullptr for orders which don't get a template
+	std::shared_ptr<const OrderTemplate> orderTemplate(const Contract& contract, const std::string& action, bool limit);
+
 public:
 
 	// simply routes the order to ibapi. up to caller to create the proper order and contract
@@ -172,6 +187,20 @@ public:
 	void cancelOrder(int orderId);
 	void registerOrderStatusCallback(const OrderExecutionCallbackType& callback);
 
+	// reserves an order id without placing anything. lets the caller register whatever it needs
+	// for the order id before the order is placed with placeOrder(oid, ...)
+	OrderId nextOrderId();
+	void placeOrder(OrderId oid, const Contract& contract, const Order& order);
+
+	// fast path for market and limit orders. the message is pre-encoded once per contract, action and
+	// order type, then only the order id, quantity and price are written for each order. a limit
+	// price of UNSET_DOUBLE places a market order
+	void placeTemplateOrder(OrderId oid, const Contract& contract, const std::string& action, double quantity, double limitPrice);
+
+	// called with the order id, status, filled and remaining quantity on every order status message
+	using OrderStatusUpdateCallbackType = std::function<void(OrderId, const std::string&, double, double)>;
+	void registerOrderStatusUpdateCallback(const OrderStatusUpdateCallbackType& callback);
+
 
 	//
 	// This function is used to register the function which assigns realTimeTickCallback. 
@@ -187,6 +216,16 @@ public:
 	OrderId requestRealtimeTicks(const Contract & contract, const std::string & tickType, int numberOfTicks, bool ignoreSize);
 	void cancelRealtimeTicks(OrderId oid);
 
+	//
+	// Requests the contract details matching the given contract. Every match is passed to the contract
+	// details callback with the returned request id. The end callback is called once all the matches
+	// have been received.
+	//
+	using ContractDetailsCallbackType = std::function<void(int, const ContractDetails&)>;
+	using ContractDetailsEndCallbackType = std::function<void(int)>;
+	void registerContractDetailsCallback(const ContractDetailsCallbackType& callback, const ContractDetailsEndCallbackType& endCallback);
+	int requestContractDetails(const Contract& contract);
+
 public:
 
 
@@ -194,6 +233,9 @@ private:
 	// function callbacks for when updates are received from interactive broker. 
 	RealtimeTickCallbackType realTimeTickCallback;
 	OrderExecutionCallbackType orderStatusCallback;
+	OrderStatusUpdateCallbackType orderStatusUpdateCallback;
+	ContractDetailsCallbackType contractDetailsCallback;
+	ContractDetailsEndCallbackType contractDetailsEndCallback;
 
 };
 
@@ -145,6 +145,7 @@ struct Order
 		adjustedStopPrice = UNSET_DOUBLE;
 		adjustedStopLimitPrice = UNSET_DOUBLE;
 		adjustedTrailingAmount = UNSET_DOUBLE;
+		adjustableTrailingUnit = 0;
 		lmtPriceOffset = UNSET_DOUBLE;
 		extOperator = "";
 
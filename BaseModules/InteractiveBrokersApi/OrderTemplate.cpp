@@ -0,0 +1,58 @@
+#include "StdAfx.h"
+#include "OrderTemplate.h"
+
+#include <stdio.h>
+
+OrderTemplate::OrderTemplate()
+	: headerLength_(0)
+	, serverVersion_(0)
+	, valid_(false)
+{
+}
+
+bool OrderTemplate::valid() const
+{
+	return valid_;
+}
+
+int OrderTemplate::serverVersion() const
+{
+	return serverVersion_;
+}
+
+void OrderTemplate::encode(std::vector<char>& buffer, OrderId id, double quantity, double limitPrice) const
+{
+	buffer.clear();
+
+	char field[64];
+	for (size_t i = 0; i < slots_.size(); ++i)
+	{
+		buffer.insert(buffer.end(), segments_[i].begin(), segments_[i].end());
+
+		double value = limitPrice;
+		if (slots_[i].field == Field::ORDER_ID)
+		{
+			value = static_cast<double>(id);
+		}
+		else if (slots_[i].field == Field::QUANTITY)
+		{
+			value = quantity;
+		}
+
+		int length = slots_[i].format == Format::INTEGER ?
+			snprintf(field, sizeof(field), "%ld", static_cast<long>(value)) :
+			snprintf(field, sizeof(field), "%.10g", value);
+		buffer.insert(buffer.end(), field, field + length);
+	}
+	buffer.insert(buffer.end(), segments_.back().begin(), segments_.back().end());
+
+	// same as EClientSocket::encodeMsgLen. the length is sent in network byte order
+	if (headerLength_ == 4)
+	{
+		const size_t length = buffer.size() - headerLength_;
+		buffer[0] = static_cast<char>((length >> 24) & 0xff);
+		buffer[1] = static_cast<char>((length >> 16) & 0xff);
+		buffer[2] = static_cast<char>((length >> 8) & 0xff);
+		buffer[3] = static_cast<char>(length & 0xff);
+	}
+}
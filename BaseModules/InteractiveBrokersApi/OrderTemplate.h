@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "CommonDefs.h"
+
+//
+// Place order message pre-encoded for a fixed contract, order type and action. EClient encodes the
+// message once with the generic encoder, using sentinel values for the order id, the quantity and
+// the limit price, and the result is split around those fields. Placing an order from a template
+// only formats those three fields between the static segments, so the bytes sent are the same as
+// the generic encoder would produce for the same order.
+//
+// A template is only valid for the server version it was encoded with.
+//
+class TWSAPIDLLEXP OrderTemplate
+{
+public:
+	OrderTemplate();
+
+	bool valid() const;
+	int serverVersion() const;
+
+	// writes the whole message, including the length header if the connection uses one, to buffer
+	void encode(std::vector<char>& buffer, OrderId id, double quantity, double limitPrice) const;
+
+private:
+	friend class EClient;
+
+	enum class Field
+	{
+		ORDER_ID,
+		QUANTITY,
+		LIMIT_PRICE
+	};
+
+	// how the generic encoder wrote the field. integers are written with operator<< and
+	// decimals with %.10g
+	enum class Format
+	{
+		INTEGER,
+		DECIMAL
+	};
+
+	struct Slot
+	{
+		Field field;
+		Format format;
+	};
+
+	// segments_[i] is written before slots_[i]. the last segment is written after the last slot
+	std::vector<std::string> segments_;
+	std::vector<Slot> slots_;
+	size_t headerLength_;
+	int serverVersion_;
+	bool valid_;
+};
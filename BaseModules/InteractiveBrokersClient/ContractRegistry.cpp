@@ -0,0 +1,266 @@
+#include "ContractRegistry.h"
+#include <Windows.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace
+{
+	// each line is ticker,conId,primaryExchange
+	const char* CONTRACT_CACHE_FILE = "ContractCache.csv";
+	const char* CONTRACT_CACHE_VARIABLE = "TTM_CONTRACT_CACHE";
+
+	// primary exchanges of US stocks in order of preference. ib reports nasdaq listings either as
+	// NASDAQ or as ISLAND
+	const char* PRIMARY_EXCHANGES[] = { "NASDAQ", "ISLAND", "NYSE", "ARCA", "AMEX", "BATS" };
+
+	// returns the preference of the exchange, lower is better. unknown exchanges rank last
+	size_t exchangeRank(const std::string& primaryExchange)
+	{
+		const size_t numExchanges = sizeof(PRIMARY_EXCHANGES) / sizeof(PRIMARY_EXCHANGES[0]);
+		for (size_t rank = 0; rank < numExchanges; ++rank)
+		{
+			if (primaryExchange == PRIMARY_EXCHANGES[rank])
+			{
+				// both names of nasdaq share the same rank
+				return rank == 0 ? 1 : rank;
+			}
+		}
+		return numExchanges;
+	}
+}
+
+ContractRegistry::ContractRegistry(InteractiveBrokersApi& ibApi, const std::string& cacheFile) :
+	ibApi_(ibApi),
+	cacheFile_(cacheFile),
+	contracts_(std::make_shared<const ContractMap>())
+{
+	loadCache();
+}
+
+std::shared_ptr<const Contract> ContractRegistry::contract(const std::string& ticker)
+{
+	auto resolvedContract = find(ticker);
+	if (resolvedContract != nullptr)
+	{
+		return resolvedContract;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(contractsMtx_);
+		requestContract(ticker);
+	}
+
+	// not resolved yet. let ib resolve the symbol for this request
+	return std::make_shared<const Contract>(createUsContract(ticker));
+}
+
+bool ContractRegistry::resolve(const std::string& ticker, std::chrono::milliseconds timeout)
+{
+	if (find(ticker) != nullptr)
+	{
+		return true;
+	}
+
+	std::unique_lock<std::mutex> lock(contractsMtx_);
+	requestContract(ticker);
+	return resolvedCv_.wait_for(lock, timeout, [this, &ticker]()
+	{
+		return find(ticker) != nullptr || pendingTickers_.find(ticker) == pendingTickers_.end();
+	}) && find(ticker) != nullptr;
+}
+
+void ContractRegistry::contractDetails(int reqId, const ContractDetails& contractDetails)
+{
+	std::lock_guard<std::mutex> lock(contractsMtx_);
+	if (pendingRequests_.find(reqId) != pendingRequests_.end())
+	{
+		pendingMatches_[reqId].push_back(ResolvedContract{ contractDetails.contract.conId, contractDetails.contract.primaryExchange });
+	}
+}
+
+void ContractRegistry::contractDetailsEnd(int reqId)
+{
+	std::string ticker;
+	ResolvedContract resolved{ 0, "" };
+	bool matched = false;
+	{
+		std::lock_guard<std::mutex> lock(contractsMtx_);
+		auto request = pendingRequests_.find(reqId);
+		if (request == pendingRequests_.end())
+		{
+			return;
+		}
+		ticker = request->second;
+		pendingRequests_.erase(request);
+		pendingTickers_.erase(ticker);
+
+		auto match = pendingMatches_.find(reqId);
+		if (match != pendingMatches_.end())
+		{
+			matched = selectListing(match->second, resolved);
+			pendingMatches_.erase(match);
+			if (matched)
+			{
+				addContracts({ { ticker, resolved } });
+			}
+		}
+	}
+
+	// wake up the waiters whether the ticker was resolved or not. unresolved tickers will be
+	// requested again the next time they are used
+	resolvedCv_.notify_all();
+
+	if (matched)
+	{
+		appendCache(ticker, resolved);
+	}
+	else
+	{
+		std::cout << "Could not resolve contract for " << ticker << std::endl;
+	}
+}
+
+void ContractRegistry::requestContract(const std::string& ticker)
+{
+	if (pendingTickers_.find(ticker) != pendingTickers_.end() || !ibApi_.isReady())
+	{
+		return;
+	}
+
+	// leave the primary exchange out of the query so that symbols listed anywhere but nasdaq
+	// are matched too
+	auto queryContract = createUsContract(ticker);
+	queryContract.primaryExchange.clear();
+	auto reqId = ibApi_.requestContractDetails(queryContract);
+	pendingRequests_[reqId] = ticker;
+	pendingTickers_[ticker] = reqId;
+}
+
+std::shared_ptr<const Contract> ContractRegistry::find(const std::string& ticker) const
+{
+	auto contracts = std::atomic_load(&contracts_);
+	auto resolvedContract = contracts->find(ticker);
+	return resolvedContract != contracts->end() ? resolvedContract->second : nullptr;
+}
+
+void ContractRegistry::addContracts(const std::vector<std::pair<std::string, ResolvedContract>>& resolved)
+{
+	// symbols are resolved once per session at most, so copying the map keeps lookups lock free
+	// at little cost
+	auto contracts = std::make_shared<ContractMap>(*std::atomic_load(&contracts_));
+	for (const auto& resolvedContract : resolved)
+	{
+		(*contracts)[resolvedContract.first] = createCompactContract(resolvedContract.second);
+	}
+	std::atomic_store(&contracts_, std::shared_ptr<const ContractMap>(std::move(contracts)));
+}
+
+bool ContractRegistry::selectListing(const std::vector<ResolvedContract>& listings, ResolvedContract& selected)
+{
+	const ResolvedContract* best = nullptr;
+	size_t bestRank = 0;
+	bool ambiguous = false;
+	for (const auto& listing : listings)
+	{
+		const auto rank = exchangeRank(listing.primaryExchange);
+		if (best == nullptr || rank < bestRank)
+		{
+			best = &listing;
+			bestRank = rank;
+			ambiguous = false;
+		}
+		else if (rank == bestRank && listing.conId != best->conId)
+		{
+			ambiguous = true;
+		}
+	}
+
+	if (best == nullptr || ambiguous)
+	{
+		return false;
+	}
+	selected = *best;
+	return true;
+}
+
+void ContractRegistry::loadCache()
+{
+	std::vector<std::pair<std::string, ResolvedContract>> cachedContracts;
+	std::ifstream cacheFile(cacheFile_);
+	std::string line;
+	while (std::getline(cacheFile, line))
+	{
+		std::istringstream lineStream(line);
+		std::string ticker, conId, primaryExchange;
+		if (std::getline(lineStream, ticker, ',') && std::getline(lineStream, conId, ',') && std::getline(lineStream, primaryExchange))
+		{
+			try
+			{
+				cachedContracts.emplace_back(ticker, ResolvedContract{ std::stol(conId), primaryExchange });
+			}
+			catch (const std::exception&)
+			{
+				// skip corrupted lines. the ticker will simply be resolved again
+			}
+		}
+	}
+	addContracts(cachedContracts);
+}
+
+void ContractRegistry::appendCache(const std::string& ticker, const ResolvedContract& resolved)
+{
+	std::ofstream cacheFile(cacheFile_, std::ios::app);
+	cacheFile << ticker << "," << resolved.conId << "," << resolved.primaryExchange << "\n";
+}
+
+std::string ContractRegistry::defaultCacheFile()
+{
+	char path[MAX_PATH];
+	const auto variableLength = GetEnvironmentVariableA(CONTRACT_CACHE_VARIABLE, path, MAX_PATH);
+	if (variableLength > 0 && variableLength < MAX_PATH)
+	{
+		return path;
+	}
+
+	// the directory of the module this registry is compiled into
+	HMODULE module = nullptr;
+	if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+		reinterpret_cast<LPCSTR>(&ContractRegistry::defaultCacheFile), &module))
+	{
+		return CONTRACT_CACHE_FILE;
+	}
+
+	const auto pathLength = GetModuleFileNameA(module, path, MAX_PATH);
+	if (pathLength == 0 || pathLength >= MAX_PATH)
+	{
+		return CONTRACT_CACHE_FILE;
+	}
+
+	std::string cacheFile(path, pathLength);
+	cacheFile.erase(cacheFile.find_last_of("\\/") + 1);
+	return cacheFile + CONTRACT_CACHE_FILE;
+}
+
+std::shared_ptr<const Contract> ContractRegistry::createCompactContract(const ResolvedContract& resolved)
+{
+	// the conId alone identifies the contract and SMART lets ib route the order. every other field
+	// is left empty so that it is encoded as an empty string
+	auto compactContract = std::make_shared<Contract>();
+	compactContract->conId = resolved.conId;
+	compactContract->exchange = "SMART";
+	return compactContract;
+}
+
+Contract ContractRegistry::createUsContract(const std::string& ticker)
+{
+	Contract contract;
+	contract.symbol = ticker;
+	contract.secType = "STK";
+	contract.currency = "USD";
+	contract.exchange = "SMART";
+	// Specify the Primary Exchange attribute to avoid contract ambiguity
+	// (there is an ambiguity because there is also a MSFT contract with primary exchange = "AEB")
+	contract.primaryExchange = "ISLAND";
+	return contract;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../InteractiveBrokersApi/InteractiveBrokersApi.h"
+#include "../InteractiveBrokersApi/Contract.h"
+
+//
+// Resolves each US stock symbol to its IB contract id once and keeps the result in memory and in a
+// csv file on disk so that later sessions don't have to ask again. Once a symbol is resolved, orders
+// and data requests use a compact contract which only carries the conId and the SMART exchange. IB
+// doesn't need to look up the symbol again and the request can't be rejected as ambiguous.
+//
+// IB returns every listing of the symbol. The listing on the first of PRIMARY_EXCHANGES wins, so a
+// nasdaq stock resolves to its ISLAND listing and not to whatever listing happens to arrive first.
+// A symbol with several listings on its best exchange, or with several listings and none on a
+// known US exchange, is ambiguous and stays unresolved.
+//
+// Contracts are immutable once built. The resolved contracts are kept in an immutable map which is
+// replaced as a whole whenever a symbol is resolved, so looking up a contract for an order only
+// loads a shared pointer and never takes the registry lock.
+//
+class ContractRegistry
+{
+public:
+	// cacheFile is the csv file which keeps the resolved contracts between sessions
+	ContractRegistry(InteractiveBrokersApi& ibApi, const std::string& cacheFile);
+	ContractRegistry(const ContractRegistry& other) = delete;
+	ContractRegistry& operator=(const ContractRegistry& other) = delete;
+
+	// never blocks. returns the resolved contract of the ticker. if the ticker has not been resolved
+	// yet, requests the contract details in the background and returns a contract built from the symbol
+	std::shared_ptr<const Contract> contract(const std::string& ticker);
+
+	// requests the contract details if needed and waits for them up to timeout. meant to be called
+	// when subscribing to a symbol, before any order can be placed for it. returns false if the
+	// ticker could not be resolved in time
+	bool resolve(const std::string& ticker, std::chrono::milliseconds timeout);
+
+	// registered to the ib api contract details callbacks
+	void contractDetails(int reqId, const ContractDetails& contractDetails);
+	void contractDetailsEnd(int reqId);
+
+	// the TTM_CONTRACT_CACHE environment variable if set, otherwise ContractCache.csv next to
+	// the InteractiveBrokersClient dll, so that the cache doesn't depend on the working directory
+	static std::string defaultCacheFile();
+
+private:
+	InteractiveBrokersApi& ibApi_;
+	const std::string cacheFile_;
+
+	struct ResolvedContract
+	{
+		long conId;
+		std::string primaryExchange;
+	};
+
+	using ContractMap = std::unordered_map<std::string, std::shared_ptr<const Contract>>;
+
+	// only read through std::atomic_load. replaced under contractsMtx_
+	std::shared_ptr<const ContractMap> contracts_;
+
+	std::mutex contractsMtx_;
+	std::condition_variable resolvedCv_;
+
+	// requests waiting on ib. every listing of a request is kept until the end of the request
+	std::unordered_map<int, std::string> pendingRequests_;
+	std::unordered_map<std::string, int> pendingTickers_;
+	std::unordered_map<int, std::vector<ResolvedContract>> pendingMatches_;
+
+	std::shared_ptr<const Contract> find(const std::string& ticker) const;
+
+	// must be called under contractsMtx_
+	void requestContract(const std::string& ticker);
+	void addContracts(const std::vector<std::pair<std::string, ResolvedContract>>& resolved);
+
+	// returns false if none or more than one listing could be the one we want
+	static bool selectListing(const std::vector<ResolvedContract>& listings, ResolvedContract& selected);
+
+	void loadCache();
+	void appendCache(const std::string& ticker, const ResolvedContract& resolved);
+
+	static std::shared_ptr<const Contract> createCompactContract(const ResolvedContract& resolved);
+	static Contract createUsContract(const std::string& ticker);
+};
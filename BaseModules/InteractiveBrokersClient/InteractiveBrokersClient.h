@@ -28,6 +28,9 @@ public:
 
 	void unregisterFillNotification(int handle);
 
+	// false once the order has been fully filled, cancelled or unregistered
+	bool isOrderActive(int handle);
+
 private:
 
 	class InteractiveBrokersClientImpl;
@@ -0,0 +1,106 @@
+#include "OrderRegistry.h"
+
+OrderRegistry::OrderRegistry()
+{
+}
+
+void OrderRegistry::add(OrderId oid, int numShares, FillNotification fillNotification)
+{
+	auto& orderShard = shard(oid);
+	std::lock_guard<std::mutex> lock(orderShard.shardMtx);
+	orderShard.orders[oid] = OrderEntry{ numShares, std::move(fillNotification), false, std::thread::id() };
+}
+
+bool OrderRegistry::remove(OrderId oid)
+{
+	auto& orderShard = shard(oid);
+	std::unique_lock<std::mutex> lock(orderShard.shardMtx);
+	auto order = orderShard.orders.find(oid);
+	if (order == orderShard.orders.end())
+	{
+		return false;
+	}
+
+	// the order is being filled. it is retired as soon as its notification returns, which
+	// can't happen if the notification itself is what is removing it
+	if (order->second.dispatching)
+	{
+		if (order->second.dispatchingThread != std::this_thread::get_id())
+		{
+			orderShard.dispatched.wait(lock, [&orderShard, oid]()
+			{
+				return orderShard.orders.find(oid) == orderShard.orders.end();
+			});
+		}
+		return false;
+	}
+
+	orderShard.orders.erase(order);
+	return true;
+}
+
+bool OrderRegistry::contains(OrderId oid)
+{
+	auto& orderShard = shard(oid);
+	std::lock_guard<std::mutex> lock(orderShard.shardMtx);
+	return orderShard.orders.find(oid) != orderShard.orders.end();
+}
+
+void OrderRegistry::execution(OrderId oid, const Execution& execution)
+{
+	FillNotification fillNotification;
+	{
+		auto& orderShard = shard(oid);
+		std::lock_guard<std::mutex> lock(orderShard.shardMtx);
+		auto order = orderShard.orders.find(oid);
+		if (order == orderShard.orders.end() || order->second.dispatching || execution.cumQty < order->second.numShares)
+		{
+			return;
+		}
+
+		// the order is complete. the notification runs without holding the shard, the order
+		// is only retired once it returns
+		fillNotification = order->second.fillNotification;
+		order->second.dispatching = true;
+		order->second.dispatchingThread = std::this_thread::get_id();
+	}
+
+	// return the system time for now. ideally we should be using the server time
+	// from execution.time. however, it is in string and we need
+	// to account for dls ourselves.
+	try
+	{
+		fillNotification(execution.avgPrice, time(nullptr));
+	}
+	catch (...)
+	{
+		finishDispatch(oid);
+		throw;
+	}
+	finishDispatch(oid);
+}
+
+void OrderRegistry::finishDispatch(OrderId oid)
+{
+	auto& orderShard = shard(oid);
+	{
+		std::lock_guard<std::mutex> lock(orderShard.shardMtx);
+		orderShard.orders.erase(oid);
+	}
+	orderShard.dispatched.notify_all();
+}
+
+void OrderRegistry::status(OrderId oid, const std::string& orderStatus)
+{
+	// filled orders are retired by their last execution instead. ib does not guarantee
+	// that the filled status arrives after the execution details
+	if (orderStatus == "Cancelled" || orderStatus == "ApiCancelled" || orderStatus == "Inactive")
+	{
+		remove(oid);
+	}
+}
+
+OrderRegistry::Shard& OrderRegistry::shard(OrderId oid)
+{
+	return shards_[static_cast<size_t>(oid) % NUM_SHARDS];
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "../InteractiveBrokersApi/CommonDefs.h"
+#include "../InteractiveBrokersApi/Execution.h"
+
+//
+// Routes execution and status updates from ib api back to whoever placed the order. Orders are
+// sharded by order id so that strategy threads placing orders and the message processing thread
+// delivering executions only contend when they touch the same shard.
+//
+// Fill notifications are always called outside of the shard lock. An order is retired from the
+// registry once it is fully filled or reaches a terminal status (cancelled or inactive). The order
+// stays in the registry, marked as dispatching, while its fill notification runs so that removing
+// it waits for the notification to return. Whoever captured themselves in the notification can
+// remove it and then be destroyed.
+//
+class OrderRegistry
+{
+public:
+	using FillNotification = std::function<void(double, time_t)>;
+
+	OrderRegistry();
+	OrderRegistry(const OrderRegistry& other) = delete;
+	OrderRegistry& operator=(const OrderRegistry& other) = delete;
+
+	// must be called before the order is placed so that an early execution always finds it
+	void add(OrderId oid, int numShares, FillNotification fillNotification);
+
+	// removes the order without notifying. returns false if the order was already retired. if its
+	// fill notification is running on another thread, waits for it to return first
+	bool remove(OrderId oid);
+	bool contains(OrderId oid);
+
+	// notifies the owner of the order once the execution completes the order. we only support
+	// all or none orders so partial executions are ignored
+	void execution(OrderId oid, const Execution& execution);
+
+	// retires the order if the status is terminal
+	void status(OrderId oid, const std::string& orderStatus);
+
+private:
+	struct OrderEntry
+	{
+		int numShares;
+		FillNotification fillNotification;
+
+		// set while the fill notification runs outside of the lock
+		bool dispatching;
+		std::thread::id dispatchingThread;
+	};
+
+	static const size_t NUM_SHARDS = 16;
+
+	struct Shard
+	{
+		std::mutex shardMtx;
+		std::condition_variable dispatched;
+		std::unordered_map<OrderId, OrderEntry> orders;
+	};
+	std::array<Shard, NUM_SHARDS> shards_;
+
+	Shard& shard(OrderId oid);
+
+	// retires an order whose fill notification has returned
+	void finishDispatch(OrderId oid);
+};
@@ -0,0 +1,41 @@
+#include <atomic>
+#include <thread>
+#include "TestRunner.h"
+#include "../BaseAlgorithm/Account.h"
+
+TEST(AccountExposureIsOneFill)
+{
+	// the book goes back and forth between flat and 100 shares at 10, realizing 100 on every
+	// round trip. a read in the middle of a fill must still see one of the two
+	Account account;
+	auto& symbolBook = account.book("AAA");
+
+	std::atomic<bool> done(false);
+	std::thread filler([&account, &symbolBook, &done]()
+	{
+		for (int trip = 0; trip < 2000000; ++trip)
+		{
+			account.fill(symbolBook, 100, 10);
+			account.fill(symbolBook, -100, 11);
+		}
+		done = true;
+	});
+
+	int torn = 0;
+	while (!done)
+	{
+		auto symbolExposure = symbolBook.exposure();
+		const bool flat = symbolExposure.shares == 0 && symbolExposure.averagePrice == 0;
+		const bool open = symbolExposure.shares == 100 && symbolExposure.averagePrice == 10;
+		const auto trips = symbolExposure.realizedProfit / 100;
+		if ((!flat && !open) || trips != static_cast<int>(trips))
+		{
+			++torn;
+		}
+	}
+	filler.join();
+
+	CHECK(torn == 0);
+	CHECK(symbolBook.exposure().shares == 0);
+	CHECK_NEAR(symbolBook.exposure().realizedProfit, 2000000 * 100.0, 1e-6);
+}
@@ -0,0 +1,912 @@
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+#include "TestRunner.h"
+#include "../Indicators/Indicators.h"
+#include "../Indicators/AbsolutePriceOscillator.h"
+#include "../Indicators/AccumulationDistributionLine.h"
+#include "../Indicators/AccumulationDistributionOscillator.h"
+#include "../Indicators/AnnualizedHistoricalVolatility.h"
+#include "../Indicators/Aroon.h"
+#include "../Indicators/AroonOscillator.h"
+#include "../Indicators/AverageDirectionalMovementIndex.h"
+#include "../Indicators/AverageDirectionalMovementRating.h"
+#include "../Indicators/AveragePrice.h"
+#include "../Indicators/AverageTrueRange.h"
+#include "../Indicators/AwesomeOscillator.h"
+#include "../Indicators/BalanceOfPower.h"
+#include "../Indicators/BollingerBands.h"
+#include "../Indicators/ChaikinsVolatility.h"
+#include "../Indicators/ChandeMomentumOscillator.h"
+#include "../Indicators/CommodityChannelIndex.h"
+#include "../Indicators/Crossover.h"
+#include "../Indicators/DetrendedPriceOscillator.h"
+#include "../Indicators/DirectionalIndicator.h"
+#include "../Indicators/DirectionalMovement.h"
+#include "../Indicators/DirectionalMovementIndex.h"
+#include "../Indicators/DonchianChannel.h"
+#include "../Indicators/DoubleExponentialMovingAverage.h"
+#include "../Indicators/EaseOfMovement.h"
+#include "../Indicators/ExponentialDecay.h"
+#include "../Indicators/ExponentialMovingAverage.h"
+#include "../Indicators/FisherTransform.h"
+#include "../Indicators/ForecastOscillator.h"
+#include "../Indicators/HullMovingAverage.h"
+#include "../Indicators/KaufmanAdaptiveMovingAverage.h"
+#include "../Indicators/KlingerVolumeOscillator.h"
+#include "../Indicators/Lag.h"
+#include "../Indicators/LinearDecay.h"
+#include "../Indicators/LinearRegression.h"
+#include "../Indicators/LinearRegressionIntercept.h"
+#include "../Indicators/LinearRegressionSlope.h"
+#include "../Indicators/MarketFacilitationIndex.h"
+#include "../Indicators/MassIndex.h"
+#include "../Indicators/MathOperator.h"
+#include "../Indicators/MathTransform.h"
+#include "../Indicators/Maximum.h"
+#include "../Indicators/MeanDeviation.h"
+#include "../Indicators/MedianPrice.h"
+#include "../Indicators/MesaSineWave.h"
+#include "../Indicators/Minimum.h"
+#include "../Indicators/Momentum.h"
+#include "../Indicators/MoneyFlowIndex.h"
+#include "../Indicators/MovingAverageConvergenceDivergence.h"
+#include "../Indicators/NegativeVolumeIndex.h"
+#include "../Indicators/NormalizedAverageTrueRange.h"
+#include "../Indicators/OnBalanceVolume.h"
+#include "../Indicators/ParabolicSar.h"
+#include "../Indicators/PercentagePriceOscillator.h"
+#include "../Indicators/PositiveVolumeIndex.h"
+#include "../Indicators/Qstick.h"
+#include "../Indicators/RateOfChange.h"
+#include "../Indicators/RateOfChangeRatio.h"
+#include "../Indicators/RelativeStrengthIndex.h"
+#include "../Indicators/SimpleMovingAverage.h"
+#include "../Indicators/StandardDeviation.h"
+#include "../Indicators/StandardError.h"
+#include "../Indicators/StochasticOscillator.h"
+#include "../Indicators/StochasticRsi.h"
+#include "../Indicators/SumOverPeriod.h"
+#include "../Indicators/TimeSeriesForecast.h"
+#include "../Indicators/TriangularMovingAverage.h"
+#include "../Indicators/TripleExponentialMovingAverage.h"
+#include "../Indicators/Trix.h"
+#include "../Indicators/TrueRange.h"
+#include "../Indicators/TypicalPrice.h"
+#include "../Indicators/UltimateOscillator.h"
+#include "../Indicators/VariableIndexDynamicAverage.h"
+#include "../Indicators/Variance.h"
+#include "../Indicators/VerticalHorizontalFilter.h"
+#include "../Indicators/VolumeOscillator.h"
+#include "../Indicators/VolumeWeightedMovingAverage.h"
+#include "../Indicators/WeightedClosePrice.h"
+#include "../Indicators/WeightedMovingAverage.h"
+#include "../Indicators/WildersSmoothing.h"
+#include "../Indicators/WilliamsAccumulationDistribution.h"
+#include "../Indicators/WilliamsR.h"
+#include "../Indicators/ZeroLagExponentialMovingAverage.h"
+
+//
+// Checks every streaming indicator against a batch reference. The reference computes the closed bars
+// at once with computeIndicatorPoints, which must give exactly the points of computeIndicatorPoint
+// called with each closed bar in turn, and leave the indicator streaming on the same way. The
+// streaming side also follows each bar tick by tick, beginning the bar with its first tick and
+// recomputing it with every later one, the way charts and strategies drive the indicators. Replacing
+// the latest bar moves the running sums by the difference of the samples, so those points may differ
+// from the reference in the last bits.
+//
+// Batch and streaming share their kernels, so agreeing with each other doesn't make them right. The
+// indicators are also checked against naive references written from their definitions, which go over
+// the whole series or window again for every bar and share no code with the library.
+//
+namespace
+{
+	struct Bar
+	{
+		// the candle after each tick of the bar. the last one is the closed candle
+		std::vector<SamplePoint> ticks;
+	};
+
+	const std::vector<Bar>& testBars()
+	{
+		static const std::vector<Bar> bars = []()
+		{
+			std::mt19937 generator(7);
+			std::normal_distribution<double> move(0, 0.5);
+			std::vector<Bar> generated;
+			double price = 100;
+			for (int b = 0; b < 400; ++b)
+			{
+				Bar bar;
+				SamplePoint candle{};
+				const int ticks = 1 + generator() % 6;
+				for (int t = 0; t < ticks; ++t)
+				{
+					price = std::max(1.0, price + move(generator));
+					const double volume = 1 + generator() % 100;
+					if (t == 0)
+					{
+						candle = SamplePoint{ price, price, price, price, volume };
+					}
+					else
+					{
+						candle.high = std::max(candle.high, price);
+						candle.low = std::min(candle.low, price);
+						candle.close = price;
+						candle.volume += volume;
+					}
+					bar.ticks.push_back(candle);
+				}
+
+				// flat bars, where ranges and deviations are 0
+				if (b % 17 == 5)
+				{
+					for (auto& tick : bar.ticks)
+					{
+						tick.open = tick.high = tick.low = tick.close = 100;
+					}
+				}
+				generated.push_back(bar);
+			}
+			return generated;
+		}();
+		return bars;
+	}
+
+	std::vector<SamplePoint> closedCandles()
+	{
+		std::vector<SamplePoint> candles;
+		for (const auto& bar : testBars())
+		{
+			candles.push_back(bar.ticks.back());
+		}
+		return candles;
+	}
+
+	double closeOf(const SamplePoint& candle)
+	{
+		return candle.close;
+	}
+
+	double volumeOf(const SamplePoint& candle)
+	{
+		return candle.volume;
+	}
+
+	const SamplePoint& candleOf(const SamplePoint& candle)
+	{
+		return candle;
+	}
+
+	// relative error allowed for the bars followed tick by tick. the closed bars must match exactly
+	const double TICK_TOLERANCE = 1e-7;
+
+	bool sameValue(double actual, double expected, double tolerance)
+	{
+		if (std::isnan(actual) || std::isnan(expected))
+		{
+			return std::isnan(actual) && std::isnan(expected);
+		}
+		return actual == expected || std::fabs(actual - expected) <= tolerance * (1 + std::fabs(expected));
+	}
+
+	template<typename Points>
+	bool samePoints(const char* name, size_t bar, const Points& actual, const Points& expected, double tolerance = 0)
+	{
+		for (size_t i = 0; i < actual.size(); ++i)
+		{
+			if (!sameValue(actual[i], expected[i], tolerance))
+			{
+				std::cout.precision(17);
+				std::cout << name << " output " << i << " on bar " << bar << " is " << actual[i] << ", expected " << expected[i] << std::endl;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename T, typename Input, typename... Args>
+	void checkStreaming(const char* name, Input input, Args... args)
+	{
+		using Sample = typename std::decay<decltype(input(SamplePoint()))>::type;
+		const auto& bars = testBars();
+
+		std::vector<Sample> samples;
+		for (const auto& bar : bars)
+		{
+			samples.push_back(input(bar.ticks.back()));
+		}
+		T batch(args...);
+		std::vector<typename T::array_type> expected(samples.size());
+		computeIndicatorPoints(batch, samples.data(), samples.size(), expected.data());
+
+		// one closed bar at a time, then on from where the batch left off
+		T closedBars(args...);
+		for (size_t b = 0; b < samples.size() + 50; ++b)
+		{
+			const auto& sample = samples[b % samples.size()];
+			const auto points = closedBars.computeIndicatorPoint(sample);
+			const auto reference = b < samples.size() ? expected[b] : batch.computeIndicatorPoint(sample);
+
+			const bool same = samePoints(name, b, points, reference);
+			CHECK(same);
+			if (!same)
+			{
+				return;
+			}
+		}
+
+		T streaming(args...);
+		for (size_t b = 0; b < bars.size(); ++b)
+		{
+			typename T::array_type points{};
+			for (size_t t = 0; t < bars[b].ticks.size(); ++t)
+			{
+				points = updateIndicator(streaming, input(bars[b].ticks[t]), t == 0);
+			}
+
+			const bool same = samePoints(name, b, points, expected[b], TICK_TOLERANCE);
+			CHECK(same);
+			if (!same)
+			{
+				return;
+			}
+		}
+	}
+
+	// indicators of two values take the close and the open of each candle. expected has the value of
+	// every closed bar
+	template<typename T, typename... Args>
+	void checkPairStreaming(const char* name, const std::vector<double>& expectedValues, Args... args)
+	{
+		const auto& bars = testBars();
+		T streaming(args...);
+		for (size_t b = 0; b < bars.size(); ++b)
+		{
+			const typename T::array_type expected{ expectedValues[b] };
+
+			typename T::array_type points{};
+			for (size_t t = 0; t < bars[b].ticks.size(); ++t)
+			{
+				const auto& tick = bars[b].ticks[t];
+				points = t == 0 ? streaming.computeIndicatorPoint(tick.close, tick.open) : streaming.recomputeIndicatorPoint(tick.close, tick.open);
+			}
+
+			const bool same = samePoints(name, b, points, expected);
+			CHECK(same);
+			if (!same)
+			{
+				return;
+			}
+		}
+	}
+
+	// the last period values up to and including index
+	std::vector<double> window(const std::vector<double>& values, size_t index, size_t period)
+	{
+		const size_t first = index + 1 >= period ? index + 1 - period : 0;
+		return std::vector<double>(values.begin() + first, values.begin() + index + 1);
+	}
+
+	double mean(const std::vector<double>& values)
+	{
+		double sum = 0;
+		for (auto value : values)
+		{
+			sum += value;
+		}
+		return sum / values.size();
+	}
+
+	double meanDeviation(const std::vector<double>& values)
+	{
+		const auto average = mean(values);
+		double deviation = 0;
+		for (auto value : values)
+		{
+			deviation += std::fabs(value - average);
+		}
+		return deviation / values.size();
+	}
+
+	//
+	// Naive references. Each output is a series with a value for every closed bar, and the indicators
+	// seed and warm up the way their headers say: the exponential averages start at the first sample,
+	// Wilder's smoothing is the plain average until period bars are in, the first bar has no previous
+	// one to change from and the windows hold the bars so far until they are full.
+	//
+	using Series = std::vector<double>;
+
+	// relative error allowed between the running sums of the library and the sums done again
+	const double REFERENCE_TOLERANCE = 1e-9;
+
+	struct Candles
+	{
+		Series open;
+		Series high;
+		Series low;
+		Series close;
+		Series volume;
+	};
+
+	const Candles& referenceCandles()
+	{
+		static const Candles candles = []()
+		{
+			Candles columns;
+			for (const auto& candle : closedCandles())
+			{
+				columns.open.push_back(candle.open);
+				columns.high.push_back(candle.high);
+				columns.low.push_back(candle.low);
+				columns.close.push_back(candle.close);
+				columns.volume.push_back(candle.volume);
+			}
+			return columns;
+		}();
+		return candles;
+	}
+
+	Series emaReference(const Series& samples, unsigned int period)
+	{
+		const double alpha = 2.0 / (period + 1);
+		Series ema(samples.size());
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			ema[i] = i == 0 ? samples[0] : alpha * samples[i] + (1 - alpha) * ema[i - 1];
+		}
+		return ema;
+	}
+
+	Series wilderReference(const Series& samples, unsigned int period)
+	{
+		Series smoothed(samples.size());
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			smoothed[i] = i < period ? mean(Series(samples.begin(), samples.begin() + i + 1)) : (smoothed[i - 1] * (period - 1) + samples[i]) / period;
+		}
+		return smoothed;
+	}
+
+	Series highest(const Series& samples, unsigned int period)
+	{
+		Series result;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			const auto values = window(samples, i, period);
+			result.push_back(*std::max_element(values.begin(), values.end()));
+		}
+		return result;
+	}
+
+	Series lowest(const Series& samples, unsigned int period)
+	{
+		Series result;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			const auto values = window(samples, i, period);
+			result.push_back(*std::min_element(values.begin(), values.end()));
+		}
+		return result;
+	}
+
+	Series sum(const Series& samples, unsigned int period)
+	{
+		Series result;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			const auto values = window(samples, i, period);
+			result.push_back(mean(values) * values.size());
+		}
+		return result;
+	}
+
+	Series trueRangeReference(const Candles& candles)
+	{
+		Series range;
+		for (size_t i = 0; i < candles.close.size(); ++i)
+		{
+			range.push_back(candles.high[i] - candles.low[i]);
+			if (i > 0)
+			{
+				range[i] = std::max({ range[i], std::fabs(candles.high[i] - candles.close[i - 1]), std::fabs(candles.low[i] - candles.close[i - 1]) });
+			}
+		}
+		return range;
+	}
+
+	Series rsiReference(const Series& samples, unsigned int period)
+	{
+		Series gains(samples.size(), 0);
+		Series losses(samples.size(), 0);
+		for (size_t i = 1; i < samples.size(); ++i)
+		{
+			gains[i] = std::max(samples[i] - samples[i - 1], 0.0);
+			losses[i] = std::max(samples[i - 1] - samples[i], 0.0);
+		}
+		const auto averageGain = wilderReference(gains, period);
+		const auto averageLoss = wilderReference(losses, period);
+
+		Series rsi;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			if (averageLoss[i] == 0)
+			{
+				rsi.push_back(averageGain[i] > 0 ? 100 : 50);
+			}
+			else
+			{
+				rsi.push_back(100 - 100 / (1 + averageGain[i] / averageLoss[i]));
+			}
+		}
+		return rsi;
+	}
+
+	// Wilder's directional movement system
+	struct Directional
+	{
+		Series plusMovement;
+		Series minusMovement;
+		Series averageTrueRange;
+		Series plusIndicator;
+		Series minusIndicator;
+		Series movementIndex;
+		Series averageMovementIndex;
+	};
+
+	Directional directionalReference(const Candles& candles, unsigned int period)
+	{
+		const size_t count = candles.close.size();
+		Series plusMoves(count, 0);
+		Series minusMoves(count, 0);
+		for (size_t i = 1; i < count; ++i)
+		{
+			const auto up = candles.high[i] - candles.high[i - 1];
+			const auto down = candles.low[i - 1] - candles.low[i];
+			plusMoves[i] = up > down && up > 0 ? up : 0;
+			minusMoves[i] = down > up && down > 0 ? down : 0;
+		}
+
+		Directional system;
+		system.plusMovement = wilderReference(plusMoves, period);
+		system.minusMovement = wilderReference(minusMoves, period);
+		system.averageTrueRange = wilderReference(trueRangeReference(candles), period);
+		for (size_t i = 0; i < count; ++i)
+		{
+			const auto range = system.averageTrueRange[i];
+			system.plusIndicator.push_back(range > 0 ? 100 * system.plusMovement[i] / range : 0);
+			system.minusIndicator.push_back(range > 0 ? 100 * system.minusMovement[i] / range : 0);
+
+			const auto total = system.plusIndicator[i] + system.minusIndicator[i];
+			system.movementIndex.push_back(total > 0 ? 100 * std::fabs(system.plusIndicator[i] - system.minusIndicator[i]) / total : 0);
+		}
+		system.averageMovementIndex = wilderReference(system.movementIndex, period);
+		return system;
+	}
+
+	// value of the least squares line through the window of the bar, with its oldest sample at
+	// x = 1, offset bars after the bar
+	double regressionReference(const Series& samples, size_t index, unsigned int period, double offset)
+	{
+		const auto values = window(samples, index, period);
+		const double n = static_cast<double>(values.size());
+		const double meanX = (n + 1) / 2;
+		const double meanY = mean(values);
+
+		double covariance = 0;
+		double varianceX = 0;
+		for (size_t i = 0; i < values.size(); ++i)
+		{
+			const double x = static_cast<double>(i + 1);
+			covariance += (x - meanX) * (values[i] - meanY);
+			varianceX += (x - meanX) * (x - meanX);
+		}
+		const double slope = varianceX > 0 ? covariance / varianceX : 0;
+		return meanY + slope * (n + offset - meanX);
+	}
+
+	// number of bars since the extremum of the window of the bar, the latest one on ties
+	template<typename Compare>
+	Series ageOfExtremum(const Series& samples, unsigned int period, Compare moreExtreme)
+	{
+		Series ages;
+		for (size_t i = 0; i < samples.size(); ++i)
+		{
+			const size_t first = i + 1 >= period ? i + 1 - period : 0;
+			size_t extremum = first;
+			for (size_t j = first; j <= i; ++j)
+			{
+				if (!moreExtreme(samples[extremum], samples[j]))
+				{
+					extremum = j;
+				}
+			}
+			ages.push_back(static_cast<double>(i - extremum));
+		}
+		return ages;
+	}
+
+	// streams the bars tick by tick and checks every closed bar against the reference, an output
+	// series for each output of the indicator
+	template<typename T, typename Input, typename... Args>
+	void checkReference(const char* name, const std::vector<Series>& reference, Input input, Args... args)
+	{
+		const auto& bars = testBars();
+		T streaming(args...);
+		for (size_t b = 0; b < bars.size(); ++b)
+		{
+			typename T::array_type points{};
+			for (size_t t = 0; t < bars[b].ticks.size(); ++t)
+			{
+				points = updateIndicator(streaming, input(bars[b].ticks[t]), t == 0);
+			}
+
+			typename T::array_type expected{};
+			for (size_t i = 0; i < expected.size(); ++i)
+			{
+				expected[i] = reference[i][b];
+			}
+
+			const bool same = samePoints(name, b, points, expected, REFERENCE_TOLERANCE);
+			CHECK(same);
+			if (!same)
+			{
+				return;
+			}
+		}
+	}
+}
+
+TEST(StreamingIndicatorsMatchBatch)
+{
+	checkStreaming<AbsolutePriceOscillator>("AbsolutePriceOscillator", closeOf, 5, 13);
+	checkStreaming<AccumulationDistributionLine>("AccumulationDistributionLine", candleOf);
+	checkStreaming<AccumulationDistributionOscillator>("AccumulationDistributionOscillator", candleOf, 3, 10);
+	checkStreaming<AnnualizedHistoricalVolatility>("AnnualizedHistoricalVolatility", closeOf, 9);
+	checkStreaming<Aroon>("Aroon", candleOf, 9);
+	checkStreaming<AroonOscillator>("AroonOscillator", candleOf, 9);
+	checkStreaming<AverageDirectionalMovementIndex>("AverageDirectionalMovementIndex", candleOf, 9);
+	checkStreaming<AverageDirectionalMovementRating>("AverageDirectionalMovementRating", candleOf, 9);
+	checkStreaming<AveragePrice>("AveragePrice", candleOf);
+	checkStreaming<AverageTrueRange>("AverageTrueRange", candleOf, 9);
+	checkStreaming<AwesomeOscillator>("AwesomeOscillator", candleOf);
+	checkStreaming<BalanceOfPower>("BalanceOfPower", candleOf);
+	checkStreaming<BollingerBands>("BollingerBands", closeOf, 9, 2.0);
+	checkStreaming<ChaikinsVolatility>("ChaikinsVolatility", candleOf, 9);
+	checkStreaming<ChandeMomentumOscillator>("ChandeMomentumOscillator", closeOf, 9);
+	checkStreaming<CommodityChannelIndex>("CommodityChannelIndex", candleOf, 9);
+	checkStreaming<DetrendedPriceOscillator>("DetrendedPriceOscillator", closeOf, 9);
+	checkStreaming<DirectionalIndicator>("DirectionalIndicator", candleOf, 9);
+	checkStreaming<DirectionalMovement>("DirectionalMovement", candleOf, 9);
+	checkStreaming<DirectionalMovementIndex>("DirectionalMovementIndex", candleOf, 9);
+	checkStreaming<DonchianChannel>("DonchianChannel", candleOf, 9);
+	checkStreaming<DoubleExponentialMovingAverage>("DoubleExponentialMovingAverage", closeOf, 9);
+	checkStreaming<EaseOfMovement>("EaseOfMovement", candleOf);
+	checkStreaming<ExponentialDecay>("ExponentialDecay", closeOf, 9);
+	checkStreaming<ExponentialMovingAverage>("ExponentialMovingAverage", closeOf, 9);
+	checkStreaming<FisherTransform>("FisherTransform", candleOf, 9);
+	checkStreaming<ForecastOscillator>("ForecastOscillator", closeOf, 9);
+	checkStreaming<HullMovingAverage>("HullMovingAverage", closeOf, 9);
+	checkStreaming<KaufmanAdaptiveMovingAverage>("KaufmanAdaptiveMovingAverage", closeOf, 9);
+	checkStreaming<KlingerVolumeOscillator>("KlingerVolumeOscillator", candleOf, 5, 13);
+	checkStreaming<Lag>("Lag", closeOf, 9);
+	checkStreaming<LinearDecay>("LinearDecay", closeOf, 9);
+	checkStreaming<LinearRegression>("LinearRegression", closeOf, 9);
+	checkStreaming<LinearRegressionIntercept>("LinearRegressionIntercept", closeOf, 9);
+	checkStreaming<LinearRegressionSlope>("LinearRegressionSlope", closeOf, 9);
+	checkStreaming<MarketFacilitationIndex>("MarketFacilitationIndex", candleOf);
+	checkStreaming<MassIndex>("MassIndex", candleOf, 9);
+	checkStreaming<Maximum>("Maximum", closeOf, 9);
+	checkStreaming<MeanDeviation>("MeanDeviation", closeOf, 9);
+	checkStreaming<MedianPrice>("MedianPrice", candleOf);
+	checkStreaming<MesaSineWave>("MesaSineWave", closeOf, 9);
+	checkStreaming<Minimum>("Minimum", closeOf, 9);
+	checkStreaming<Momentum>("Momentum", closeOf, 9);
+	checkStreaming<MoneyFlowIndex>("MoneyFlowIndex", candleOf, 9);
+	checkStreaming<MovingAverageConvergenceDivergence>("MovingAverageConvergenceDivergence", closeOf, 5, 13, 4);
+	checkStreaming<NegativeVolumeIndex>("NegativeVolumeIndex", candleOf);
+	checkStreaming<NormalizedAverageTrueRange>("NormalizedAverageTrueRange", candleOf, 9);
+	checkStreaming<OnBalanceVolume>("OnBalanceVolume", candleOf);
+	checkStreaming<ParabolicSar>("ParabolicSar", candleOf, 0.02, 0.2);
+	checkStreaming<PercentagePriceOscillator>("PercentagePriceOscillator", closeOf, 5, 13);
+	checkStreaming<PositiveVolumeIndex>("PositiveVolumeIndex", candleOf);
+	checkStreaming<Qstick>("Qstick", candleOf, 9);
+	checkStreaming<RateOfChange>("RateOfChange", closeOf, 9);
+	checkStreaming<RateOfChangeRatio>("RateOfChangeRatio", closeOf, 9);
+	checkStreaming<RelativeStrengthIndex>("RelativeStrengthIndex", closeOf, 9);
+	checkStreaming<SimpleMovingAverage>("SimpleMovingAverage", closeOf, 9);
+	checkStreaming<StandardDeviation>("StandardDeviation", closeOf, 9);
+	checkStreaming<StandardError>("StandardError", closeOf, 9);
+	checkStreaming<StochasticOscillator>("StochasticOscillator", candleOf, 5, 3, 3);
+	checkStreaming<StochasticRsi>("StochasticRsi", closeOf, 9);
+	checkStreaming<SumOverPeriod>("SumOverPeriod", closeOf, 9);
+	checkStreaming<TimeSeriesForecast>("TimeSeriesForecast", closeOf, 9);
+	checkStreaming<TriangularMovingAverage>("TriangularMovingAverage", closeOf, 9);
+	checkStreaming<TripleExponentialMovingAverage>("TripleExponentialMovingAverage", closeOf, 9);
+	checkStreaming<Trix>("Trix", closeOf, 9);
+	checkStreaming<TrueRange>("TrueRange", candleOf);
+	checkStreaming<TypicalPrice>("TypicalPrice", candleOf);
+	checkStreaming<UltimateOscillator>("UltimateOscillator", candleOf, 3, 7, 14);
+	checkStreaming<VariableIndexDynamicAverage>("VariableIndexDynamicAverage", closeOf, 4, 13, 0.2);
+	checkStreaming<Variance>("Variance", closeOf, 9);
+	checkStreaming<VerticalHorizontalFilter>("VerticalHorizontalFilter", closeOf, 9);
+	checkStreaming<VolumeOscillator>("VolumeOscillator", volumeOf, 5, 10);
+	checkStreaming<VolumeWeightedMovingAverage>("VolumeWeightedMovingAverage", candleOf, 9);
+	checkStreaming<WeightedClosePrice>("WeightedClosePrice", candleOf);
+	checkStreaming<WeightedMovingAverage>("WeightedMovingAverage", closeOf, 9);
+	checkStreaming<WildersSmoothing>("WildersSmoothing", closeOf, 9);
+	checkStreaming<WilliamsAccumulationDistribution>("WilliamsAccumulationDistribution", candleOf);
+	checkStreaming<WilliamsR>("WilliamsR", candleOf, 9);
+	checkStreaming<ZeroLagExponentialMovingAverage>("ZeroLagExponentialMovingAverage", closeOf, 9);
+}
+
+TEST(StreamingMathIndicatorsMatchBatch)
+{
+	const MathTransform::Function functions[] = {
+		MathTransform::Function::ABSOLUTE_VALUE, MathTransform::Function::ARCTANGENT, MathTransform::Function::CEILING,
+		MathTransform::Function::COSINE, MathTransform::Function::DEGREE_CONVERSION, MathTransform::Function::FLOOR,
+		MathTransform::Function::NATURAL_LOG, MathTransform::Function::BASE_10_LOG, MathTransform::Function::RADIAN_CONVERSION,
+		MathTransform::Function::ROUND, MathTransform::Function::SINE, MathTransform::Function::SQUARE_ROOT,
+		MathTransform::Function::TANGENT, MathTransform::Function::HYPERBOLIC_TANGENT, MathTransform::Function::TRUNCATE };
+	for (auto function : functions)
+	{
+		checkStreaming<MathTransform>("MathTransform", closeOf, function);
+	}
+
+	const auto& candles = referenceCandles();
+	Series sums, differences, products, quotients, crossovers, crossanys;
+	for (size_t i = 0; i < candles.close.size(); ++i)
+	{
+		const auto first = candles.close[i];
+		const auto second = candles.open[i];
+		sums.push_back(first + second);
+		differences.push_back(first - second);
+		products.push_back(first * second);
+		quotients.push_back(second != 0 ? first / second : 0);
+
+		const bool above = i > 0 && first > second && candles.close[i - 1] <= candles.open[i - 1];
+		const bool below = i > 0 && first < second && candles.close[i - 1] >= candles.open[i - 1];
+		crossovers.push_back(above ? 1 : 0);
+		crossanys.push_back(above || below ? 1 : 0);
+	}
+
+	checkPairStreaming<MathOperator>("MathOperator", sums, MathOperator::Operator::ADDITION);
+	checkPairStreaming<MathOperator>("MathOperator", differences, MathOperator::Operator::SUBTRACTION);
+	checkPairStreaming<MathOperator>("MathOperator", products, MathOperator::Operator::MULTIPLICATION);
+	checkPairStreaming<MathOperator>("MathOperator", quotients, MathOperator::Operator::DIVISION);
+	checkPairStreaming<Crossover>("Crossover", crossovers, false);
+	checkPairStreaming<Crossover>("Crossany", crossanys, true);
+}
+
+TEST(WindowIndicatorsMatchBruteForce)
+{
+	const unsigned int period = 9;
+	const auto candles = closedCandles();
+	std::vector<double> closes, typicalPrices;
+	for (const auto& candle : candles)
+	{
+		closes.push_back(candle.close);
+		typicalPrices.push_back((candle.high + candle.low + candle.close) / 3);
+	}
+
+	SimpleMovingAverage simpleMovingAverage(period);
+	MeanDeviation meanDeviationIndicator(period);
+	CommodityChannelIndex commodityChannelIndex(period);
+	Maximum maximum(period);
+	Minimum minimum(period);
+	for (size_t c = 0; c < candles.size(); ++c)
+	{
+		const auto closeWindow = window(closes, c, period);
+		CHECK_NEAR(simpleMovingAverage.computeIndicatorPoint(closes[c])[SimpleMovingAverage::MOVING_AVERAGE], mean(closeWindow), 1e-9);
+		CHECK_NEAR(meanDeviationIndicator.computeIndicatorPoint(closes[c])[MeanDeviation::MEAN_DEVIATION], meanDeviation(closeWindow), 1e-9);
+		CHECK_NEAR(maximum.computeIndicatorPoint(closes[c])[Maximum::MAXIMUM], *std::max_element(closeWindow.begin(), closeWindow.end()), 1e-12);
+		CHECK_NEAR(minimum.computeIndicatorPoint(closes[c])[Minimum::MINIMUM], *std::min_element(closeWindow.begin(), closeWindow.end()), 1e-12);
+
+		const auto typicalWindow = window(typicalPrices, c, period);
+		const auto deviation = meanDeviation(typicalWindow);
+		const auto expected = deviation > 0 ? (typicalPrices[c] - mean(typicalWindow)) / (0.015 * deviation) : 0;
+		CHECK_NEAR(commodityChannelIndex.computeIndicatorPoint(candles[c])[CommodityChannelIndex::COMMODITY_CHANNEL_INDEX], expected, 1e-7);
+	}
+}
+
+TEST(StreamingIndicatorsMatchReferences)
+{
+	const unsigned int period = 9;
+	const auto& candles = referenceCandles();
+	const auto& closes = candles.close;
+	const size_t count = closes.size();
+
+	// exponential averages
+	const auto ema = emaReference(closes, period);
+	const auto emaOfEma = emaReference(ema, period);
+	const auto emaOfEmaOfEma = emaReference(emaOfEma, period);
+	Series dema, tema, trix;
+	for (size_t i = 0; i < count; ++i)
+	{
+		dema.push_back(2 * ema[i] - emaOfEma[i]);
+		tema.push_back(3 * ema[i] - 3 * emaOfEma[i] + emaOfEmaOfEma[i]);
+		trix.push_back(i > 0 && emaOfEmaOfEma[i - 1] != 0 ? 100 * (emaOfEmaOfEma[i] - emaOfEmaOfEma[i - 1]) / emaOfEmaOfEma[i - 1] : 0);
+	}
+	checkReference<ExponentialMovingAverage>("ExponentialMovingAverage", { ema }, closeOf, period);
+	checkReference<DoubleExponentialMovingAverage>("DoubleExponentialMovingAverage", { dema }, closeOf, period);
+	checkReference<TripleExponentialMovingAverage>("TripleExponentialMovingAverage", { tema }, closeOf, period);
+	checkReference<Trix>("Trix", { trix }, closeOf, period);
+
+	// oscillators of two exponential averages
+	const auto shortEma = emaReference(closes, 5);
+	const auto longEma = emaReference(closes, 13);
+	Series macd, apo, ppo;
+	for (size_t i = 0; i < count; ++i)
+	{
+		macd.push_back(shortEma[i] - longEma[i]);
+		apo.push_back(shortEma[i] - longEma[i]);
+		ppo.push_back(longEma[i] != 0 ? 100 * (shortEma[i] - longEma[i]) / longEma[i] : 0);
+	}
+	const auto signal = emaReference(macd, 4);
+	Series histogram;
+	for (size_t i = 0; i < count; ++i)
+	{
+		histogram.push_back(macd[i] - signal[i]);
+	}
+	checkReference<MovingAverageConvergenceDivergence>("MovingAverageConvergenceDivergence", { macd, signal, histogram }, closeOf, 5, 13, 4);
+	checkReference<AbsolutePriceOscillator>("AbsolutePriceOscillator", { apo }, closeOf, 5, 13);
+	checkReference<PercentagePriceOscillator>("PercentagePriceOscillator", { ppo }, closeOf, 5, 13);
+
+	// relative strength
+	const auto rsi = rsiReference(closes, period);
+	const auto rsiHigh = highest(rsi, period);
+	const auto rsiLow = lowest(rsi, period);
+	Series stochasticRsi;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const auto range = rsiHigh[i] - rsiLow[i];
+		stochasticRsi.push_back(range > 0 ? (rsi[i] - rsiLow[i]) / range : 0);
+	}
+	checkReference<RelativeStrengthIndex>("RelativeStrengthIndex", { rsi }, closeOf, period);
+	checkReference<StochasticRsi>("StochasticRsi", { stochasticRsi }, closeOf, period);
+
+	// true range and the directional movement system
+	const auto system = directionalReference(candles, period);
+	Series normalizedRange, rating;
+	for (size_t i = 0; i < count; ++i)
+	{
+		normalizedRange.push_back(closes[i] != 0 ? 100 * system.averageTrueRange[i] / closes[i] : 0);
+		rating.push_back((system.averageMovementIndex[i] + system.averageMovementIndex[i + 1 >= period ? i + 1 - period : 0]) / 2);
+	}
+	checkReference<AverageTrueRange>("AverageTrueRange", { system.averageTrueRange }, candleOf, period);
+	checkReference<NormalizedAverageTrueRange>("NormalizedAverageTrueRange", { normalizedRange }, candleOf, period);
+	checkReference<DirectionalMovement>("DirectionalMovement", { system.plusMovement, system.minusMovement }, candleOf, period);
+	checkReference<DirectionalIndicator>("DirectionalIndicator", { system.plusIndicator, system.minusIndicator }, candleOf, period);
+	checkReference<DirectionalMovementIndex>("DirectionalMovementIndex", { system.movementIndex }, candleOf, period);
+	checkReference<AverageDirectionalMovementIndex>("AverageDirectionalMovementIndex", { system.averageMovementIndex }, candleOf, period);
+	checkReference<AverageDirectionalMovementRating>("AverageDirectionalMovementRating", { rating }, candleOf, period);
+
+	// kaufman adaptive moving average
+	Series kama;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const size_t first = i >= period ? i - period : 0;
+		double volatility = 0;
+		for (size_t j = std::max<size_t>(first + 1, 1); j <= i; ++j)
+		{
+			volatility += std::fabs(closes[j] - closes[j - 1]);
+		}
+		const double efficiency = volatility > 0 ? std::fabs(closes[i] - closes[first]) / volatility : 0;
+		const double smoothing = std::pow(efficiency * (2.0 / 3 - 2.0 / 31) + 2.0 / 31, 2);
+		kama.push_back(i == 0 ? closes[0] : kama[i - 1] + smoothing * (closes[i] - kama[i - 1]));
+	}
+	checkReference<KaufmanAdaptiveMovingAverage>("KaufmanAdaptiveMovingAverage", { kama }, closeOf, period);
+
+	// parabolic stop and reverse, starting on a rising trend from the first candle
+	Series sar(count);
+	{
+		const double step = 0.02;
+		const double maximum = 0.2;
+		bool rising = true;
+		double extreme = candles.high[0];
+		double acceleration = step;
+		sar[0] = candles.low[0];
+		for (size_t i = 1; i < count; ++i)
+		{
+			const size_t prior = i >= 2 ? i - 2 : 0;
+			double stop = sar[i - 1] + acceleration * (extreme - sar[i - 1]);
+			if (rising)
+			{
+				stop = std::min({ stop, candles.low[i - 1], candles.low[prior] });
+			}
+			else
+			{
+				stop = std::max({ stop, candles.high[i - 1], candles.high[prior] });
+			}
+
+			if (rising ? candles.low[i] < stop : candles.high[i] > stop)
+			{
+				stop = extreme;
+				rising = !rising;
+				extreme = rising ? candles.high[i] : candles.low[i];
+				acceleration = step;
+			}
+			else if (rising ? candles.high[i] > extreme : candles.low[i] < extreme)
+			{
+				extreme = rising ? candles.high[i] : candles.low[i];
+				acceleration = std::min(acceleration + step, maximum);
+			}
+			sar[i] = stop;
+		}
+	}
+	checkReference<ParabolicSar>("ParabolicSar", { sar }, candleOf, 0.02, 0.2);
+
+	// positions within the range of the window
+	const auto high5 = highest(candles.high, 5);
+	const auto low5 = lowest(candles.low, 5);
+	const auto highN = highest(candles.high, period);
+	const auto lowN = lowest(candles.low, period);
+	Series fastK, williamsR;
+	for (size_t i = 0; i < count; ++i)
+	{
+		fastK.push_back(high5[i] > low5[i] ? 100 * (closes[i] - low5[i]) / (high5[i] - low5[i]) : 0);
+		williamsR.push_back(highN[i] > lowN[i] ? -100 * (highN[i] - closes[i]) / (highN[i] - lowN[i]) : 0);
+	}
+	Series slowK, slowD;
+	for (size_t i = 0; i < count; ++i)
+	{
+		slowK.push_back(mean(window(fastK, i, 3)));
+	}
+	for (size_t i = 0; i < count; ++i)
+	{
+		slowD.push_back(mean(window(slowK, i, 3)));
+	}
+	checkReference<StochasticOscillator>("StochasticOscillator", { slowK, slowD }, candleOf, 5, 3, 3);
+	checkReference<WilliamsR>("WilliamsR", { williamsR }, candleOf, period);
+
+	const auto highAge = ageOfExtremum(candles.high, period + 1, std::greater<double>());
+	const auto lowAge = ageOfExtremum(candles.low, period + 1, std::less<double>());
+	Series aroonUp, aroonDown;
+	for (size_t i = 0; i < count; ++i)
+	{
+		aroonUp.push_back(100.0 * (period - highAge[i]) / period);
+		aroonDown.push_back(100.0 * (period - lowAge[i]) / period);
+	}
+	checkReference<Aroon>("Aroon", { aroonUp, aroonDown }, candleOf, period);
+
+	// volume
+	Series typicalPrices, positiveFlows(count, 0), negativeFlows(count, 0), closeVolumes;
+	for (size_t i = 0; i < count; ++i)
+	{
+		typicalPrices.push_back((candles.high[i] + candles.low[i] + closes[i]) / 3);
+		closeVolumes.push_back(closes[i] * candles.volume[i]);
+	}
+	for (size_t i = 1; i < count; ++i)
+	{
+		const auto flow = typicalPrices[i] * candles.volume[i];
+		positiveFlows[i] = typicalPrices[i] > typicalPrices[i - 1] ? flow : 0;
+		negativeFlows[i] = typicalPrices[i] < typicalPrices[i - 1] ? flow : 0;
+	}
+	const auto positiveFlow = sum(positiveFlows, period);
+	const auto negativeFlow = sum(negativeFlows, period);
+	const auto closeVolume = sum(closeVolumes, period);
+	const auto volume = sum(candles.volume, period);
+	Series moneyFlowIndex, volumeWeightedAverage;
+	for (size_t i = 0; i < count; ++i)
+	{
+		const auto total = positiveFlow[i] + negativeFlow[i];
+		moneyFlowIndex.push_back(total > 0 ? 100 * positiveFlow[i] / total : 0);
+		volumeWeightedAverage.push_back(volume[i] > 0 ? closeVolume[i] / volume[i] : closes[i]);
+	}
+	checkReference<MoneyFlowIndex>("MoneyFlowIndex", { moneyFlowIndex }, candleOf, period);
+	checkReference<VolumeWeightedMovingAverage>("VolumeWeightedMovingAverage", { volumeWeightedAverage }, candleOf, period);
+
+	// least squares line
+	Series regression, forecast, forecastOscillator;
+	for (size_t i = 0; i < count; ++i)
+	{
+		regression.push_back(regressionReference(closes, i, period, 0));
+		forecast.push_back(regressionReference(closes, i, period, 1));
+		forecastOscillator.push_back(i > 0 && closes[i] != 0 ? 100 * (closes[i] - forecast[i - 1]) / closes[i] : 0);
+	}
+	checkReference<LinearRegression>("LinearRegression", { regression }, closeOf, period);
+	checkReference<TimeSeriesForecast>("TimeSeriesForecast", { forecast }, closeOf, period);
+	checkReference<ForecastOscillator>("ForecastOscillator", { forecastOscillator }, closeOf, period);
+}
@@ -0,0 +1,92 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "TestRunner.h"
+#include "../InteractiveBrokersClient/OrderRegistry.h"
+
+namespace
+{
+	Execution completeExecution(double shares, double price)
+	{
+		Execution execution;
+		execution.cumQty = shares;
+		execution.avgPrice = price;
+		return execution;
+	}
+}
+
+TEST(OrderRegistryRetiresTerminalStatuses)
+{
+	OrderRegistry orderRegistry;
+	int fills = 0;
+	for (OrderId oid = 1; oid <= 4; ++oid)
+	{
+		orderRegistry.add(oid, 100, [&fills](double, time_t) { ++fills; });
+	}
+
+	orderRegistry.status(1, "Submitted");
+	orderRegistry.status(2, "Cancelled");
+	orderRegistry.status(3, "ApiCancelled");
+	orderRegistry.status(4, "Inactive");
+
+	CHECK(orderRegistry.contains(1));
+	CHECK(!orderRegistry.contains(2));
+	CHECK(!orderRegistry.contains(3));
+	CHECK(!orderRegistry.contains(4));
+
+	// a retired order is never notified
+	orderRegistry.execution(2, completeExecution(100, 10));
+	CHECK(fills == 0);
+}
+
+TEST(OrderRegistryNotifiesCompleteExecutionOnly)
+{
+	OrderRegistry orderRegistry;
+	double fillPrice = 0;
+	orderRegistry.add(1, 100, [&fillPrice](double price, time_t) { fillPrice = price; });
+
+	orderRegistry.execution(1, completeExecution(40, 10));
+	CHECK(fillPrice == 0);
+	CHECK(orderRegistry.contains(1));
+
+	orderRegistry.execution(1, completeExecution(100, 10.5));
+	CHECK(fillPrice == 10.5);
+	CHECK(!orderRegistry.contains(1));
+}
+
+TEST(OrderRegistryRemoveWaitsForRunningFill)
+{
+	OrderRegistry orderRegistry;
+	std::atomic<bool> fillStarted(false);
+	std::atomic<bool> fillReturned(false);
+	orderRegistry.add(1, 100, [&](double, time_t)
+	{
+		fillStarted = true;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		fillReturned = true;
+	});
+
+	std::thread messageThread([&orderRegistry]() { orderRegistry.execution(1, completeExecution(100, 10)); });
+	while (!fillStarted)
+	{
+		std::this_thread::yield();
+	}
+
+	// the owner unregisters while its notification runs. it may only go away once it returned
+	orderRegistry.remove(1);
+	CHECK(fillReturned);
+	CHECK(!orderRegistry.contains(1));
+	messageThread.join();
+}
+
+TEST(OrderRegistryRemoveFromOwnFill)
+{
+	OrderRegistry orderRegistry;
+	bool removed = true;
+	orderRegistry.add(1, 100, [&](double, time_t) { removed = orderRegistry.remove(1); });
+
+	// must not wait on itself
+	orderRegistry.execution(1, completeExecution(100, 10));
+	CHECK(!removed);
+	CHECK(!orderRegistry.contains(1));
+}
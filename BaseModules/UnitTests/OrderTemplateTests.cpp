@@ -0,0 +1,147 @@
+#include "../InteractiveBrokersApi/StdAfx.h"
+#include "../InteractiveBrokersApi/EClient.h"
+#include "../InteractiveBrokersApi/EMessage.h"
+#include "../InteractiveBrokersApi/ETransport.h"
+#include "../InteractiveBrokersApi/DefaultEWrapper.h"
+#include "../InteractiveBrokersApi/Contract.h"
+#include "../InteractiveBrokersApi/Order.h"
+#include "../InteractiveBrokersApi/OrderSamples.h"
+#include "TestRunner.h"
+
+namespace
+{
+	struct NullTransport : ETransport
+	{
+		int send(EMessage*) override { return 1; }
+	};
+
+	//
+	// Stands in for the server side of the socket. Keeps the last message the client sent, framed
+	// the same way EClientSocket frames it, so that the bytes of both encoders can be compared.
+	//
+	class MockServerClient : public EClient
+	{
+	public:
+		explicit MockServerClient(EWrapper* wrapper) :
+			EClient(wrapper, new NullTransport)
+		{
+		}
+
+		void connect(int serverVersion, bool useV100Plus)
+		{
+			m_useV100Plus = useV100Plus;
+			sendConnectRequest();
+			m_serverVersion = serverVersion;
+		}
+
+		const std::string& lastMessage() const
+		{
+			return lastMessage_;
+		}
+
+		void eDisconnect(bool) override {}
+
+	protected:
+		void prepareBufferImpl(std::ostream& buf) const override
+		{
+			char header[4] = { 0 };
+			buf.write(header, sizeof(header));
+		}
+
+		void prepareBuffer(std::ostream& buf) const override
+		{
+			if (m_useV100Plus)
+			{
+				prepareBufferImpl(buf);
+			}
+		}
+
+		bool closeAndSend(std::string msg, unsigned offset) override
+		{
+			if (m_useV100Plus)
+			{
+				// big endian length of the message after the header
+				const size_t length = msg.size() - 4 - offset;
+				for (int i = 0; i < 4; ++i)
+				{
+					msg[offset + i] = static_cast<char>((length >> (8 * (3 - i))) & 0xff);
+				}
+			}
+			lastMessage_ = msg;
+			return true;
+		}
+
+		bool sendEncoded(const char* buf, size_t sz) override
+		{
+			lastMessage_.assign(buf, sz);
+			return true;
+		}
+
+		int bufferedSend(const std::string&) override
+		{
+			return 1;
+		}
+
+	private:
+		int receive(char*, size_t) override { return 0; }
+		bool isSocketOK() const override { return true; }
+
+		std::string lastMessage_;
+	};
+}
+
+TEST(OrderTemplateMatchesGenericEncoder)
+{
+	DefaultEWrapper wrapper;
+
+	Contract symbolContract;
+	symbolContract.symbol = "AAPL";
+	symbolContract.secType = "STK";
+	symbolContract.currency = "USD";
+	symbolContract.exchange = "SMART";
+	symbolContract.primaryExchange = "ISLAND";
+
+	Contract compactContract;
+	compactContract.conId = 265598;
+	compactContract.exchange = "SMART";
+
+	const Contract contracts[] = { symbolContract, compactContract };
+	const int serverVersions[] = { 100, 101, 120, 130, 137, 140, 144, 148 };
+	for (int serverVersion : serverVersions)
+	{
+		for (bool useV100Plus : { false, true })
+		{
+			MockServerClient client(&wrapper);
+			client.connect(serverVersion, useV100Plus);
+			for (const auto& contract : contracts)
+			{
+				for (const char* action : { "BUY", "SELL" })
+				{
+					for (bool limit : { false, true })
+					{
+						const auto orderTemplate = client.createOrderTemplate(contract, limit ? OrderSamples::LimitOrder(action, 1, 1) : OrderSamples::MarketOrder(action, 1));
+						CHECK(orderTemplate.valid());
+						if (!orderTemplate.valid())
+						{
+							continue;
+						}
+
+						for (long orderId : { 1L, 42L, 1000000L, 2147483000L })
+						{
+							for (double quantity : { 1.0, 100.0, 2500.0, 33.5 })
+							{
+								for (double limitPrice : { 0.01, 12.34, 187.005, 1234.5678901 })
+								{
+									client.placeOrder(orderId, contract, limit ? OrderSamples::LimitOrder(action, quantity, limitPrice) : OrderSamples::MarketOrder(action, quantity));
+									const auto genericMessage = client.lastMessage();
+									CHECK(client.placeOrder(orderTemplate, orderId, quantity, limit ? limitPrice : UNSET_DOUBLE));
+									CHECK(client.lastMessage() == genericMessage);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,101 @@
+#include <random>
+#include <vector>
+#include "TestRunner.h"
+#include "../Indicators/IndicatorEngine.h"
+#include "../Indicators/IndicatorPipeline.h"
+#include "../Indicators/ExponentialMovingAverage.h"
+#include "../Indicators/Lag.h"
+#include "../Indicators/Momentum.h"
+#include "../Indicators/RelativeStrengthIndex.h"
+#include "../Indicators/SimpleMovingAverage.h"
+#include "../Indicators/StandardDeviation.h"
+#include "../Indicators/SumOverPeriod.h"
+#include "../Indicators/Variance.h"
+#include "../Indicators/WeightedMovingAverage.h"
+#include "../Indicators/WildersSmoothing.h"
+
+//
+// Each stage of IndicatorPipeline.h against the indicator of the same name, and the slope chain of
+// PatternBreak as a pipeline against the same chain in an IndicatorEngine, the way the algorithm adds
+// it to the feed. Every bar is followed tick by tick, so the replaced bars are checked too.
+//
+namespace
+{
+	// the prices of each bar, tick by tick. the last one is the close
+	const std::vector<std::vector<double>>& pipelineBars()
+	{
+		static const std::vector<std::vector<double>> bars = []()
+		{
+			std::mt19937 generator(5);
+			std::normal_distribution<double> move(0, 1);
+			std::vector<std::vector<double>> generated;
+			double price = 100;
+			for (int b = 0; b < 500; ++b)
+			{
+				std::vector<double> ticks;
+				const int count = 1 + generator() % 4;
+				for (int t = 0; t < count; ++t)
+				{
+					price += move(generator);
+					ticks.push_back(price);
+				}
+				generated.push_back(ticks);
+			}
+			return generated;
+		}();
+		return bars;
+	}
+
+	template<typename Stage, typename Indicator>
+	void checkStage(Stage stage, Indicator indicator)
+	{
+		for (const auto& bar : pipelineBars())
+		{
+			bool newBar = true;
+			for (auto price : bar)
+			{
+				CHECK_NEAR(stage.update(price, newBar), updateIndicator(indicator, price, newBar)[0], 1e-12);
+				newBar = false;
+			}
+		}
+	}
+}
+
+TEST(PipelineStagesMatchIndicators)
+{
+	checkStage(Pipeline::Sma<5>(), SimpleMovingAverage(5));
+	checkStage(Pipeline::Sum<7>(), SumOverPeriod(7));
+	checkStage(Pipeline::Wma<9>(), WeightedMovingAverage(9));
+	checkStage(Pipeline::Ema<10>(), ExponentialMovingAverage(10));
+	checkStage(Pipeline::Wilders<14>(), WildersSmoothing(14));
+	checkStage(Pipeline::Rsi<14>(), RelativeStrengthIndex(14));
+	checkStage(Pipeline::Variance<20>(), Variance(20));
+	checkStage(Pipeline::StdDev<20>(), StandardDeviation(20));
+	checkStage(Pipeline::Lag<3>(), Lag(3));
+	checkStage(Pipeline::Momentum<4>(), Momentum(4));
+	checkStage(Pipeline::Diff(), Momentum(1));
+}
+
+TEST(PatternBreakSlopePipelineMatchesEngine)
+{
+	IndicatorEngine engine;
+	auto priceSma = engine.add<SimpleMovingAverage>(IndicatorEngine::candle(IndicatorEngine::CLOSE), 5);
+	auto dPriceSma = engine.add<Momentum>(priceSma.output(SimpleMovingAverage::MOVING_AVERAGE), 1);
+	auto dPriceSmaSma = engine.add<SimpleMovingAverage>(dPriceSma.output(Momentum::MOMENTUM), 5);
+
+	auto slope = Pipeline::Sma<5>() | Pipeline::Diff() | Pipeline::Sma<5>();
+	for (const auto& bar : pipelineBars())
+	{
+		bool newBar = true;
+		for (auto price : bar)
+		{
+			engine.update(SamplePoint{ price, price, price, price, 0 }, newBar);
+			CHECK_NEAR(slope.update(price, newBar), engine.value(dPriceSmaSma.output(SimpleMovingAverage::MOVING_AVERAGE)), 1e-12);
+			newBar = false;
+		}
+	}
+
+	engine.release(dPriceSmaSma);
+	engine.release(dPriceSma);
+	engine.release(priceSma);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//
+// Minimal test runner for the base modules. TEST registers a function that main runs. A CHECK that
+// fails prints where it failed and fails the run, but doesn't stop the test, so a broken kernel
+// reports every bar it gets wrong.
+//
+struct TestCase
+{
+	std::string name;
+	std::function<void()> body;
+};
+
+std::vector<TestCase>& GetTestCases();
+
+// number of failed checks so far in the run
+int& FailedChecks();
+
+struct TestRegistration
+{
+	TestRegistration(const std::string& name, std::function<void()> body)
+	{
+		GetTestCases().push_back(TestCase{ name, body });
+	}
+};
+
+#define TEST(NAME)																			\
+	static void NAME();																		\
+	static TestRegistration NAME##Registration(#NAME, NAME);								\
+	static void NAME()
+
+#define CHECK(CONDITION)																	\
+	do																						\
+	{																						\
+		if (!(CONDITION))																	\
+		{																					\
+			++FailedChecks();																\
+			std::cout << __FILE__ << "(" << __LINE__ << "): check failed: " #CONDITION << std::endl;	\
+		}																					\
+	} while (false)
+
+#define CHECK_NEAR(ACTUAL, EXPECTED, TOLERANCE)												\
+	do																						\
+	{																						\
+		const double checkActual = (ACTUAL);												\
+		const double checkExpected = (EXPECTED);											\
+		if (!(std::fabs(checkActual - checkExpected) <= (TOLERANCE) * (1 + std::fabs(checkExpected))))	\
+		{																					\
+			++FailedChecks();																\
+			std::cout << __FILE__ << "(" << __LINE__ << "): " #ACTUAL " is " << checkActual << ", expected " << checkExpected << std::endl;	\
+		}																					\
+	} while (false)
@@ -0,0 +1,40 @@
+#include "TestRunner.h"
+
+std::vector<TestCase>& GetTestCases()
+{
+	static std::vector<TestCase> testCases;
+	return testCases;
+}
+
+int& FailedChecks()
+{
+	static int failedChecks = 0;
+	return failedChecks;
+}
+
+// runs every test, or the ones whose name contains the first argument
+int main(int argc, char* argv[])
+{
+	const std::string filter = argc > 1 ? argv[1] : "";
+	int failedTests = 0;
+	int ranTests = 0;
+	for (const auto& testCase : GetTestCases())
+	{
+		if (testCase.name.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		const auto failedBefore = FailedChecks();
+		testCase.body();
+		++ranTests;
+		if (FailedChecks() != failedBefore)
+		{
+			++failedTests;
+			std::cout << "FAILED " << testCase.name << std::endl;
+		}
+	}
+
+	std::cout << ranTests - failedTests << " of " << ranTests << " tests passed" << std::endl;
+	return failedTests == 0 ? 0 : 1;
+}
@@ -34,7 +34,13 @@ SOURCES += \
     volumeplot.cpp \
     indicatordialog.cpp \
     baseplot.cpp \
-    annotationplot.cpp
+    annotationplot.cpp \
+    candlepyramid.cpp \
+    annotationstore.cpp \
+    renderscheduler.cpp \
+    tickseries.cpp \
+    tickchart.cpp \
+    symbolcandles.cpp
 
 HEADERS += \
         qcustomplot.h \
@@ -47,7 +53,14 @@ HEADERS += \
     indicatorincludes.h \
     candleplot.h \
     annotationplot.h \
-    indicatorgraph.h
+    indicatorgraph.h \
+    candlepyramid.h \
+    annotationstore.h \
+    renderscheduler.h \
+    barhistory.h \
+    tickseries.h \
+    tickchart.h \
+    symbolcandles.h
 
 FORMS += \
     thetradingmachinemainwindow.ui \
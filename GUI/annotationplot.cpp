@@ -1,7 +1,7 @@
 #include "annotationplot.h"
 
-AnnotationPlot::AnnotationPlot(QCustomPlot& t_parentPlot) :
-    BasePlot (t_parentPlot)
+AnnotationPlot::AnnotationPlot(QCustomPlot& t_parentPlot, std::shared_ptr<SymbolCandles> feed) :
+    BasePlot (t_parentPlot, feed)
 {
     // since annotation plots don't have auto scaling, we
     // allow users to manually adjust the axes
@@ -13,13 +13,13 @@ AnnotationPlot::~AnnotationPlot()
 {
 }
 
-void AnnotationPlot::updatePlotAdd(const Candlestick &candle)
+void AnnotationPlot::updatePlotAdd(const SymbolCandles::Bar &bar)
 {
 
 }
 
 
-void AnnotationPlot::updatePlotReplace(const Candlestick &candle)
+void AnnotationPlot::updatePlotReplace(const SymbolCandles::Bar &bar)
 {
 
 }
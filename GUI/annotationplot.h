@@ -7,12 +7,12 @@ class AnnotationPlot : public BasePlot
 {
     Q_OBJECT
 public:
-    AnnotationPlot(QCustomPlot& t_parentPlot);
+    AnnotationPlot(QCustomPlot& t_parentPlot, std::shared_ptr<SymbolCandles> feed);
     ~AnnotationPlot() override;
 
     // override these functions to do nothing
-    void updatePlotAdd(const Candlestick &candle) override;
-    void updatePlotReplace(const Candlestick &candle) override;
+    void updatePlotAdd(const SymbolCandles::Bar &bar) override;
+    void updatePlotReplace(const SymbolCandles::Bar &bar) override;
     void pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot) override;
 
     // this is called periodically from an external event
@@ -0,0 +1,189 @@
+#include "annotationstore.h"
+#include <algorithm>
+#include <cmath>
+
+AnnotationStore::AnnotationStore() :
+    query_(0)
+{
+}
+
+void AnnotationStore::add(std::shared_ptr<Annotation::IAnnotation> annotation)
+{
+    if(annotation == nullptr)
+    {
+        return;
+    }
+
+    double lower;
+    double upper;
+    keyRange(*annotation, lower, upper);
+
+    auto index = entries_.size();
+    entries_.push_back(Entry{ std::move(annotation), lower, upper, query_ });
+
+    auto first = bucket(lower);
+    auto last = bucket(upper);
+    if(last - first >= MAX_BUCKETS)
+    {
+        wide_.push_back(index);
+        return;
+    }
+
+    for(auto key = first; key <= last; ++key)
+    {
+        buckets_[key].push_back(index);
+    }
+}
+
+size_t AnnotationStore::size() const
+{
+    return entries_.size();
+}
+
+std::vector<const Annotation::IAnnotation*> AnnotationStore::visible(double lower, double upper)
+{
+    std::vector<const Annotation::IAnnotation*> annotations;
+    ++query_;
+
+    auto take = [this, lower, upper, &annotations](size_t index)
+    {
+        auto& entry = entries_[index];
+        if(entry.query != query_ && entry.upper >= lower && entry.lower <= upper)
+        {
+            entry.query = query_;
+            annotations.push_back(entry.annotation.get());
+        }
+    };
+
+    // look up the buckets of the view, or go through the buckets there are if
+    // the view has more of them, which is when zoomed out over a sparse chart
+    auto first = bucket(lower);
+    auto last = bucket(upper);
+    if(last - first < static_cast<long long>(buckets_.size()))
+    {
+        for(auto key = first; key <= last; ++key)
+        {
+            auto bucketIt = buckets_.find(key);
+            if(bucketIt != buckets_.end())
+            {
+                std::for_each(bucketIt->second.begin(), bucketIt->second.end(), take);
+            }
+        }
+    }
+    else
+    {
+        for(const auto& bucketIt: buckets_)
+        {
+            if(bucketIt.first >= first && bucketIt.first <= last)
+            {
+                std::for_each(bucketIt.second.begin(), bucketIt.second.end(), take);
+            }
+        }
+    }
+    std::for_each(wide_.begin(), wide_.end(), take);
+
+    return annotations;
+}
+
+void AnnotationStore::keyRange(const Annotation::IAnnotation& annotation, double& lower, double& upper)
+{
+    switch(annotation.type_)
+    {
+        case Annotation::AnnotationType::LINE:
+        {
+            const auto& line = static_cast<const Annotation::Line&>(annotation);
+            lower = std::min(line.startX_, line.endX_);
+            upper = std::max(line.startX_, line.endX_);
+        }
+            break;
+
+        case Annotation::AnnotationType::DOT:
+        {
+            const auto& dot = static_cast<const Annotation::Dot&>(annotation);
+            lower = upper = dot.x_;
+        }
+            break;
+
+        case Annotation::AnnotationType::CIRCLE:
+        {
+            const auto& circle = static_cast<const Annotation::Circle&>(annotation);
+            lower = circle.x_ - circle.radius_;
+            upper = circle.x_ + circle.radius_;
+        }
+            break;
+
+        case Annotation::AnnotationType::LABEL:
+        {
+            const auto& label = static_cast<const Annotation::Label&>(annotation);
+            lower = upper = label.x_;
+        }
+            break;
+
+        case Annotation::AnnotationType::BOX:
+        {
+            const auto& box = static_cast<const Annotation::Box&>(annotation);
+            lower = std::min(box.upperLeftX_, box.lowerRightX_);
+            upper = std::max(box.upperLeftX_, box.lowerRightX_);
+        }
+            break;
+
+        default:
+            lower = upper = 0;
+            break;
+    }
+}
+
+void AnnotationStore::anchor(const Annotation::IAnnotation& annotation, double& x, double& y)
+{
+    switch(annotation.type_)
+    {
+        case Annotation::AnnotationType::LINE:
+        {
+            const auto& line = static_cast<const Annotation::Line&>(annotation);
+            x = line.endX_;
+            y = line.endY_;
+        }
+            break;
+
+        case Annotation::AnnotationType::DOT:
+        {
+            const auto& dot = static_cast<const Annotation::Dot&>(annotation);
+            x = dot.x_;
+            y = dot.y_;
+        }
+            break;
+
+        case Annotation::AnnotationType::CIRCLE:
+        {
+            const auto& circle = static_cast<const Annotation::Circle&>(annotation);
+            x = circle.x_;
+            y = circle.y_;
+        }
+            break;
+
+        case Annotation::AnnotationType::LABEL:
+        {
+            const auto& label = static_cast<const Annotation::Label&>(annotation);
+            x = label.x_;
+            y = label.y_;
+        }
+            break;
+
+        case Annotation::AnnotationType::BOX:
+        {
+            const auto& box = static_cast<const Annotation::Box&>(annotation);
+            x = (box.upperLeftX_ + box.lowerRightX_) / 2;
+            y = (box.upperLeftY_ + box.lowerRightY_) / 2;
+        }
+            break;
+
+        default:
+            x = y = 0;
+            break;
+    }
+}
+
+long long AnnotationStore::bucket(double key)
+{
+    return static_cast<long long>(std::floor(key / BUCKET_SECONDS));
+}
@@ -0,0 +1,55 @@
+#ifndef ANNOTATIONSTORE_H
+#define ANNOTATIONSTORE_H
+
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include "../BaseModules/BaseAlgorithm/Annotation.h"
+
+// annotations of a plot indexed by time. each annotation is kept in every bucket
+// of BUCKET_SECONDS its key range covers, so the ones in view are found by looking
+// at the buckets of the view only, however many trades the algorithm made
+class AnnotationStore
+{
+public:
+    static const int BUCKET_SECONDS = 3600;
+
+    // annotations covering more buckets than this are kept apart and always looked at
+    static const int MAX_BUCKETS = 64;
+
+    AnnotationStore();
+
+    void add(std::shared_ptr<Annotation::IAnnotation> annotation);
+    size_t size() const;
+
+    // the annotations whose key range overlaps [lower, upper], each once
+    std::vector<const Annotation::IAnnotation*> visible(double lower, double upper);
+
+    // the key range an annotation covers
+    static void keyRange(const Annotation::IAnnotation& annotation, double& lower, double& upper);
+
+    // the point that stands for the annotation when it is summarized with others.
+    // for lines this is their end, where the trade was closed
+    static void anchor(const Annotation::IAnnotation& annotation, double& x, double& y);
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<Annotation::IAnnotation> annotation;
+        double lower;
+        double upper;
+
+        // the query that last returned the entry, so that it is returned once
+        // even when it is in several of the buckets looked at
+        unsigned int query;
+    };
+
+    static long long bucket(double key);
+
+    std::vector<Entry> entries_;
+    std::unordered_map<long long, std::vector<size_t>> buckets_;
+    std::vector<size_t> wide_;
+    unsigned int query_;
+};
+
+#endif // ANNOTATIONSTORE_H
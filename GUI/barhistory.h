@@ -0,0 +1,171 @@
+#ifndef BARHISTORY_H
+#define BARHISTORY_H
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <QTemporaryFile>
+#include "qcustomplot.h"
+
+// bars kept in a data container by default, about two weeks of one minute candles
+const int DEFAULT_RETAINED_BARS = 20000;
+
+// keeps a QCP data container to a window of its latest bars so that a tab left running
+// uses the same memory after a week as after an hour. the bars that leave the window
+// are appended to a temporary file, which stays sorted since they always leave oldest
+// first, and are read back from it when the view is scrolled over them. only closed
+// bars may be in the container, a bar on disk never changes
+template<typename DataType>
+class BarHistory
+{
+    static_assert(std::is_trivially_copyable<DataType>::value, "bars are written to the file as they are");
+
+public:
+    // bars beyond the window are paged out this many at a time
+    static const int PAGE_BARS = 2000;
+
+    explicit BarHistory(QSharedPointer<QCPDataContainer<DataType>> data, int retainedBars = DEFAULT_RETAINED_BARS);
+
+    // call after adding bars. once there are a page too many, the oldest bars are
+    // paged out, except the ones in view
+    void trim(const QCPRange& view);
+
+    // reads back the bars paged out that are in view, or less than a view's width
+    // before it, so that scrolling on does not read the file at every step
+    void load(const QCPRange& view);
+
+    // container the history is kept for
+    QSharedPointer<QCPDataContainer<DataType>> data() const;
+
+private:
+    DataType record(qint64 index);
+
+    QSharedPointer<QCPDataContainer<DataType>> data_;
+    int retainedBars_;
+
+    QTemporaryFile file_;
+    qint64 records_;
+
+    // key of the latest bar in the file. bars up to it that are in the container were
+    // read back and are dropped again without being written
+    double fileUpper_;
+};
+
+template<typename DataType>
+BarHistory<DataType>::BarHistory(QSharedPointer<QCPDataContainer<DataType>> data, int retainedBars) :
+    data_(data),
+    retainedBars_(retainedBars),
+    records_(0),
+    fileUpper_(-std::numeric_limits<double>::max())
+{
+}
+
+template<typename DataType>
+void BarHistory<DataType>::trim(const QCPRange& view)
+{
+    if(data_->size() <= retainedBars_ + PAGE_BARS)
+    {
+        return;
+    }
+
+    // the bars before the window go unless they are in view
+    auto cutKey = std::min((data_->constBegin() + (data_->size() - retainedBars_))->sortKey(), view.lower);
+    auto cutEnd = data_->findBegin(cutKey, false);
+    if(cutEnd == data_->constBegin())
+    {
+        return;
+    }
+
+    if(!file_.isOpen() && !file_.open())
+    {
+        qDebug("Unable to open the bar history file, keeping the bars in memory");
+        return;
+    }
+
+    QVector<DataType> pagedOut;
+    for(auto it = data_->constBegin(); it != cutEnd; ++it)
+    {
+        if(it->sortKey() > fileUpper_)
+        {
+            pagedOut.append(*it);
+        }
+    }
+
+    if(!pagedOut.isEmpty())
+    {
+        auto bytes = static_cast<qint64>(pagedOut.size() * sizeof(DataType));
+        file_.seek(records_ * static_cast<qint64>(sizeof(DataType)));
+        if(file_.write(reinterpret_cast<const char*>(pagedOut.constData()), bytes) != bytes)
+        {
+            qDebug("Unable to write the bar history file, keeping the bars in memory");
+            return;
+        }
+        records_ += pagedOut.size();
+        fileUpper_ = pagedOut.back().sortKey();
+    }
+
+    data_->removeBefore(cutKey);
+}
+
+template<typename DataType>
+void BarHistory<DataType>::load(const QCPRange& view)
+{
+    if(records_ == 0)
+    {
+        return;
+    }
+
+    // everything before the first bar in the container is in the file
+    auto firstKey = data_->isEmpty() ? std::numeric_limits<double>::max() : data_->constBegin()->sortKey();
+    if(view.lower >= firstKey)
+    {
+        return;
+    }
+
+    // binary search for the first bar to read
+    auto fromKey = view.lower - view.size();
+    qint64 lower = 0;
+    qint64 upper = records_;
+    while(lower < upper)
+    {
+        auto middle = lower + (upper - lower) / 2;
+        if(record(middle).sortKey() < fromKey)
+        {
+            lower = middle + 1;
+        }
+        else
+        {
+            upper = middle;
+        }
+    }
+
+    QVector<DataType> pagedIn;
+    file_.seek(lower * static_cast<qint64>(sizeof(DataType)));
+    for(auto index = lower; index < records_; ++index)
+    {
+        DataType bar;
+        if(file_.read(reinterpret_cast<char*>(&bar), sizeof(DataType)) != static_cast<qint64>(sizeof(DataType)) || bar.sortKey() >= firstKey)
+        {
+            break;
+        }
+        pagedIn.append(bar);
+    }
+    data_->add(pagedIn, true);
+}
+
+template<typename DataType>
+QSharedPointer<QCPDataContainer<DataType>> BarHistory<DataType>::data() const
+{
+    return data_;
+}
+
+template<typename DataType>
+DataType BarHistory<DataType>::record(qint64 index)
+{
+    DataType bar;
+    file_.seek(index * static_cast<qint64>(sizeof(DataType)));
+    file_.read(reinterpret_cast<char*>(&bar), sizeof(DataType));
+    return bar;
+}
+
+#endif // BARHISTORY_H
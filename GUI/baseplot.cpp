@@ -1,11 +1,24 @@
 #include "baseplot.h"
 #include <QFont>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <map>
 
-BasePlot::BasePlot(QCustomPlot &t_parentPlot):
+BasePlot::BasePlot(QCustomPlot &t_parentPlot, std::shared_ptr<SymbolCandles> feed):
     QObject(&t_parentPlot),
     parentPlot_(t_parentPlot),
-    axisRect_(&t_parentPlot)
+    axisRect_(&t_parentPlot),
+    feed_(feed)
 {
+    // the first plot adds the live layer above the closed candles
+    if(parentPlot_.layer(LIVE_LAYER_NAME) == nullptr)
+    {
+        parentPlot_.addLayer(LIVE_LAYER_NAME, parentPlot_.layer("main"), QCustomPlot::limAbove);
+        parentPlot_.layer(LIVE_LAYER_NAME)->setMode(QCPLayer::lmBuffered);
+    }
+
     axisRect_.setRangeDrag(Qt::Horizontal);
     axisRect_.setRangeZoom(Qt::Horizontal);
 
@@ -52,6 +65,10 @@ BasePlot::BasePlot(QCustomPlot &t_parentPlot):
     }
 
     connect(axisRect_.axis(QCPAxis::atBottom), SIGNAL(rangeChanged(QCPRange)), this, SLOT(xAxisChanged(QCPRange)));
+    connect(axisRect_.axis(QCPAxis::atBottom), SIGNAL(rangeChanged(QCPRange)), this, SLOT(keyRangeChanged(QCPRange)));
+    annotationsChanged_ = false;
+    candleCount_ = 0;
+    usedLines_ = usedTexts_ = usedEllipses_ = usedRects_ = 0;
     autoScaleKeyAxis_ = true;
 }
 
@@ -60,6 +77,10 @@ BasePlot::~BasePlot()
 
 }
 
+void BasePlot::setTicks(std::shared_ptr<const TickSeries>)
+{
+}
+
 void BasePlot::addAnnotation(std::shared_ptr<Annotation::IAnnotation> t_annotation)
 {
     // pointer is coming in from user. check for validity
@@ -68,26 +89,189 @@ void BasePlot::addAnnotation(std::shared_ptr<Annotation::IAnnotation> t_annotati
         return;
     }
 
+    // the items are laid out again only if the annotation is in view
+    double lower;
+    double upper;
+    AnnotationStore::keyRange(*t_annotation, lower, upper);
+    auto range = axisRect_.axis(QCPAxis::atBottom)->range();
+    if(upper >= range.lower && lower <= range.upper)
+    {
+        annotationsChanged_ = true;
+    }
+    annotations_.add(std::move(t_annotation));
+}
+
+void BasePlot::refreshAnnotations()
+{
+    if(annotationsChanged_)
+    {
+        layoutAnnotations(axisRect_.axis(QCPAxis::atBottom)->range());
+    }
+}
+
+void BasePlot::keyRangeChanged(QCPRange range)
+{
+    if(annotations_.size() > 0)
+    {
+        layoutAnnotations(range);
+    }
+
+    std::unordered_set<std::shared_ptr<IIndicatorGraph>> loadedIndicators;
+    for(auto& activePlotIt: activeIndicatorPlots_)
+    {
+        if(loadedIndicators.insert(activePlotIt.second).second)
+        {
+            activePlotIt.second->loadHistory(range);
+        }
+    }
+}
+
+void BasePlot::recordCandle(time_t candleTime, const SamplePoint& candle, bool newBar)
+{
+    if(newBar || candles_.empty())
+    {
+        candleTimes_.push_back(candleTime);
+        candles_.push_back(candle);
+        ++candleCount_;
+        if(candles_.size() > static_cast<size_t>(DEFAULT_RETAINED_BARS))
+        {
+            candleTimes_.pop_front();
+            candles_.pop_front();
+        }
+    }
+    else
+    {
+        candleTimes_.back() = candleTime;
+        candles_.back() = candle;
+    }
+}
+
+// keep the indicatorPlot up to date with all the candles we currently have
+// this is used when we add an indicator after a graph has started
+// for a while already. we still want to be able to plot the indicator for
+// the previous candles
+void BasePlot::pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot)
+{
+    if(candles_.empty())
+    {
+        return;
+    }
+
+    // the work gets a copy of the closed candles. the candle still forming is taken
+    // with the ones that come while it runs, see finishBackfills
+    std::vector<time_t> candleTimes(candleTimes_.begin(), candleTimes_.end() - 1);
+    std::vector<SamplePoint> candles(candles_.begin(), candles_.end() - 1);
+    auto work = iplot->startBackfill(std::move(candleTimes), std::move(candles));
+    backfills_.push_back(PendingBackfill{ iplot, candleCount_ - 1, std::async(std::launch::async, work) });
+}
+
+bool BasePlot::finishBackfills()
+{
+    bool finished = false;
+    for(auto it = backfills_.begin(); it != backfills_.end();)
+    {
+        if(it->done.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            ++it;
+            continue;
+        }
+
+        // an indicator removed while its backfill ran is gone already
+        auto iplot = it->iplot.lock();
+        if(iplot != nullptr)
+        {
+            auto firstRecorded = candleCount_ - candles_.size();
+            auto from = static_cast<size_t>(std::max(it->from, firstRecorded) - firstRecorded);
+            std::vector<time_t> candleTimes(candleTimes_.begin() + from, candleTimes_.end());
+            std::vector<SamplePoint> candles(candles_.begin() + from, candles_.end());
+            iplot->finishBackfill(candleTimes, candles);
+            iplot->trimHistory(keptRange());
+            finished = true;
+        }
+        it = backfills_.erase(it);
+    }
+    return finished;
+}
+
+QCPRange BasePlot::keptRange() const
+{
+    if(autoScaleKeyAxis_)
+    {
+        return QCPRange(std::numeric_limits<double>::max(), std::numeric_limits<double>::max());
+    }
+    return axisRect_.axis(QCPAxis::atBottom)->range();
+}
+
+void BasePlot::layoutAnnotations(const QCPRange& range)
+{
+    annotationsChanged_ = false;
+    usedLines_ = usedTexts_ = usedEllipses_ = usedRects_ = 0;
+
+    // the annotations in view are grouped by the cell of CLUSTER_PIXELS they fall in.
+    // a cell with more of them than MAX_CLUSTER_SIZE shows their count instead, so the
+    // number of items drawn is bounded by the width of the plot
+    auto cellWidth = range.size() * CLUSTER_PIXELS / std::max(axisRect_.width(), 1);
+    std::map<long long, std::vector<const Annotation::IAnnotation*>> cells;
+    for(auto annotation: annotations_.visible(range.lower, range.upper))
+    {
+        double x;
+        double y;
+        AnnotationStore::anchor(*annotation, x, y);
+        cells[static_cast<long long>(std::floor(x / cellWidth))].push_back(annotation);
+    }
+
+    for(const auto& cell: cells)
+    {
+        if(cell.second.size() <= MAX_CLUSTER_SIZE)
+        {
+            for(auto annotation: cell.second)
+            {
+                drawAnnotation(*annotation);
+            }
+            continue;
+        }
+
+        double meanX = 0;
+        double meanY = 0;
+        for(auto annotation: cell.second)
+        {
+            double x;
+            double y;
+            AnnotationStore::anchor(*annotation, x, y);
+            meanX += x;
+            meanY += y;
+        }
+        meanX /= cell.second.size();
+        meanY /= cell.second.size();
+
+        auto textLabel = acquireItem(textPool_, usedTexts_);
+        textLabel->position->setCoords(meanX, meanY);
+        textLabel->setText(QString::number(cell.second.size()));
+        textLabel->setPen(QPen(QColor(128, 128, 128)));
+    }
+
+    // the items not used this time are kept hidden for the next layout
+    releaseItems(linePool_, usedLines_);
+    releaseItems(textPool_, usedTexts_);
+    releaseItems(ellipsePool_, usedEllipses_);
+    releaseItems(rectPool_, usedRects_);
+}
+
+void BasePlot::drawAnnotation(const Annotation::IAnnotation& t_annotation)
+{
     QPen pen;
-    pen.setColor(QColor(t_annotation->color_.red, t_annotation->color_.green, t_annotation->color_.blue));
+    pen.setColor(QColor(t_annotation.color_.red, t_annotation.color_.green, t_annotation.color_.blue));
 
-    switch(t_annotation->type_)
+    switch(t_annotation.type_)
     {
         case Annotation::AnnotationType::LINE:
         {
-            auto lineItem = new QCPItemLine(&parentPlot_);
-            auto lineAnnotation = std::dynamic_pointer_cast<Annotation::Line>(t_annotation);
-
-            // set to this axis rect
-            lineItem->setClipAxisRect(&axisRect_);
-            lineItem->start->setAxisRect(&axisRect_);
-            lineItem->end->setAxisRect(&axisRect_);
-            lineItem->start->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
-            lineItem->end->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+            auto lineItem = acquireItem(linePool_, usedLines_);
+            const auto& lineAnnotation = static_cast<const Annotation::Line&>(t_annotation);
 
             // set coords
-            lineItem->start->setCoords(lineAnnotation->startX_, lineAnnotation->startY_);
-            lineItem->end->setCoords(lineAnnotation->endX_, lineAnnotation->endY_);
+            lineItem->start->setCoords(lineAnnotation.startX_, lineAnnotation.startY_);
+            lineItem->end->setCoords(lineAnnotation.endX_, lineAnnotation.endY_);
 
             lineItem->setPen(pen);
 
@@ -96,17 +280,11 @@ void BasePlot::addAnnotation(std::shared_ptr<Annotation::IAnnotation> t_annotati
 
         case Annotation::AnnotationType::LABEL:
         {
-            auto textLabel = new QCPItemText(&parentPlot_);
-            auto textAnnotation = std::dynamic_pointer_cast<Annotation::Label>(t_annotation);
+            auto textLabel = acquireItem(textPool_, usedTexts_);
+            const auto& textAnnotation = static_cast<const Annotation::Label&>(t_annotation);
 
-            textLabel->setClipAxisRect(&axisRect_);
-            textLabel->position->setAxisRect(&axisRect_);
-            textLabel->position->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
-            textLabel->position->setType(QCPItemPosition::PositionType::ptPlotCoords);
-            textLabel->position->setCoords(textAnnotation->x_, textAnnotation->y_); // place position at center/top of axis rect
-
-            QFont serifFont("Times", 5, QFont::Bold);
-            textLabel->setText(QString(textAnnotation->text_.c_str()));
+            textLabel->position->setCoords(textAnnotation.x_, textAnnotation.y_); // place position at center/top of axis rect
+            textLabel->setText(QString(textAnnotation.text_.c_str()));
             textLabel->setPen(pen);
 
         }
@@ -114,19 +292,12 @@ void BasePlot::addAnnotation(std::shared_ptr<Annotation::IAnnotation> t_annotati
 
         case Annotation::AnnotationType::CIRCLE:
         {
-            auto circleItem = new QCPItemEllipse(&parentPlot_);
-            auto circleAnnotation = std::dynamic_pointer_cast<Annotation::Circle>(t_annotation);
-
-            // set to this axis rect
-            circleItem->setClipAxisRect(&axisRect_);
-            circleItem->topLeft->setAxisRect(&axisRect_);
-            circleItem->bottomRight->setAxisRect(&axisRect_);
-            circleItem->topLeft->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
-            circleItem->bottomRight->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+            auto circleItem = acquireItem(ellipsePool_, usedEllipses_);
+            const auto& circleAnnotation = static_cast<const Annotation::Circle&>(t_annotation);
 
             // set coords
-            circleItem->topLeft->setCoords(circleAnnotation->x_ - circleAnnotation->radius_, circleAnnotation->y_ + circleAnnotation->radius_);
-            circleItem->bottomRight->setCoords(circleAnnotation->x_ + circleAnnotation->radius_, circleAnnotation->y_ - circleAnnotation->radius_);
+            circleItem->topLeft->setCoords(circleAnnotation.x_ - circleAnnotation.radius_, circleAnnotation.y_ + circleAnnotation.radius_);
+            circleItem->bottomRight->setCoords(circleAnnotation.x_ + circleAnnotation.radius_, circleAnnotation.y_ - circleAnnotation.radius_);
 
             circleItem->setPen(pen);
         }
@@ -140,25 +311,12 @@ void BasePlot::addAnnotation(std::shared_ptr<Annotation::IAnnotation> t_annotati
 
         case Annotation::AnnotationType::BOX:
         {
-            auto boxItem = new QCPItemRect(&parentPlot_);
-            const auto boxAnnotation = std::dynamic_pointer_cast<Annotation::Box>(t_annotation);
-
-            auto upperLeftX = boxAnnotation->upperLeftX_;
-            auto upperLeftY = boxAnnotation->upperLeftY_;
-
-            auto lowerRightX = boxAnnotation->lowerRightX_;
-            auto lowerRightY = boxAnnotation->lowerRightY_;
-
-            // set to this axis rect
-            boxItem->setClipAxisRect(&axisRect_);
-            boxItem->topLeft->setAxisRect(&axisRect_);
-            boxItem->bottomRight->setAxisRect(&axisRect_);
-            boxItem->topLeft->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
-            boxItem->bottomRight->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+            auto boxItem = acquireItem(rectPool_, usedRects_);
+            const auto& boxAnnotation = static_cast<const Annotation::Box&>(t_annotation);
 
             // set coords
-            boxItem->topLeft->setCoords(upperLeftX, upperLeftY);
-            boxItem->bottomRight->setCoords(lowerRightX, lowerRightY);
+            boxItem->topLeft->setCoords(boxAnnotation.upperLeftX_, boxAnnotation.upperLeftY_);
+            boxItem->bottomRight->setCoords(boxAnnotation.lowerRightX_, boxAnnotation.lowerRightY_);
 
             boxItem->setPen(pen);
         }
@@ -168,6 +326,37 @@ void BasePlot::addAnnotation(std::shared_ptr<Annotation::IAnnotation> t_annotati
 
 }
 
+void BasePlot::attachItem(QCPItemLine* item)
+{
+    item->start->setAxisRect(&axisRect_);
+    item->end->setAxisRect(&axisRect_);
+    item->start->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+    item->end->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+}
+
+void BasePlot::attachItem(QCPItemText* item)
+{
+    item->position->setAxisRect(&axisRect_);
+    item->position->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+    item->position->setType(QCPItemPosition::PositionType::ptPlotCoords);
+}
+
+void BasePlot::attachItem(QCPItemEllipse* item)
+{
+    item->topLeft->setAxisRect(&axisRect_);
+    item->bottomRight->setAxisRect(&axisRect_);
+    item->topLeft->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+    item->bottomRight->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+}
+
+void BasePlot::attachItem(QCPItemRect* item)
+{
+    item->topLeft->setAxisRect(&axisRect_);
+    item->bottomRight->setAxisRect(&axisRect_);
+    item->topLeft->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+    item->bottomRight->setAxes(axisRect_.axis(QCPAxis::AxisType::atBottom), axisRect_.axis(QCPAxis::AxisType::atLeft));
+}
+
 bool BasePlot::inRect(QPoint pos)
 {
     auto xLowerBound = axisRect_.topLeft().x();
@@ -7,22 +7,37 @@
 #include "indicatorincludes.h"
 #include "../BaseModules/CandleMaker/CandleMaker.h"
 #include "../BaseModules/BaseAlgorithm/Annotation.h"
+#include "annotationstore.h"
+#include "symbolcandles.h"
+#include "tickseries.h"
+#include <deque>
+#include <future>
 #include <unordered_map>
 #include <unordered_set>
 #include <memory>
 #include <iostream>
 #include <string>
+#include <vector>
 
 class BasePlot : public QObject
 {
     Q_OBJECT
 public:
-    BasePlot(QCustomPlot& t_parentPlot);
+    BasePlot(QCustomPlot& t_parentPlot, std::shared_ptr<SymbolCandles> feed);
     virtual ~BasePlot();
 
-    virtual void updatePlotAdd(const Candlestick &candle) = 0;
-    virtual void updatePlotReplace(const Candlestick &candle) = 0;
-    virtual void pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot) = 0;
+    virtual void updatePlotAdd(const SymbolCandles::Bar &bar) = 0;
+    virtual void updatePlotReplace(const SymbolCandles::Bar &bar) = 0;
+
+    // the ticks the candles are made of, for the plots that draw them. none by default
+    virtual void setTicks(std::shared_ptr<const TickSeries> ticks);
+
+    // computes the indicator over the candles recorded before it was added, on another
+    // thread so that the window stays responsive however long the chart is
+    virtual void pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot);
+
+    // hands the backfills that are done over to their indicators. true if there were any
+    bool finishBackfills();
 
     // this is called periodically from an external event
     // it must be implemented by the derived class to determine
@@ -30,20 +45,76 @@ public:
     virtual void rescalePlot() = 0;
 
     // simply add the annotation to the default axis for now. later implementation will
-    // add the annotation to a chosen axis
+    // add the annotation to a chosen axis. the annotation is only stored, call
+    // refreshAnnotations once the new annotations are added to show them
     void addAnnotation(std::shared_ptr<Annotation::IAnnotation> t_annotation);
+    void refreshAnnotations();
 
     void menuShow(QPoint pos);
     bool inRect(QPoint pos);
 private:
     virtual void indicatorSelectionMenu(QPoint pos) = 0;
 
+    // annotations are drawn only for the visible range, see layoutAnnotations
+    static const int CLUSTER_PIXELS = 40;
+    static const size_t MAX_CLUSTER_SIZE = 4;
+
+    void layoutAnnotations(const QCPRange& range);
+    void drawAnnotation(const Annotation::IAnnotation& t_annotation);
+
+    // the items drawn for the annotations are taken from these pools and hidden, not
+    // deleted, when they are no longer needed. the first used_ of each pool are shown
+    template<typename Item>
+    Item* acquireItem(std::vector<Item*>& pool, size_t& used)
+    {
+        if(used == pool.size())
+        {
+            auto item = new Item(&parentPlot_);
+            item->setClipAxisRect(&axisRect_);
+            attachItem(item);
+            pool.push_back(item);
+        }
+        auto item = pool[used++];
+        item->setVisible(true);
+        return item;
+    }
+
+    template<typename Item>
+    static void releaseItems(std::vector<Item*>& pool, size_t used)
+    {
+        for(auto index = used; index < pool.size(); ++index)
+        {
+            pool[index]->setVisible(false);
+        }
+    }
+
+    void attachItem(QCPItemLine* item);
+    void attachItem(QCPItemText* item);
+    void attachItem(QCPItemEllipse* item);
+    void attachItem(QCPItemRect* item);
+
+    AnnotationStore annotations_;
+    bool annotationsChanged_;
+
+    std::vector<QCPItemLine*> linePool_;
+    std::vector<QCPItemText*> textPool_;
+    std::vector<QCPItemEllipse*> ellipsePool_;
+    std::vector<QCPItemRect*> rectPool_;
+    size_t usedLines_;
+    size_t usedTexts_;
+    size_t usedEllipses_;
+    size_t usedRects_;
+
 private slots:
     // there should be a way to define this in the base class instead of
     // letting the derived class define this function since the functionality is
     // generic for all derived classes. for now, we will use pure virtual
     virtual void xAxisChanged(QCPRange range) = 0;
 
+    // lays out the annotations for the new range and reads back the points of the
+    // indicators paged out before it
+    void keyRangeChanged(QCPRange range);
+
 protected:
 
     // keeping a reference to the parentPlot because this object is not responsible
@@ -55,6 +126,19 @@ protected:
 
     void removeIndicatorMenu(QPoint pos, QList<QCPAbstractPlottable*> plottables);
 
+    // the key range whose bars are kept in memory when a history is trimmed. none while
+    // the key axis follows the data, which then shows the retained window
+    QCPRange keptRange() const;
+
+    // records the candle as the plot's indicators take it, for the indicators added later
+    void recordCandle(time_t candleTime, const SamplePoint& candle, bool newBar);
+
+    // the candles and the indicators of the feed, which compute the indicators of every
+    // tab on it once per candle. graphs of the same indicator share its node. declared
+    // before activeIndicatorPlots_ so the graphs release their nodes before the engine
+    // goes away
+    std::shared_ptr<SymbolCandles> feed_;
+
     // to create a new indicator entry, we first instantiate an iplot and get the
     // associated plottables. we create an entry and map the plottable to the new iplot.
     // when we select a graph in qcp for removal, we first get back a qcpabstractplottable
@@ -66,6 +150,25 @@ protected:
 protected slots:
 
     void plotSelectSlot(bool selected);
+
+private:
+    // the latest candles of the plot, as many as a history keeps, and the number of
+    // candles recorded so far
+    std::deque<time_t> candleTimes_;
+    std::deque<SamplePoint> candles_;
+    unsigned long long candleCount_;
+
+    // a backfill running on another thread. from is the number of the first candle it
+    // did not take, the candle that was still forming. the work owns what it works on,
+    // so the indicator isn't kept alive by it and goes as soon as it is removed. declared
+    // after the engine and the indicators since its destruction waits for the work to finish
+    struct PendingBackfill
+    {
+        std::weak_ptr<IIndicatorGraph> iplot;
+        unsigned long long from;
+        std::future<void> done;
+    };
+    std::vector<PendingBackfill> backfills_;
 };
 
 #endif // IPLOT_H
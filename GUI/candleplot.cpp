@@ -1,23 +1,50 @@
 #include "candleplot.h"
 
-CandlePlot::CandlePlot(QCustomPlot& parentPlot):
-    BasePlot(parentPlot)
+CandlePlot::CandlePlot(QCustomPlot& parentPlot, std::shared_ptr<SymbolCandles> feed):
+    BasePlot(parentPlot, feed)
 {
     candleBars_ = new QCPFinancial(axisRect_.axis(QCPAxis::atBottom), axisRect_.axis(QCPAxis::atLeft));
     candleBars_->setWidthType(QCPFinancial::WidthType::wtPlotCoords);
-    candleBars_->setWidth(60);
+
+    // the candle still forming is drawn by its own bars on the live layer
+    liveBar_ = new QCPFinancial(axisRect_.axis(QCPAxis::atBottom), axisRect_.axis(QCPAxis::atLeft));
+    liveBar_->setWidthType(QCPFinancial::WidthType::wtPlotCoords);
+    liveBar_->setLayer(LIVE_LAYER_NAME);
+    liveBar_->setSelectable(QCP::stNone);
+
+    tickChart_ = new TickChart(axisRect_.axis(QCPAxis::atBottom), axisRect_.axis(QCPAxis::atLeft));
+    tickChart_->setLayer(LIVE_LAYER_NAME);
+    tickChart_->setSelectable(QCP::stNone);
+    tickChart_->setVisible(false);
+    tickMode_ = false;
+
+    // one container for each level of the pyramid. the bars show one of them at a time
+    for(size_t level = 0; level < pyramid_.levels(); ++level)
+    {
+        levelData_.push_back(QSharedPointer<QCPFinancialDataContainer>(new QCPFinancialDataContainer));
+        levelHistories_.emplace_back(new BarHistory<QCPFinancialData>(levelData_.back()));
+    }
+    level_ = pyramid_.levels();
+    showLevel(0);
 
     size_ = 0;
 }
 
 CandlePlot::~CandlePlot()
 {
+    if(tickMode_)
+    {
+        feed_->watchTicks(false);
+    }
 }
 
-void CandlePlot::updatePlotAdd(const Candlestick &candle)
+void CandlePlot::updatePlotAdd(const SymbolCandles::Bar &bar)
 {
+    const auto& candle = bar.candle;
+
     // add a new bar
-    candleBars_->addData(candle.time+30, candle.open, candle.high, candle.low, candle.close);
+    pyramid_.add(candle);
+    updateLevels();
     ++size_;
 
     // since activeIndicatorPlots_ entries map plottables to
@@ -26,32 +53,17 @@ void CandlePlot::updatePlotAdd(const Candlestick &candle)
     // to the same indicator. we use this unordered_set to mark
     // which has been updated as we traverse our entries
     std::unordered_set<std::shared_ptr<IIndicatorGraph>> updatedIndicators;
+    SamplePoint sample{ candle.open, candle.high, candle.low, candle.close, static_cast<double>(candle.volume) };
+    recordCandle(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, sample, true);
 
     // update all the indicators
+    auto kept = keptRange();
     for(auto& activePlotIt: activeIndicatorPlots_)
     {
         if(updatedIndicators.find(activePlotIt.second) == updatedIndicators.end())
         {
-            switch(activePlotIt.second->valueType)
-            {
-            case OhlcType::OPEN:
-                activePlotIt.second->updatePlotAdd( candle.time + 30, candle.open);
-                break;
-
-            case OhlcType::HIGH:
-                activePlotIt.second->updatePlotAdd( candle.time + 30, candle.high);
-                break;
-
-            case OhlcType::LOW:
-                activePlotIt.second->updatePlotAdd( candle.time + 30, candle.low);
-                break;
-
-            // close values as default
-            case OhlcType::CLOSE:
-            default:
-                activePlotIt.second->updatePlotAdd( candle.time + 30, candle.close);
-                break;
-            }
+            activePlotIt.second->updatePlotAdd(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, bar.indicators);
+            activePlotIt.second->trimHistory(kept);
 
             // mark as updated
             updatedIndicators.insert(activePlotIt.second);
@@ -59,38 +71,25 @@ void CandlePlot::updatePlotAdd(const Candlestick &candle)
     }
 }
 
-void CandlePlot::updatePlotReplace(const Candlestick &candle)
+void CandlePlot::updatePlotReplace(const SymbolCandles::Bar &bar)
 {
+    const auto& candle = bar.candle;
+
     if(size_ > 0)
     {
-        candleBars_->data()->set(size_ - 1, QCPFinancialData(candle.time + 30, candle.open, candle.high, candle.low, candle.close));
+        pyramid_.replace(candle);
+        updateLevels();
 
         std::unordered_set<std::shared_ptr<IIndicatorGraph>> updatedIndicators;
+        SamplePoint sample{ candle.open, candle.high, candle.low, candle.close, static_cast<double>(candle.volume) };
+        recordCandle(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, sample, false);
+
         // update all the indicators belonging to this plot
         for(auto& activePlotIt: activeIndicatorPlots_)
         {
             if(updatedIndicators.find(activePlotIt.second) == updatedIndicators.end() )
             {
-                switch(activePlotIt.second->valueType)
-                {
-                case OhlcType::OPEN:
-                    activePlotIt.second->updatePlotReplace( candle.time + 30, candle.open);
-                    break;
-
-                case OhlcType::HIGH:
-                    activePlotIt.second->updatePlotReplace( candle.time + 30, candle.high);
-                    break;
-
-                case OhlcType::LOW:
-                    activePlotIt.second->updatePlotReplace( candle.time + 30, candle.low);
-                    break;
-
-                // use closing value as default
-                case OhlcType::CLOSE:
-                default:
-                    activePlotIt.second->updatePlotReplace( candle.time + 30, candle.close);
-                    break;
-                }
+                activePlotIt.second->updatePlotReplace(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, bar.indicators);
 
                 // mark as updated
                 updatedIndicators.insert(activePlotIt.second);
@@ -100,41 +99,76 @@ void CandlePlot::updatePlotReplace(const Candlestick &candle)
     // if there is nothing to replace, add a new one
     else
     {
-        updatePlotAdd(candle);
+        updatePlotAdd(bar);
     }
 }
 
 
-// keep the indicatorPlot up to date with all the candles we currently have
-// this is used when we add an indicator after a graph has started
-// for a while already. we still want to be able to plot the indicator for
-// the previous candles
-void CandlePlot::pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot)
+void CandlePlot::setTicks(std::shared_ptr<const TickSeries> ticks)
+{
+    // the feed only keeps the ticks while a plot shows them, see showTicks
+    tickChart_->setSeries(ticks);
+}
+
+void CandlePlot::showTicks(bool ticks)
 {
+    if(ticks != tickMode_)
+    {
+        feed_->watchTicks(ticks);
+    }
+    tickMode_ = ticks;
+    candleBars_->setVisible(!ticks);
+    liveBar_->setVisible(!ticks);
+    tickChart_->setVisible(ticks);
+    rescalePlot();
+    parentPlot_.replot();
+}
 
-    std::cout << "candle plot" << std::endl;
-    for(auto& it: *candleBars_->data())
+void CandlePlot::updateLevels()
+{
+    // the latest candle of each level only goes into the level's history
+    // once a newer one starts. until then it is the live bar
+    bool hasLive = !liveCandles_.empty();
+    liveCandles_.resize(pyramid_.levels());
+    for(size_t level = 0; level < pyramid_.levels(); ++level)
     {
-        switch(iplot->valueType)
+        if(hasLive && pyramid_.latestIsNew(level))
         {
-        case OhlcType::OPEN:
-            iplot->updatePlotAdd( static_cast<time_t>(it.key), it.open);
-            break;
-
-        case OhlcType::HIGH:
-            iplot->updatePlotAdd( static_cast<time_t>(it.key), it.high);
-            break;
-
-        case OhlcType::LOW:
-            iplot->updatePlotAdd( static_cast<time_t>(it.key), it.low);
-            break;
-
-        case OhlcType::CLOSE:
-            iplot->updatePlotAdd( static_cast<time_t>(it.key), it.close);
-            break;
-        default:
-            break;
+            levelData_[level]->add(liveCandles_[level]);
+            levelHistories_[level]->trim(keptRange());
         }
+        const auto& candle = pyramid_.latest(level);
+        liveCandles_[level] = QCPFinancialData(candle.time + pyramid_.timeFrame(level) / 2, candle.open, candle.high, candle.low, candle.close);
+    }
+    showLive();
+}
+
+void CandlePlot::showLevel(size_t level)
+{
+    if(level != level_)
+    {
+        level_ = level;
+        candleBars_->setData(levelData_[level]);
+        candleBars_->setWidth(pyramid_.timeFrame(level));
+        liveBar_->setWidth(pyramid_.timeFrame(level));
+        showLive();
+    }
+}
+
+void CandlePlot::showLive()
+{
+    if(liveCandles_.empty())
+    {
+        return;
+    }
+
+    if(liveBar_->data()->isEmpty())
+    {
+        liveBar_->data()->add(liveCandles_[level_]);
+    }
+    else
+    {
+        liveBar_->data()->set(0, liveCandles_[level_]);
     }
 }
 
@@ -147,7 +181,14 @@ void CandlePlot::rescalePlot()
     }
     else
     {
-        candleBars_->rescaleValueAxis(false, true);
+        if(tickMode_)
+        {
+            tickChart_->rescaleValueAxis(false, true);
+        }
+        else
+        {
+            candleBars_->rescaleValueAxis(false, true);
+        }
 
         // we need to rescale each graph with respect to
         // their axes. For each axis, we need to autofit
@@ -162,7 +203,23 @@ void CandlePlot::rescalePlot()
         {
             signDomain = (axisRect_.axis(QCPAxis::atLeft)->range().upper < 0 ? QCP::sdNegative : QCP::sdPositive);
         }
-        auto maxRange = candleBars_->getValueRange(foundRange, signDomain, axisRect_.axis(QCPAxis::atBottom)->range());
+        QCPRange maxRange;
+        if(tickMode_)
+        {
+            maxRange = tickChart_->getValueRange(foundRange, signDomain, axisRect_.axis(QCPAxis::atBottom)->range());
+        }
+        else
+        {
+            maxRange = candleBars_->getValueRange(foundRange, signDomain, axisRect_.axis(QCPAxis::atBottom)->range());
+
+            // include the live bar
+            bool foundLiveRange = false;
+            auto liveRange = liveBar_->getValueRange(foundLiveRange, signDomain, axisRect_.axis(QCPAxis::atBottom)->range());
+            if(foundLiveRange)
+            {
+                maxRange = foundRange ? QCPRange(qMin(maxRange.lower, liveRange.lower), qMax(maxRange.upper, liveRange.upper)) : liveRange;
+            }
+        }
         //valueAxis->setRange(newRange);
 
         // get all our value axes
@@ -207,22 +264,88 @@ void CandlePlot::indicatorSelectionMenu(QPoint pos)
     // destroy the menu after closing
     menu->setAttribute(Qt::WidgetAttribute::WA_DeleteOnClose);
 
+    menu->addAction(tickMode_ ? "Show Candles" : "Show Ticks", this, [this]()
+    {
+        showTicks(!tickMode_);
+    });
+    menu->addSeparator();
+
     // dynamically create a new graph each time based on the state of the plots
     // and indicators
     auto subMenu = menu->addMenu("A");
-    subMenu->addAction("Absolute Price Oscillator");
-    subMenu->addAction("Accumulation/Distribution Line");
-    subMenu->addAction("Accumulation/Distribution Oscillator");
-    subMenu->addAction("Annualized Historical Volatility");
-    subMenu->addAction("Aroon");
-    subMenu->addAction("Aroon Oscillator");
-    subMenu->addAction("Average Directional Movement Index");
-    subMenu->addAction("Average Directional Movement Rating");
-    subMenu->addAction("Average Price");
-    subMenu->addAction("Average True Range");
-    subMenu->addAction("Awesome Oscillator");
+    subMenu->addAction("Absolute Price Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 12, 1);
+        diag.addSpinbox("Long Period", 26, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            indicatorLaunch<AbsolutePriceOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, shortPeriod, longPeriod);
+        }
+    });
+    subMenu->addAction("Accumulation/Distribution Line", this, [this]()
+    {
+        indicatorLaunch<AccumulationDistributionLine>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
+    subMenu->addAction("Accumulation/Distribution Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 3, 1);
+        diag.addSpinbox("Long Period", 10, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            indicatorLaunch<AccumulationDistributionOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, shortPeriod, longPeriod);
+        }
+    });
+    subMenu->addAction("Annualized Historical Volatility", this, [this]()
+    {
+        periodIndicatorLaunch<AnnualizedHistoricalVolatility>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Aroon", this, [this]()
+    {
+        periodIndicatorLaunch<Aroon>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Aroon Oscillator", this, [this]()
+    {
+        periodIndicatorLaunch<AroonOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Average Directional Movement Index", this, [this]()
+    {
+        periodIndicatorLaunch<AverageDirectionalMovementIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Average Directional Movement Rating", this, [this]()
+    {
+        periodIndicatorLaunch<AverageDirectionalMovementRating>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Average Price", this, [this]()
+    {
+        indicatorLaunch<AveragePrice>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY);
+    });
+    subMenu->addAction("Average True Range", this, [this]()
+    {
+        periodIndicatorLaunch<AverageTrueRange>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Awesome Oscillator", this, [this]()
+    {
+        indicatorLaunch<AwesomeOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
     subMenu = menu->addMenu("B");
-    subMenu->addAction("Balance of Power");
+    subMenu->addAction("Balance of Power", this, [this]()
+    {
+        indicatorLaunch<BalanceOfPower>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
     subMenu->addAction("Bollinger Bands", this, [this]()
     {
         //prompt user
@@ -239,21 +362,57 @@ void CandlePlot::indicatorSelectionMenu(QPoint pos)
             indicatorLaunch<BollingerBands>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, period, scale);
         }
     });
-    subMenu->addAction("Chaikins Volatility");
+    subMenu->addAction("Chaikins Volatility", this, [this]()
+    {
+        periodIndicatorLaunch<ChaikinsVolatility>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 10);
+    });
     subMenu = menu->addMenu("C");
-    subMenu->addAction("Chande Momentum Oscillator");
-    subMenu->addAction("Commodity Channel Index");
-    subMenu->addAction("Crossany");
-    subMenu->addAction("Crossover");
+    subMenu->addAction("Chande Momentum Oscillator", this, [this]()
+    {
+        periodIndicatorLaunch<ChandeMomentumOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Commodity Channel Index", this, [this]()
+    {
+        periodIndicatorLaunch<CommodityChannelIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Crossany", this, [this]()
+    {
+        pairIndicatorLaunch<Crossover>(IndicatorDisplayType::INDICATOR, true);
+    });
+    subMenu->addAction("Crossover", this, [this]()
+    {
+        pairIndicatorLaunch<Crossover>(IndicatorDisplayType::INDICATOR, false);
+    });
     subMenu = menu->addMenu("D");
-    subMenu->addAction("Detrended Price Oscillator");
-    subMenu->addAction("Directional Indicator");
-    subMenu->addAction("Directional Movement");
-    subMenu->addAction("Directional Movement Index");
-    subMenu->addAction("Double Exponential Moving Average");
+    subMenu->addAction("Detrended Price Oscillator", this, [this]()
+    {
+        periodIndicatorLaunch<DetrendedPriceOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Directional Indicator", this, [this]()
+    {
+        periodIndicatorLaunch<DirectionalIndicator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Directional Movement", this, [this]()
+    {
+        periodIndicatorLaunch<DirectionalMovement>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Directional Movement Index", this, [this]()
+    {
+        periodIndicatorLaunch<DirectionalMovementIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Double Exponential Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<DoubleExponentialMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 20);
+    });
     subMenu = menu->addMenu("E");
-    subMenu->addAction("Ease of Movement");
-    subMenu->addAction("Exponential Decay");
+    subMenu->addAction("Ease of Movement", this, [this]()
+    {
+        indicatorLaunch<EaseOfMovement>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
+    subMenu->addAction("Exponential Decay", this, [this]()
+    {
+        periodIndicatorLaunch<ExponentialDecay>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 5);
+    });
     subMenu->addAction("Exponential Moving Average", [this]()
     {
         //prompt user
@@ -270,44 +429,201 @@ void CandlePlot::indicatorSelectionMenu(QPoint pos)
         }
     });
     subMenu = menu->addMenu("F");
-    subMenu->addAction("Fisher Transform");
-    subMenu->addAction("Forecast Oscillator");
+    subMenu->addAction("Fisher Transform", this, [this]()
+    {
+        periodIndicatorLaunch<FisherTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 10);
+    });
+    subMenu->addAction("Forecast Oscillator", this, [this]()
+    {
+        periodIndicatorLaunch<ForecastOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
     subMenu = menu->addMenu("H");
-    subMenu->addAction("Hull Moving Average");
-    subMenu = menu->addMenu("A");
-    subMenu->addAction("Kaufman Adaptive Moving Average");
-    subMenu->addAction("Klinger Volume Oscillator");
+    subMenu->addAction("Hull Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<HullMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 20);
+    });
+    subMenu = menu->addMenu("K");
+    subMenu->addAction("Kaufman Adaptive Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<KaufmanAdaptiveMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 10);
+    });
+    subMenu->addAction("Klinger Volume Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 34, 1);
+        diag.addSpinbox("Long Period", 55, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            indicatorLaunch<KlingerVolumeOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, shortPeriod, longPeriod);
+        }
+    });
     subMenu = menu->addMenu("L");
-    subMenu->addAction("Lag");
-    subMenu->addAction("Linear Decay");
-    subMenu->addAction("Linear Regression");
-    subMenu->addAction("Linear Regression Intercept");
-    subMenu->addAction("Linear Regression Slope");
+    subMenu->addAction("Lag", this, [this]()
+    {
+        periodIndicatorLaunch<Lag>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 5);
+    });
+    subMenu->addAction("Linear Decay", this, [this]()
+    {
+        periodIndicatorLaunch<LinearDecay>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 5);
+    });
+    subMenu->addAction("Linear Regression", this, [this]()
+    {
+        periodIndicatorLaunch<LinearRegression>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 14);
+    });
+    subMenu->addAction("Linear Regression Intercept", this, [this]()
+    {
+        periodIndicatorLaunch<LinearRegressionIntercept>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 14);
+    });
+    subMenu->addAction("Linear Regression Slope", this, [this]()
+    {
+        periodIndicatorLaunch<LinearRegressionSlope>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
     subMenu = menu->addMenu("M");
-    subMenu->addAction("Market Facilitation Index");
-    subMenu->addAction("Mass Index");
-    subMenu->addAction("Maximum In Period");
-    subMenu->addAction("Mean Deviation Over Period");
-    subMenu->addAction("Median Price");
-    subMenu->addAction("Mesa Sine Wave");
-    subMenu->addAction("Minimum In Period");
-    subMenu->addAction("Momentum");
-    subMenu->addAction("Money Flow Index");
-    subMenu->addAction("Moving Average Convergence/Divergence");
+    subMenu->addAction("Market Facilitation Index", this, [this]()
+    {
+        indicatorLaunch<MarketFacilitationIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
+    subMenu->addAction("Mass Index", this, [this]()
+    {
+        periodIndicatorLaunch<MassIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 25);
+    });
+    subMenu->addAction("Maximum In Period", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Period", 5, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto period = diag.getSpinboxValue("Period");
+            indicatorLaunch<Maximum>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, period);
+        }
+    });
+    subMenu->addAction("Mean Deviation Over Period", this, [this]()
+    {
+        periodIndicatorLaunch<MeanDeviation>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Median Price", this, [this]()
+    {
+        indicatorLaunch<MedianPrice>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY);
+    });
+    subMenu->addAction("Mesa Sine Wave", this, [this]()
+    {
+        periodIndicatorLaunch<MesaSineWave>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Minimum In Period", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Period", 5, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto period = diag.getSpinboxValue("Period");
+            indicatorLaunch<Minimum>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, period);
+        }
+    });
+    subMenu->addAction("Momentum", this, [this]()
+    {
+        periodIndicatorLaunch<Momentum>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 10);
+    });
+    subMenu->addAction("Money Flow Index", this, [this]()
+    {
+        periodIndicatorLaunch<MoneyFlowIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Moving Average Convergence/Divergence", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 12, 1);
+        diag.addSpinbox("Long Period", 26, 1);
+        diag.addSpinbox("Signal Period", 9, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            auto signalPeriod = diag.getSpinboxValue("Signal Period");
+            indicatorLaunch<MovingAverageConvergenceDivergence>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, shortPeriod, longPeriod, signalPeriod);
+        }
+    });
     subMenu = menu->addMenu("N");
-    subMenu->addAction("Negative Volume Index");
-    subMenu->addAction("Normalized Average True Range");
+    subMenu->addAction("Negative Volume Index", this, [this]()
+    {
+        indicatorLaunch<NegativeVolumeIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
+    subMenu->addAction("Normalized Average True Range", this, [this]()
+    {
+        periodIndicatorLaunch<NormalizedAverageTrueRange>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
     subMenu = menu->addMenu("O");
-    subMenu->addAction("On Balance Volume");
+    subMenu->addAction("On Balance Volume", this, [this]()
+    {
+        indicatorLaunch<OnBalanceVolume>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
     subMenu = menu->addMenu("P");
-    subMenu->addAction("Parabolic SAR");
-    subMenu->addAction("Percentage Price Oscillator");
-    subMenu->addAction("Positive Volume Index");
+    subMenu->addAction("Parabolic SAR", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Acceleration Step (%)", 2, 1);
+        diag.addSpinbox("Acceleration Maximum (%)", 20, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto accelerationStep = diag.getSpinboxValue("Acceleration Step (%)") / 100.0;
+            auto accelerationMaximum = diag.getSpinboxValue("Acceleration Maximum (%)") / 100.0;
+            indicatorLaunch<ParabolicSar>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, accelerationStep, accelerationMaximum);
+        }
+    });
+    subMenu->addAction("Percentage Price Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 12, 1);
+        diag.addSpinbox("Long Period", 26, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            indicatorLaunch<PercentagePriceOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, shortPeriod, longPeriod);
+        }
+    });
+    subMenu->addAction("Positive Volume Index", this, [this]()
+    {
+        indicatorLaunch<PositiveVolumeIndex>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
     subMenu = menu->addMenu("Q");
-    subMenu->addAction("Qstick");
+    subMenu->addAction("Qstick", this, [this]()
+    {
+        periodIndicatorLaunch<Qstick>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 10);
+    });
     subMenu = menu->addMenu("R");
-    subMenu->addAction("Rate of Change");
-    subMenu->addAction("Rate of Change Ratio");
+    subMenu->addAction("Rate of Change", this, [this]()
+    {
+        periodIndicatorLaunch<RateOfChange>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 10);
+    });
+    subMenu->addAction("Rate of Change Ratio", this, [this]()
+    {
+        periodIndicatorLaunch<RateOfChangeRatio>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 10);
+    });
     subMenu->addAction("Relative Strength Index", this, [this]()
     {
         //prompt user
@@ -337,70 +653,266 @@ void CandlePlot::indicatorSelectionMenu(QPoint pos)
             indicatorLaunch<SimpleMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, period);
         }
     });
-    subMenu->addAction("Standard Deviation Over Period");
-    subMenu->addAction("Standard Error Over Period");
-    subMenu->addAction("Stochastic Oscillator");
-    subMenu->addAction("Stochastic RSI");
-    subMenu->addAction("Sum Over Period");
+    subMenu->addAction("Standard Deviation Over Period", this, [this]()
+    {
+        periodIndicatorLaunch<StandardDeviation>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Standard Error Over Period", this, [this]()
+    {
+        periodIndicatorLaunch<StandardError>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Stochastic Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("K Period", 14, 1);
+        diag.addSpinbox("K Slowing Period", 3, 1);
+        diag.addSpinbox("D Period", 3, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto kPeriod = diag.getSpinboxValue("K Period");
+            auto kSlowingPeriod = diag.getSpinboxValue("K Slowing Period");
+            auto dPeriod = diag.getSpinboxValue("D Period");
+            indicatorLaunch<StochasticOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, kPeriod, kSlowingPeriod, dPeriod);
+        }
+    });
+    subMenu->addAction("Stochastic RSI", this, [this]()
+    {
+        periodIndicatorLaunch<StochasticRsi>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Sum Over Period", this, [this]()
+    {
+        periodIndicatorLaunch<SumOverPeriod>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 10);
+    });
     subMenu = menu->addMenu("T");
-    subMenu->addAction("Time Series Forecast");
-    subMenu->addAction("Triangular Moving Average");
-    subMenu->addAction("Triple Exponential Moving Average");
-    subMenu->addAction("Trix");
-    subMenu->addAction("True Range");
-    subMenu->addAction("Typical Price");
+    subMenu->addAction("Time Series Forecast", this, [this]()
+    {
+        periodIndicatorLaunch<TimeSeriesForecast>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 14);
+    });
+    subMenu->addAction("Triangular Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<TriangularMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 20);
+    });
+    subMenu->addAction("Triple Exponential Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<TripleExponentialMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 20);
+    });
+    subMenu->addAction("Trix", this, [this]()
+    {
+        periodIndicatorLaunch<Trix>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 15);
+    });
+    subMenu->addAction("True Range", this, [this]()
+    {
+        indicatorLaunch<TrueRange>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
+    subMenu->addAction("Typical Price", this, [this]()
+    {
+        indicatorLaunch<TypicalPrice>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY);
+    });
     subMenu = menu->addMenu("U");
-    subMenu->addAction("Ultimate Oscillator");
+    subMenu->addAction("Ultimate Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 7, 1);
+        diag.addSpinbox("Medium Period", 14, 1);
+        diag.addSpinbox("Long Period", 28, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto mediumPeriod = diag.getSpinboxValue("Medium Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            indicatorLaunch<UltimateOscillator>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, shortPeriod, mediumPeriod, longPeriod);
+        }
+    });
     subMenu = menu->addMenu("V");
-    subMenu->addAction("Variable Index Dynamic Average");
-    subMenu->addAction("Variance Over Period");
-    subMenu->addAction("Vector Absolute Value");
-    subMenu->addAction("Vector Addition");
-    subMenu->addAction("Vector Arccosine");
-    subMenu->addAction("Vector Arcsine");
-    subMenu->addAction("Vector Arctangent");
-    subMenu->addAction("Vector Base-10 Log");
-    subMenu->addAction("Vector Ceiling");
-    subMenu->addAction("Vector Cosine");
-    subMenu->addAction("Vector Degree Conversion");
-    subMenu->addAction("Vector Division");
-    subMenu->addAction("Vector Exponential");
-    subMenu->addAction("Vector Floor");
-    subMenu->addAction("Vector Hyperbolic Cosine");
-    subMenu->addAction("Vector Hyperbolic Sine");
-    subMenu->addAction("Vector Hyperbolic Tangent");
-    subMenu->addAction("Vector Multiplication");
-    subMenu->addAction("Vector Natural Log");
-    subMenu->addAction("Vector Radian Conversion");
-    subMenu->addAction("Vector Round");
-    subMenu->addAction("Vector Sine");
-    subMenu->addAction("Vector Square Root");
-    subMenu->addAction("Vector Subtraction");
-    subMenu->addAction("Vector Tangent");
-    subMenu->addAction("Vector Truncate");
-    subMenu->addAction("Vertical Horizontal Filter");
-    subMenu->addAction("Volume Oscillator");
-    subMenu->addAction("Volume Weighted Moving Average");
+    subMenu->addAction("Variable Index Dynamic Average", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 6, 1);
+        diag.addSpinbox("Long Period", 20, 1);
+        diag.addSpinbox("Alpha (%)", 20, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            auto alpha = diag.getSpinboxValue("Alpha (%)") / 100.0;
+            indicatorLaunch<VariableIndexDynamicAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, shortPeriod, longPeriod, alpha);
+        }
+    });
+    subMenu->addAction("Variance Over Period", this, [this]()
+    {
+        periodIndicatorLaunch<Variance>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 20);
+    });
+    subMenu->addAction("Vector Absolute Value", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::ABSOLUTE_VALUE);
+    });
+    subMenu->addAction("Vector Addition", this, [this]()
+    {
+        pairIndicatorLaunch<MathOperator>(IndicatorDisplayType::INDICATOR, MathOperator::Operator::ADDITION);
+    });
+    subMenu->addAction("Vector Arccosine", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::ARCCOSINE);
+    });
+    subMenu->addAction("Vector Arcsine", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::ARCSINE);
+    });
+    subMenu->addAction("Vector Arctangent", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::ARCTANGENT);
+    });
+    subMenu->addAction("Vector Base-10 Log", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::BASE_10_LOG);
+    });
+    subMenu->addAction("Vector Ceiling", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::CEILING);
+    });
+    subMenu->addAction("Vector Cosine", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::COSINE);
+    });
+    subMenu->addAction("Vector Degree Conversion", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::DEGREE_CONVERSION);
+    });
+    subMenu->addAction("Vector Division", this, [this]()
+    {
+        pairIndicatorLaunch<MathOperator>(IndicatorDisplayType::INDICATOR, MathOperator::Operator::DIVISION);
+    });
+    subMenu->addAction("Vector Exponential", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::EXPONENTIAL);
+    });
+    subMenu->addAction("Vector Floor", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::FLOOR);
+    });
+    subMenu->addAction("Vector Hyperbolic Cosine", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::HYPERBOLIC_COSINE);
+    });
+    subMenu->addAction("Vector Hyperbolic Sine", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::HYPERBOLIC_SINE);
+    });
+    subMenu->addAction("Vector Hyperbolic Tangent", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::HYPERBOLIC_TANGENT);
+    });
+    subMenu->addAction("Vector Multiplication", this, [this]()
+    {
+        pairIndicatorLaunch<MathOperator>(IndicatorDisplayType::INDICATOR, MathOperator::Operator::MULTIPLICATION);
+    });
+    subMenu->addAction("Vector Natural Log", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::NATURAL_LOG);
+    });
+    subMenu->addAction("Vector Radian Conversion", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::RADIAN_CONVERSION);
+    });
+    subMenu->addAction("Vector Round", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::ROUND);
+    });
+    subMenu->addAction("Vector Sine", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::SINE);
+    });
+    subMenu->addAction("Vector Square Root", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::SQUARE_ROOT);
+    });
+    subMenu->addAction("Vector Subtraction", this, [this]()
+    {
+        pairIndicatorLaunch<MathOperator>(IndicatorDisplayType::INDICATOR, MathOperator::Operator::SUBTRACTION);
+    });
+    subMenu->addAction("Vector Tangent", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::TANGENT);
+    });
+    subMenu->addAction("Vector Truncate", this, [this]()
+    {
+        indicatorLaunch<MathTransform>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, MathTransform::Function::TRUNCATE);
+    });
+    subMenu->addAction("Vertical Horizontal Filter", this, [this]()
+    {
+        periodIndicatorLaunch<VerticalHorizontalFilter>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 28);
+    });
+    subMenu->addAction("Volume Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 5, 1);
+        diag.addSpinbox("Long Period", 10, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            indicatorLaunch<VolumeOscillator>(OhlcType::VOLUME, IndicatorDisplayType::INDICATOR, shortPeriod, longPeriod);
+        }
+    });
+    subMenu->addAction("Volume Weighted Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<VolumeWeightedMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 20);
+    });
     subMenu = menu->addMenu("W");
-    subMenu->addAction("Weighted Close Price");
-    subMenu->addAction("Weighted Moving Average");
-    subMenu->addAction("Wilders Smoothing");
-    subMenu->addAction("Williams %R");
-    subMenu->addAction("Williams Accumulation/Distribution");
+    subMenu->addAction("Weighted Close Price", this, [this]()
+    {
+        indicatorLaunch<WeightedClosePrice>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY);
+    });
+    subMenu->addAction("Weighted Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<WeightedMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 20);
+    });
+    subMenu->addAction("Wilders Smoothing", this, [this]()
+    {
+        periodIndicatorLaunch<WildersSmoothing>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 14);
+    });
+    subMenu->addAction("Williams %R", this, [this]()
+    {
+        periodIndicatorLaunch<WilliamsR>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR, 14);
+    });
+    subMenu->addAction("Williams Accumulation/Distribution", this, [this]()
+    {
+        indicatorLaunch<WilliamsAccumulationDistribution>(OhlcType::CLOSE, IndicatorDisplayType::INDICATOR);
+    });
     subMenu = menu->addMenu("Z");
-    subMenu->addAction("Zero-Lag Exponential Moving Average");
+    subMenu->addAction("Zero-Lag Exponential Moving Average", this, [this]()
+    {
+        periodIndicatorLaunch<ZeroLagExponentialMovingAverage>(OhlcType::CLOSE, IndicatorDisplayType::OVERLAY, 20);
+    });
 
     menu->popup(parentPlot_.mapToGlobal(pos));
 }
 
 double CandlePlot::lowerRange()
 {
-    return candleBars_->data()->at(0)->mainKey();
+    return candleBars_->data()->isEmpty() ? liveBar_->data()->at(0)->mainKey() : candleBars_->data()->at(0)->mainKey();
 }
 
 double CandlePlot::upperRange()
 {
-    return candleBars_->data()->at(candleBars_->data()->size() - 1)->mainKey();
+    // the live bar is always the latest
+    return liveBar_->data()->at(0)->mainKey();
 }
 
 int CandlePlot::size()
@@ -411,10 +923,16 @@ int CandlePlot::size()
 
 void CandlePlot::xAxisChanged(QCPRange range)
 {
+    // show the timeframe that keeps the number of candles drawn within the width of the plot
+    showLevel(pyramid_.levelFor(range.size(), axisRect_.width()));
+
+    // the candles scrolled to that were paged out are read back before deciding
+    // whether the view holds all of the data
+    levelHistories_[level_]->load(range);
+
     // compare the range of our zoom with our data.
     // if the zoom contains all the data, then autoscale
-    if(floor(range.lower) <= candleBars_->data()->at(0)->mainKey() &&
-        ceil(range.upper) >= candleBars_->data()->at(candleBars_->data()->size() - 1)->mainKey())
+    if(liveBar_->data()->isEmpty() || (floor(range.lower) <= lowerRange() && ceil(range.upper) >= upperRange()))
     {
         autoScaleKeyAxis_ = true;
     }
@@ -430,8 +948,34 @@ void CandlePlot::xAxisChanged(QCPRange range)
 template<typename IndicatorType, typename ... Args>
 void CandlePlot::indicatorLaunch(OhlcType valueType, IndicatorDisplayType displayType, Args... args)
 {
-    auto indicator = std::make_unique<IndicatorType>(args...);
-    auto plot = std::make_shared<IndicatorGraph<IndicatorType>>(axisRect_, std::move(indicator), valueType, displayType);
+    auto handle = addEngineIndicator<IndicatorType>(feed_->indicators(), valueType, 0, args...);
+    showIndicator<IndicatorType>(handle, valueType, displayType);
+}
+
+template<typename IndicatorType, typename ... Args>
+void CandlePlot::pairIndicatorLaunch(IndicatorDisplayType displayType, Args... args)
+{
+    //prompt user. the items are in the order of OhlcType
+    QStringList values{ "Open", "High", "Low", "Close", "Volume" };
+    IndicatorDialog diag;
+    diag.addCombobox("First Value", values, static_cast<int>(OhlcType::CLOSE));
+    diag.addCombobox("Second Value", values, static_cast<int>(OhlcType::OPEN));
+    diag.exec();
+
+    //if user pressed OK
+    if(diag.valid())
+    {
+        auto first = candleSeries(static_cast<OhlcType>(diag.getComboboxIndex("First Value")));
+        auto second = candleSeries(static_cast<OhlcType>(diag.getComboboxIndex("Second Value")));
+        auto handle = feed_->indicators().addOnPair<IndicatorType>(first, second, args...);
+        showIndicator<IndicatorType>(handle, OhlcType::VALUE, displayType);
+    }
+}
+
+template<typename IndicatorType>
+void CandlePlot::showIndicator(IndicatorEngine::Handle handle, OhlcType valueType, IndicatorDisplayType displayType)
+{
+    auto plot = std::make_shared<IndicatorGraph<IndicatorType>>(axisRect_, feed_->indicators(), handle, valueType, displayType);
     pastCandlesPlotUpdate(plot);
     auto plottables = plot->getPlottables();
 
@@ -445,3 +989,19 @@ void CandlePlot::indicatorLaunch(OhlcType valueType, IndicatorDisplayType displa
     //replot after adding indicator
     parentPlot_.replot();
 }
+
+template<typename IndicatorType>
+void CandlePlot::periodIndicatorLaunch(OhlcType valueType, IndicatorDisplayType displayType, int defaultPeriod)
+{
+    //prompt user
+    IndicatorDialog diag;
+    diag.addSpinbox("Period", defaultPeriod, 1);
+    diag.exec();
+
+    //if user pressed OK
+    if(diag.valid())
+    {
+        auto period = diag.getSpinboxValue("Period");
+        indicatorLaunch<IndicatorType>(valueType, displayType, period);
+    }
+}
@@ -4,18 +4,23 @@
 #include "qcustomplot.h"
 #include "indicatorgraph.h"
 #include "baseplot.h"
+#include "candlepyramid.h"
+#include "barhistory.h"
+#include "tickchart.h"
 #include <unordered_map>
 #include <ctime>
+#include <memory>
+#include <vector>
 
 class CandlePlot : public BasePlot
 {
     Q_OBJECT
 public:
-    CandlePlot(QCustomPlot& parentPlot);
+    CandlePlot(QCustomPlot& parentPlot, std::shared_ptr<SymbolCandles> feed);
     ~CandlePlot() override;
-    void updatePlotAdd(const Candlestick &candle) override;
-    void updatePlotReplace(const Candlestick &candle) override;
-    void pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot) override;
+    void updatePlotAdd(const SymbolCandles::Bar &bar) override;
+    void updatePlotReplace(const SymbolCandles::Bar &bar) override;
+    void setTicks(std::shared_ptr<const TickSeries> ticks) override;
     void rescalePlot() override;
 
     double lowerRange();
@@ -28,8 +33,43 @@ private:
     template<typename IndicatorType, typename... Args>
     void indicatorLaunch(OhlcType valueType, IndicatorDisplayType displayType, Args... args);
 
-    // graph
+    // prompts for the period and launches the indicator
+    template<typename IndicatorType>
+    void periodIndicatorLaunch(OhlcType valueType, IndicatorDisplayType displayType, int defaultPeriod);
+
+    // prompts for the two values of the candle and launches the indicator computed from them
+    template<typename IndicatorType, typename... Args>
+    void pairIndicatorLaunch(IndicatorDisplayType displayType, Args... args);
+
+    // plots the indicator added to the engine
+    template<typename IndicatorType>
+    void showIndicator(IndicatorEngine::Handle handle, OhlcType valueType, IndicatorDisplayType displayType);
+
+    // follows the pyramid, closing the live candle of each level into its history when a new one starts
+    void updateLevels();
+    void showLevel(size_t level);
+    void showLive();
+
+    // shows the ticks in place of the candles, or the candles again
+    void showTicks(bool ticks);
+
+    // graph. candleBars_ has the closed candles and liveBar_, on the live layer, the
+    // candle still forming, so a tick only redraws the live layer
     QCPFinancial* candleBars_;
+    QCPFinancial* liveBar_;
+
+    // the ticks since tick mode was turned on, drawn in place of the candles. it is on
+    // the live layer since it changes with every tick
+    TickChart* tickChart_;
+    bool tickMode_;
+
+    // the candles of every timeframe of the pyramid. candleBars_ shows levelData_[level_].
+    // each level keeps a window of its latest candles, the older ones are on disk
+    CandlePyramid pyramid_;
+    std::vector<QSharedPointer<QCPFinancialDataContainer>> levelData_;
+    std::vector<std::unique_ptr<BarHistory<QCPFinancialData>>> levelHistories_;
+    std::vector<QCPFinancialData> liveCandles_;
+    size_t level_;
 
     int size_;
 
@@ -0,0 +1,110 @@
+#include "candlepyramid.h"
+#include <algorithm>
+
+CandlePyramid::CandlePyramid()
+{
+    // 1 minute, 5 minutes, 15 minutes, 1 hour, 4 hours and 1 day
+    for(auto timeFrame: {BASE_TIME_FRAME, 300, 900, 3600, 14400, 86400})
+    {
+        levels_.push_back(Level{ timeFrame, Candlestick(), false, Candlestick(), false, false });
+    }
+}
+
+void CandlePyramid::add(const Candlestick& candle)
+{
+    for(auto& level: levels_)
+    {
+        auto bucket = candle.time - candle.time % level.timeFrame;
+        if(level.hasLatest && level.latest.time == bucket)
+        {
+            // the previous base candle is final now. it stays in the level candle
+            // while the new one is merged in on top
+            level.committed = level.latest;
+            level.hasCommitted = true;
+            level.latest = merge(level.committed, candle);
+            level.latestIsNew = false;
+        }
+        else
+        {
+            level.hasCommitted = false;
+            level.latest = candle;
+            level.latest.time = bucket;
+            level.latestIsNew = true;
+            level.hasLatest = true;
+        }
+    }
+}
+
+void CandlePyramid::replace(const Candlestick& candle)
+{
+    if(!levels_.front().hasLatest)
+    {
+        add(candle);
+        return;
+    }
+
+    for(auto& level: levels_)
+    {
+        auto bucket = candle.time - candle.time % level.timeFrame;
+        if(level.hasCommitted && level.committed.time == bucket)
+        {
+            level.latest = merge(level.committed, candle);
+        }
+        else
+        {
+            // the candle is the first of its bucket, which is also the case if its time changed
+            level.hasCommitted = false;
+            level.latest = candle;
+            level.latest.time = bucket;
+        }
+        level.latestIsNew = false;
+    }
+}
+
+size_t CandlePyramid::levels() const
+{
+    return levels_.size();
+}
+
+int CandlePyramid::timeFrame(size_t level) const
+{
+    return levels_[level].timeFrame;
+}
+
+const Candlestick& CandlePyramid::latest(size_t level) const
+{
+    return levels_[level].latest;
+}
+
+bool CandlePyramid::latestIsNew(size_t level) const
+{
+    return levels_[level].latestIsNew;
+}
+
+size_t CandlePyramid::levelFor(double keyRange, int pixels) const
+{
+    auto maxCandles = std::max(pixels / MIN_PIXELS_PER_CANDLE, 1);
+    for(size_t level = 0; level < levels_.size(); ++level)
+    {
+        if(keyRange / levels_[level].timeFrame <= maxCandles)
+        {
+            return level;
+        }
+    }
+    return levels_.size() - 1;
+}
+
+Candlestick CandlePyramid::merge(const Candlestick& earlier, const Candlestick& later)
+{
+    Candlestick merged = earlier;
+    merged.high = std::max(earlier.high, later.high);
+    merged.low = std::min(earlier.low, later.low);
+    merged.close = later.close;
+    merged.volume = earlier.volume + later.volume;
+    merged.count = earlier.count + later.count;
+    if(merged.volume > 0)
+    {
+        merged.wap = (earlier.wap * earlier.volume + later.wap * later.volume) / merged.volume;
+    }
+    return merged;
+}
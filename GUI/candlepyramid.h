@@ -0,0 +1,59 @@
+#ifndef CANDLEPYRAMID_H
+#define CANDLEPYRAMID_H
+
+#include <vector>
+#include <ctime>
+#include "../BaseModules/CandleMaker/CandleMaker.h"
+
+// candles of the chart aggregated into coarser timeframes as they arrive, so the
+// plots can show whichever timeframe fits the visible range without going back
+// to the ticks. level 0 is the candles of the candle maker. every level is kept
+// up to date with each candle added or replaced, in constant time per level
+class CandlePyramid
+{
+public:
+    // timeframe of the candle maker feeding the pyramid, in seconds
+    static const int BASE_TIME_FRAME = 60;
+
+    // the fewest pixels a candle is drawn with before switching to a coarser level
+    static const int MIN_PIXELS_PER_CANDLE = 3;
+
+    CandlePyramid();
+
+    // a new candle of the base timeframe
+    void add(const Candlestick& candle);
+
+    // the latest candle of the base timeframe changed
+    void replace(const Candlestick& candle);
+
+    size_t levels() const;
+    int timeFrame(size_t level) const;
+
+    // the latest candle of the level, and whether the last add or replace started it
+    const Candlestick& latest(size_t level) const;
+    bool latestIsNew(size_t level) const;
+
+    // the finest level that shows the key range with at least MIN_PIXELS_PER_CANDLE
+    // pixels per candle, or the coarsest level if none does
+    size_t levelFor(double keyRange, int pixels) const;
+
+private:
+    struct Level
+    {
+        int timeFrame;
+
+        // the candles of the bucket before the latest base candle, merged
+        Candlestick committed;
+        bool hasCommitted;
+
+        Candlestick latest;
+        bool latestIsNew;
+        bool hasLatest;
+    };
+
+    static Candlestick merge(const Candlestick& earlier, const Candlestick& later);
+
+    std::vector<Level> levels_;
+};
+
+#endif // CANDLEPYRAMID_H
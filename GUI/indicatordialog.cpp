@@ -49,6 +49,22 @@ void IndicatorDialog::addCheckbox(QString text, bool defaultChecked)
 
 }
 
+void IndicatorDialog::addCombobox(QString text, QStringList items, int defaultIndex)
+{
+    auto label = new QLabel(this);
+    label->setText(text);
+
+    auto combobox = new QComboBox(this);
+    combobox->addItems(items);
+    combobox->setCurrentIndex(defaultIndex);
+
+    gridLayout->addWidget(label, row_, 2, 1, 1);
+    gridLayout->addWidget(combobox, row_, 3, 1, 1);
+
+    ++row_;
+    settings_[text.toStdString()] = combobox;
+}
+
 int IndicatorDialog::getSpinboxValue(QString text)
 {
     if(settings_.find(text.toStdString()) != settings_.end())
@@ -59,6 +75,16 @@ int IndicatorDialog::getSpinboxValue(QString text)
     return 0;
 }
 
+int IndicatorDialog::getComboboxIndex(QString text)
+{
+    if(settings_.find(text.toStdString()) != settings_.end())
+    {
+        return static_cast<QComboBox*>(settings_[text.toStdString()])->currentIndex();
+    }
+
+    return 0;
+}
+
 int IndicatorDialog::exec()
 {
     //display the buttonbox at the appropriate place
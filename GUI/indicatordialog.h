@@ -5,6 +5,8 @@
 #include <vector>
 #include <QSpinBox>
 #include <QCheckBox>
+#include <QComboBox>
+#include <QStringList>
 #include <QGridLayout>
 #include <QDialogButtonBox>
 #include <QLabel>
@@ -26,8 +28,10 @@ public:
     //inputs as keys are case sensitive
     void addSpinbox(QString text, int defaultValue, int minVal = std::numeric_limits<int>::min(), int maxVal = std::numeric_limits<int>::max());
     void addCheckbox(QString text, bool defaultChecked = false);
+    void addCombobox(QString text, QStringList items, int defaultIndex = 0);
     int getSpinboxValue(QString text);
     bool getCheckboxValue(QString text);
+    int getComboboxIndex(QString text);
     int exec() override;
     bool valid();
 
@@ -3,8 +3,13 @@
 
 #include <memory>
 #include <array>
+#include <functional>
+#include <utility>
+#include <vector>
 #include "qcustomplot.h"
+#include "barhistory.h"
 #include "../BaseModules/Indicators/Indicators.h"
+#include "../BaseModules/Indicators/IndicatorEngine.h"
 
 enum class IndicatorType
 {
@@ -133,14 +138,64 @@ enum class IndicatorDisplayType
     MATH
 };
 
+// series of the candle the indicators computed from a single value are given
+inline IndicatorEngine::Series candleSeries(OhlcType valueType)
+{
+    switch(valueType)
+    {
+    case OhlcType::OPEN:
+        return IndicatorEngine::candle(IndicatorEngine::OPEN);
+    case OhlcType::HIGH:
+        return IndicatorEngine::candle(IndicatorEngine::HIGH);
+    case OhlcType::LOW:
+        return IndicatorEngine::candle(IndicatorEngine::LOW);
+    case OhlcType::VOLUME:
+        return IndicatorEngine::candle(IndicatorEngine::VOLUME);
+    // close values as default
+    case OhlcType::CLOSE:
+    default:
+        return IndicatorEngine::candle(IndicatorEngine::CLOSE);
+    }
+}
+
+// adds the indicator to the engine. indicators computed from the whole candle are given
+// the candle, the others the value of the candle selected by valueType. the int overload
+// is preferred when both apply
+template<typename T, typename... Args>
+auto addEngineIndicator(IndicatorEngine& engine, OhlcType, int, Args... args) -> decltype(std::declval<T&>().computeIndicatorPoint(std::declval<const SamplePoint&>()), IndicatorEngine::Handle())
+{
+    return engine.addOnCandle<T>(args...);
+}
+
+template<typename T, typename... Args>
+IndicatorEngine::Handle addEngineIndicator(IndicatorEngine& engine, OhlcType valueType, long, Args... args)
+{
+    return engine.add<T>(candleSeries(valueType), args...);
+}
+
+// layer of the candle still forming and of the latest points of the indicators. it has its
+// own paint buffer so that it can be redrawn alone while the closed candles don't change
+const char* const LIVE_LAYER_NAME = "live";
+
 class IIndicatorGraph
 {
 public:
     IIndicatorGraph(){}
     virtual ~IIndicatorGraph(){}
-    // interface for updating the plot
-    virtual void updatePlotAdd(const time_t candleTime, double value) = 0;
-    virtual void updatePlotReplace(const time_t candleTime, double value) = 0;
+    // interface for updating the plot. the graphs read their outputs from the values
+    // the indicators of the feed had after the candle, see SymbolCandles::Bar
+    virtual void updatePlotAdd(const time_t candleTime, const std::vector<double>& values) = 0;
+    virtual void updatePlotReplace(const time_t candleTime, const std::vector<double>& values) = 0;
+    // plots the candles from before the indicator was added, computed on another thread.
+    // startBackfill takes the closed candles and returns the work to run there. once it
+    // has run, finishBackfill swaps its points in and catches up with the candles that
+    // came since, the last of them the one still forming
+    virtual std::function<void()> startBackfill(std::vector<time_t> candleTimes, std::vector<SamplePoint> candles) = 0;
+    virtual void finishBackfill(const std::vector<time_t>& candleTimes, const std::vector<SamplePoint>& candles) = 0;
+    // pages the points older than the retained window out, keeping the ones in view,
+    // and reads back the ones paged out when the view reaches them. see BarHistory
+    virtual void trimHistory(const QCPRange& view) = 0;
+    virtual void loadHistory(const QCPRange& view) = 0;
     virtual void rescaleValueAxisAutofit() = 0;
     virtual std::list<QCPAbstractPlottable*> getPlottables(void) = 0;
 
@@ -150,100 +205,244 @@ public:
     IndicatorDisplayType displayType;
 };
 
-// Templatize for indicators
+// Templatize for indicators. the indicator itself lives in the engine of the feed,
+// where it is shared with every other graph of the same indicator on any tab
 template <typename T>
 class IndicatorGraph : public IIndicatorGraph
 {
 public:
-    IndicatorGraph(QCPAxisRect& axisRect, std::unique_ptr<T> indicator, OhlcType type, IndicatorDisplayType display);
+    IndicatorGraph(QCPAxisRect& axisRect, IndicatorEngine& engine, IndicatorEngine::Handle handle, OhlcType type, IndicatorDisplayType display);
     ~IndicatorGraph() override;
 
-    void updatePlotAdd(const time_t candleTime, double value) override;
-    void updatePlotReplace(const time_t candleTime, double value) override;
+    void updatePlotAdd(const time_t candleTime, const std::vector<double>& values) override;
+    void updatePlotReplace(const time_t candleTime, const std::vector<double>& values) override;
+    std::function<void()> startBackfill(std::vector<time_t> candleTimes, std::vector<SamplePoint> candles) override;
+    void finishBackfill(const std::vector<time_t>& candleTimes, const std::vector<SamplePoint>& candles) override;
+    void trimHistory(const QCPRange& view) override;
+    void loadHistory(const QCPRange& view) override;
     void rescaleValueAxisAutofit() override;
     std::list<QCPAbstractPlottable *> getPlottables(void) override;
 
 private:
     QCPAxisRect& axisRect_;
 
+    // draws the segment from the last closed point to the live point
+    void updateLiveGraph(int output);
+
     std::array<QCPGraph*, T::SIZE> graphs_; // one graph for each output from indicator class
     std::array<QSharedPointer<QCPDataContainer<QCPGraphData>>, T::SIZE> graphDataContainers_;
-    std::unique_ptr<T> indicator_;
+    std::array<std::unique_ptr<BarHistory<QCPGraphData>>, T::SIZE> histories_;
+
+    // the point of the candle still forming is kept out of graphs_ and drawn on the live layer
+    std::array<QCPGraph*, T::SIZE> liveGraphs_;
+    std::array<QCPGraphData, T::SIZE> livePoints_;
+    IndicatorEngine& engine_;
+    IndicatorEngine::Handle handle_;
     int size_;
 
+    // what the backfill works on. it is shared with the work so that it stays valid
+    // whichever of the graph and the work goes first
+    struct BackfillJob
+    {
+        IndicatorEngine::Backfill backfill;
+        std::vector<time_t> candleTimes;
+        std::vector<SamplePoint> candles;
+        std::array<QSharedPointer<QCPDataContainer<QCPGraphData>>, T::SIZE> containers;
+    };
+    std::shared_ptr<BackfillJob> backfill_;
+
 };
 
 template <typename T>
-IndicatorGraph<T>::IndicatorGraph(QCPAxisRect &axisRect, std::unique_ptr<T> indicator, OhlcType type, IndicatorDisplayType display):
-    indicator_(std::move(indicator)),
-    axisRect_(axisRect)
+IndicatorGraph<T>::IndicatorGraph(QCPAxisRect &axisRect, IndicatorEngine& engine, IndicatorEngine::Handle handle, OhlcType type, IndicatorDisplayType display):
+    axisRect_(axisRect),
+    engine_(engine),
+    handle_(handle)
 {
     valueType = type;
     displayType = display;
     size_ = 0;
 
+    QCPAxis* keyAxis_ = axisRect_.axis(QCPAxis::atBottom);
+    QCPAxis* valueAxis_ = nullptr;
+
+    switch(display)
+    {
+        // for indicators, we make a new axis shared by all the
+        // outputs so that they share the same display
+        case IndicatorDisplayType::INDICATOR:
+            valueAxis_ = axisRect.addAxis(QCPAxis::atLeft);
+            break;
+
+        case IndicatorDisplayType::MATH:
+            break;
+
+        // for overlays, we share the same axis as the rect
+        case IndicatorDisplayType::OVERLAY:
+            valueAxis_ = axisRect_.axis(QCPAxis::atLeft);
+            break;
+
+        case IndicatorDisplayType::SIMPLE:
+            break;
+    }
+
     for(int i = 0; i < T::SIZE; ++i)
     {
         graphDataContainers_[i] = QSharedPointer<QCPDataContainer<QCPGraphData>>(new QCPDataContainer<QCPGraphData>);
-        QCPAxis* keyAxis_ = axisRect_.axis(QCPAxis::atBottom);
-        QCPAxis* valueAxis_ = nullptr;
-
-        switch(display)
-        {
-            // for indicators, we make a new axis
-            // so that we can share the same display
-            case IndicatorDisplayType::INDICATOR:
-                valueAxis_ = axisRect.addAxis(QCPAxis::atLeft);
-                break;
-
-            case IndicatorDisplayType::MATH:
-                break;
-
-            // for overlays, we share the same axis as the rect
-            case IndicatorDisplayType::OVERLAY:
-                valueAxis_ = axisRect_.axis(QCPAxis::atLeft);
-                break;
-
-            case IndicatorDisplayType::SIMPLE:
-                break;
-        }
         graphs_[i] = new QCPGraph(keyAxis_, valueAxis_);
         graphs_[i]->setData(graphDataContainers_[i]);
+        histories_[i].reset(new BarHistory<QCPGraphData>(graphDataContainers_[i]));
+
+        liveGraphs_[i] = new QCPGraph(keyAxis_, valueAxis_);
+        liveGraphs_[i]->setLayer(LIVE_LAYER_NAME);
+        liveGraphs_[i]->setSelectable(QCP::stNone);
+        liveGraphs_[i]->setPen(graphs_[i]->pen());
     }
 }
 
 template <typename T>
 IndicatorGraph<T>::~IndicatorGraph()
 {
+    // graphs_ are removed by the plot with the rest of its plottables
+    for(int i = 0; i < T::SIZE; ++i)
+    {
+        axisRect_.parentPlot()->removePlottable(liveGraphs_[i]);
+    }
+    engine_.release(handle_);
 }
 
 template <typename T>
-void IndicatorGraph<T>::updatePlotAdd(const time_t candleTime, double value)
+void IndicatorGraph<T>::updatePlotAdd(const time_t candleTime, const std::vector<double>& values)
 {
-    auto indicatorDataPoints = indicator_->computeIndicatorPoint(value);
-
-    // indicatorDataPoints return the same number of points as
+    // the indicator returns the same number of points as
     // our number of graphs in graphs_. Plot these points
     // as separate graphs
     for(int i = 0; i < T::SIZE; ++i)
     {
-        graphDataContainers_[i]->add(QCPGraphData(candleTime, indicatorDataPoints[i]));
+        // the previous candle closed, its point joins the others
+        if(size_ > 0)
+        {
+            graphDataContainers_[i]->add(livePoints_[i]);
+        }
+        livePoints_[i] = QCPGraphData(candleTime, IndicatorEngine::value(values, handle_.output(i)));
+        updateLiveGraph(i);
     }
     ++size_;
 }
 
 template <typename T>
-void IndicatorGraph<T>::updatePlotReplace(const time_t candleTime, double value)
+void IndicatorGraph<T>::updatePlotReplace(const time_t candleTime, const std::vector<double>& values)
+{
+    if (size_ > 0)
+    {
+        for (int i = 0; i < T::SIZE; ++i)
+        {
+            // replace the previous point with the updated value;
+            livePoints_[i] = QCPGraphData(candleTime, IndicatorEngine::value(values, handle_.output(i)));
+            liveGraphs_[i]->data()->set(liveGraphs_[i]->data()->size() - 1, livePoints_[i]);
+        }
+    }
+}
+
+template <typename T>
+std::function<void()> IndicatorGraph<T>::startBackfill(std::vector<time_t> candleTimes, std::vector<SamplePoint> candles)
+{
+    auto job = std::make_shared<BackfillJob>(BackfillJob{ engine_.backfill(handle_), std::move(candleTimes), std::move(candles), {} });
+    backfill_ = job;
+
+    // the points are collected and added to new containers at once, already sorted
+    return [job]()
+    {
+        std::array<QVector<QCPGraphData>, T::SIZE> points;
+        for(int i = 0; i < T::SIZE; ++i)
+        {
+            points[i].reserve(static_cast<int>(job->candles.size()));
+        }
+
+        job->backfill.run(job->candles.data(), job->candles.size(), [&points, &job](size_t index, const double* outputs)
+        {
+            for(int i = 0; i < T::SIZE; ++i)
+            {
+                points[i].append(QCPGraphData(job->candleTimes[index], outputs[i]));
+            }
+        });
+
+        for(int i = 0; i < T::SIZE; ++i)
+        {
+            job->containers[i] = QSharedPointer<QCPDataContainer<QCPGraphData>>(new QCPDataContainer<QCPGraphData>);
+            job->containers[i]->add(points[i], true);
+        }
+    };
+}
+
+template <typename T>
+void IndicatorGraph<T>::finishBackfill(const std::vector<time_t>& candleTimes, const std::vector<SamplePoint>& candles)
 {
-	if (size_ > 0)
-	{
-		auto indicatorDataPoints = indicator_->recomputeIndicatorPoint(value);
-		for (int i = 0; i < T::SIZE; ++i)
-		{
-			// replace the previous point with the updated value;
-			graphDataContainers_[i]->set(size_ - 1, QCPGraphData(candleTime, indicatorDataPoints[i]));
-		}
-	}
+    if(backfill_ == nullptr || candles.empty())
+    {
+        return;
+    }
+
+    // the candles the engine took since the backfill started. the last is the one still forming
+    auto& job = *backfill_;
+    for(size_t index = 0; index < candles.size(); ++index)
+    {
+        job.backfill.update(candles[index]);
+        for(int i = 0; i < T::SIZE; ++i)
+        {
+            QCPGraphData point(candleTimes[index], job.backfill.value(handle_.output(i)));
+            if(index + 1 < candles.size())
+            {
+                job.containers[i]->add(point);
+            }
+            else
+            {
+                livePoints_[i] = point;
+            }
+        }
+    }
+    engine_.install(job.backfill);
+
+    // the points drawn meanwhile were computed without the history and are replaced
+    for(int i = 0; i < T::SIZE; ++i)
+    {
+        graphDataContainers_[i] = job.containers[i];
+        graphs_[i]->setData(graphDataContainers_[i]);
+        histories_[i].reset(new BarHistory<QCPGraphData>(graphDataContainers_[i]));
+        updateLiveGraph(i);
+    }
+    size_ = static_cast<int>(job.candles.size() + candles.size());
+    backfill_.reset();
+}
+
+template <typename T>
+void IndicatorGraph<T>::trimHistory(const QCPRange& view)
+{
+    for(int i = 0; i < T::SIZE; ++i)
+    {
+        histories_[i]->trim(view);
+    }
+}
+
+template <typename T>
+void IndicatorGraph<T>::loadHistory(const QCPRange& view)
+{
+    for(int i = 0; i < T::SIZE; ++i)
+    {
+        histories_[i]->load(view);
+    }
+}
+
+template <typename T>
+void IndicatorGraph<T>::updateLiveGraph(int output)
+{
+    auto& liveData = *liveGraphs_[output]->data();
+    liveData.clear();
+    if(!graphDataContainers_[output]->isEmpty())
+    {
+        liveData.add(*graphDataContainers_[output]->at(graphDataContainers_[output]->size() - 1));
+    }
+    liveData.add(livePoints_[output]);
 }
 
 template <typename T>
@@ -252,6 +451,7 @@ void IndicatorGraph<T>::rescaleValueAxisAutofit()
     for(int i = 0; i < T::SIZE; ++i)
     {
         graphs_[i]->rescaleValueAxis(true, true);
+        liveGraphs_[i]->rescaleValueAxis(true, true);
     }
 }
 
@@ -2,10 +2,89 @@
 #define INDICATORINCLUDES_H
 
 #include "../BaseModules/Indicators/Indicators.h"
+#include "../BaseModules/Indicators/IndicatorEngine.h"
 #include "../BaseModules/Indicators/SimpleMovingAverage.h"
 #include "../BaseModules/Indicators/BollingerBands.h"
 #include "../BaseModules/Indicators/RelativeStrengthIndex.h"
 #include "../BaseModules/Indicators/ExponentialMovingAverage.h"
+#include "../BaseModules/Indicators/Maximum.h"
+#include "../BaseModules/Indicators/Minimum.h"
+#include "../BaseModules/Indicators/DonchianChannel.h"
+#include "../BaseModules/Indicators/StochasticOscillator.h"
+#include "../BaseModules/Indicators/WilliamsR.h"
+#include "../BaseModules/Indicators/Aroon.h"
+#include "../BaseModules/Indicators/AroonOscillator.h"
+#include "../BaseModules/Indicators/DoubleExponentialMovingAverage.h"
+#include "../BaseModules/Indicators/TripleExponentialMovingAverage.h"
+#include "../BaseModules/Indicators/WeightedMovingAverage.h"
+#include "../BaseModules/Indicators/HullMovingAverage.h"
+#include "../BaseModules/Indicators/TriangularMovingAverage.h"
+#include "../BaseModules/Indicators/KaufmanAdaptiveMovingAverage.h"
+#include "../BaseModules/Indicators/ZeroLagExponentialMovingAverage.h"
+#include "../BaseModules/Indicators/VariableIndexDynamicAverage.h"
+#include "../BaseModules/Indicators/WildersSmoothing.h"
+#include "../BaseModules/Indicators/VolumeWeightedMovingAverage.h"
+#include "../BaseModules/Indicators/LinearRegression.h"
+#include "../BaseModules/Indicators/LinearRegressionSlope.h"
+#include "../BaseModules/Indicators/LinearRegressionIntercept.h"
+#include "../BaseModules/Indicators/TimeSeriesForecast.h"
+#include "../BaseModules/Indicators/ForecastOscillator.h"
+#include "../BaseModules/Indicators/SumOverPeriod.h"
+#include "../BaseModules/Indicators/Lag.h"
+#include "../BaseModules/Indicators/Momentum.h"
+#include "../BaseModules/Indicators/RateOfChange.h"
+#include "../BaseModules/Indicators/RateOfChangeRatio.h"
+#include "../BaseModules/Indicators/StandardDeviation.h"
+#include "../BaseModules/Indicators/Variance.h"
+#include "../BaseModules/Indicators/StandardError.h"
+#include "../BaseModules/Indicators/MeanDeviation.h"
+#include "../BaseModules/Indicators/VerticalHorizontalFilter.h"
+#include "../BaseModules/Indicators/AnnualizedHistoricalVolatility.h"
+#include "../BaseModules/Indicators/ChandeMomentumOscillator.h"
+#include "../BaseModules/Indicators/StochasticRsi.h"
+#include "../BaseModules/Indicators/DetrendedPriceOscillator.h"
+#include "../BaseModules/Indicators/Trix.h"
+#include "../BaseModules/Indicators/MovingAverageConvergenceDivergence.h"
+#include "../BaseModules/Indicators/PercentagePriceOscillator.h"
+#include "../BaseModules/Indicators/AbsolutePriceOscillator.h"
+#include "../BaseModules/Indicators/LinearDecay.h"
+#include "../BaseModules/Indicators/ExponentialDecay.h"
+#include "../BaseModules/Indicators/VolumeOscillator.h"
+#include "../BaseModules/Indicators/MesaSineWave.h"
+#include "../BaseModules/Indicators/MathTransform.h"
+#include "../BaseModules/Indicators/MathOperator.h"
+#include "../BaseModules/Indicators/Crossover.h"
+#include "../BaseModules/Indicators/AveragePrice.h"
+#include "../BaseModules/Indicators/MedianPrice.h"
+#include "../BaseModules/Indicators/TypicalPrice.h"
+#include "../BaseModules/Indicators/WeightedClosePrice.h"
+#include "../BaseModules/Indicators/MarketFacilitationIndex.h"
+#include "../BaseModules/Indicators/BalanceOfPower.h"
+#include "../BaseModules/Indicators/TrueRange.h"
+#include "../BaseModules/Indicators/AverageTrueRange.h"
+#include "../BaseModules/Indicators/NormalizedAverageTrueRange.h"
+#include "../BaseModules/Indicators/DirectionalMovement.h"
+#include "../BaseModules/Indicators/DirectionalIndicator.h"
+#include "../BaseModules/Indicators/DirectionalMovementIndex.h"
+#include "../BaseModules/Indicators/AverageDirectionalMovementIndex.h"
+#include "../BaseModules/Indicators/AverageDirectionalMovementRating.h"
+#include "../BaseModules/Indicators/ParabolicSar.h"
+#include "../BaseModules/Indicators/CommodityChannelIndex.h"
+#include "../BaseModules/Indicators/ChaikinsVolatility.h"
+#include "../BaseModules/Indicators/EaseOfMovement.h"
+#include "../BaseModules/Indicators/FisherTransform.h"
+#include "../BaseModules/Indicators/MassIndex.h"
+#include "../BaseModules/Indicators/Qstick.h"
+#include "../BaseModules/Indicators/UltimateOscillator.h"
+#include "../BaseModules/Indicators/AwesomeOscillator.h"
+#include "../BaseModules/Indicators/AccumulationDistributionLine.h"
+#include "../BaseModules/Indicators/AccumulationDistributionOscillator.h"
+#include "../BaseModules/Indicators/OnBalanceVolume.h"
+#include "../BaseModules/Indicators/NegativeVolumeIndex.h"
+#include "../BaseModules/Indicators/PositiveVolumeIndex.h"
+#include "../BaseModules/Indicators/MoneyFlowIndex.h"
+#include "../BaseModules/Indicators/KlingerVolumeOscillator.h"
+#include "../BaseModules/Indicators/WilliamsAccumulationDistribution.h"
 
 
 #endif // INDICATORINCLUDES_H
@@ -0,0 +1,57 @@
+#include "renderscheduler.h"
+#include <QElapsedTimer>
+#include "thetradingmachinetab.h"
+
+RenderScheduler::RenderScheduler(QTabWidget& tabs, QObject* parent) :
+    QObject(parent),
+    tabs_(tabs),
+    frameTimer_(this),
+    nextHidden_(0)
+{
+    connect(&frameTimer_, &QTimer::timeout, this, &RenderScheduler::frame);
+    connect(&tabs_, &QTabWidget::currentChanged, this, &RenderScheduler::currentChanged);
+    frameTimer_.start(FRAME_MS);
+}
+
+void RenderScheduler::frame()
+{
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    // the tab in view is always updated, and redrawn unless the window is minimized
+    auto current = qobject_cast<TheTradingMachineTab*>(tabs_.currentWidget());
+    if(current != nullptr)
+    {
+        current->ingest();
+        if(!tabs_.window()->isMinimized())
+        {
+            current->render();
+        }
+    }
+
+    // at least one hidden tab takes in its data every frame, even when the tab in view
+    // used up the budget, so that a busy tab in view can't starve the hidden ones
+    auto count = tabs_.count();
+    bool ingestedHidden = false;
+    for(int visited = 0; visited < count && (!ingestedHidden || elapsed.elapsed() < FRAME_BUDGET_MS); ++visited)
+    {
+        nextHidden_ = nextHidden_ % count;
+        auto tab = qobject_cast<TheTradingMachineTab*>(tabs_.widget(nextHidden_));
+        ++nextHidden_;
+        if(tab != nullptr && tab != current)
+        {
+            tab->ingest();
+            ingestedHidden = true;
+        }
+    }
+}
+
+void RenderScheduler::currentChanged(int index)
+{
+    // the tab was not rescaled or replotted while hidden
+    auto tab = qobject_cast<TheTradingMachineTab*>(tabs_.widget(index));
+    if(tab != nullptr)
+    {
+        tab->invalidate();
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef RENDERSCHEDULER_H
+#define RENDERSCHEDULER_H
+
+#include <QObject>
+#include <QTimer>
+#include <QTabWidget>
+
+// drives the tabs of a window from one timer. every frame the tab in view takes in
+// its new data and is redrawn. the hidden tabs only take in their data, keeping their
+// candles and indicators up to date without rescaling or replotting, one after the
+// other for as long as the frame budget lasts and at least one every frame. a tab is
+// redrawn in full when it is brought into view
+class RenderScheduler : public QObject
+{
+    Q_OBJECT
+public:
+    static const int FRAME_MS = 30;
+    static const int FRAME_BUDGET_MS = 20;
+
+    RenderScheduler(QTabWidget& tabs, QObject* parent);
+
+private slots:
+    void frame();
+    void currentChanged(int index);
+
+private:
+    QTabWidget& tabs_;
+    QTimer frameTimer_;
+
+    // the hidden tab the next frame starts with, so that every tab gets its turn
+    // when the budget runs out before all of them are done
+    int nextHidden_;
+};
+
+#endif // RENDERSCHEDULER_H
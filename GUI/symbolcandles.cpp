@@ -0,0 +1,179 @@
+#include "symbolcandles.h"
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include "barhistory.h"
+#include "candlepyramid.h"
+
+std::shared_ptr<SymbolCandles> SymbolCandles::acquire(std::shared_ptr<PlotTickRing> ticks)
+{
+    // tabs live on the gui thread, so no lock. the ring identifies the feed
+    static std::unordered_map<PlotTickRing*, std::weak_ptr<SymbolCandles>> series;
+
+    auto candles = series[ticks.get()].lock();
+    if(candles == nullptr)
+    {
+        for(auto it = series.begin(); it != series.end();)
+        {
+            if(it->first != ticks.get() && it->second.expired())
+            {
+                it = series.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        candles = std::make_shared<SymbolCandles>(ticks);
+        series[ticks.get()] = candles;
+    }
+    return candles;
+}
+
+SymbolCandles::SymbolCandles(std::shared_ptr<PlotTickRing> ticks) :
+    ring_(ticks),
+    ticks_(std::make_shared<TickSeries>()),
+    tickCount_(0),
+    tickWatchers_(0),
+    candleMaker_(CandlePyramid::BASE_TIME_FRAME),
+    indicatorsTime_(0),
+    firstCandle_(0)
+{
+    current_.candle = Candlestick();
+}
+
+void SymbolCandles::update()
+{
+    plotTicks_.clear();
+    if(ring_->drain(plotTicks_) == 0)
+    {
+        return;
+    }
+
+    tickBuffer_.clear();
+    for(const auto& plotTick: plotTicks_)
+    {
+        appendTicks(plotTick, tickBuffer_);
+    }
+
+    // the closed candles are taken out as they close so the candle maker's ring never overflows
+    for(const auto& tick: tickBuffer_)
+    {
+        ++tickCount_;
+        if(tickWatchers_ > 0)
+        {
+            ticks_->add(tick);
+        }
+        candleMaker_.addTick(tick);
+
+        Candlestick closedCandle;
+        while(candleMaker_.popClosedCandle(closedCandle))
+        {
+            closed_.emplace_back();
+            updateIndicators(closedCandle, closed_.back());
+        }
+    }
+    updateIndicators(candleMaker_.currentCandle(), current_);
+
+    while(closed_.size() > static_cast<size_t>(DEFAULT_RETAINED_BARS))
+    {
+        closed_.pop_front();
+        ++firstCandle_;
+    }
+}
+
+bool SymbolCandles::read(Cursor& cursor, std::vector<Bar>& closed, Bar& current)
+{
+    if(cursor.ticks == tickCount_)
+    {
+        return false;
+    }
+
+    // a tab that fell further behind than the candles kept goes on from the oldest one
+    auto lastCandle = firstCandle_ + closed_.size();
+    for(auto index = std::max(cursor.candles, firstCandle_); index < lastCandle; ++index)
+    {
+        closed.push_back(closed_[index - firstCandle_]);
+    }
+    current = current_;
+
+    cursor.candles = lastCandle;
+    cursor.ticks = tickCount_;
+    cursor.current = current.candle.time;
+    return true;
+}
+
+std::shared_ptr<const TickSeries> SymbolCandles::ticks() const
+{
+    return ticks_;
+}
+
+void SymbolCandles::watchTicks(bool watch)
+{
+    tickWatchers_ += watch ? 1 : -1;
+    if(tickWatchers_ == 0)
+    {
+        ticks_->clear();
+    }
+}
+
+IndicatorEngine& SymbolCandles::indicators()
+{
+    return indicators_;
+}
+
+void SymbolCandles::updateIndicators(const Candlestick& candle, Bar& bar)
+{
+    bar.candle = candle;
+
+    // there is no candle until the first whole time frame starts
+    if(candle.time == 0)
+    {
+        return;
+    }
+
+    SamplePoint sample{ candle.open, candle.high, candle.low, candle.close, static_cast<double>(candle.volume) };
+    indicators_.update(sample, candle.time != indicatorsTime_);
+    indicatorsTime_ = candle.time;
+    bar.indicators = indicators_.values();
+}
+
+// turns a tick from the feed back into ticks for the candle maker. a run the feed conflated
+// while the gui was behind becomes its open, high, low and close with no size, and its whole
+// size at its average price, so the candle gets the same ohlc, volume and wap
+void SymbolCandles::appendTicks(const PlotTick& plotTick, std::vector<Tick>& ticks)
+{
+    Tick tick = Tick();
+    tick.time = plotTick.time;
+    if(plotTick.count == 1)
+    {
+        tick.price = plotTick.close;
+        tick.size = static_cast<int>(plotTick.size);
+        ticks.push_back(tick);
+        return;
+    }
+
+    tick.time = plotTick.firstTime;
+    tick.size = 0;
+    for(auto price: {plotTick.open, plotTick.high, plotTick.low})
+    {
+        tick.price = price;
+        ticks.push_back(tick);
+    }
+
+    tick.time = plotTick.time;
+    if(plotTick.size > 0)
+    {
+        tick.price = plotTick.notional / plotTick.size;
+        for(auto size = plotTick.size; size > 0; size -= tick.size)
+        {
+            tick.size = static_cast<int>(std::min<long long>(size, std::numeric_limits<int>::max()));
+            ticks.push_back(tick);
+        }
+    }
+
+    tick.price = plotTick.close;
+    tick.size = 0;
+    ticks.push_back(tick);
+}
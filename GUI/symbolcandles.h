@@ -0,0 +1,91 @@
+#ifndef SYMBOLCANDLES_H
+#define SYMBOLCANDLES_H
+
+#include <ctime>
+#include <deque>
+#include <memory>
+#include <vector>
+#include "../BaseModules/BaseAlgorithm/PlotData.h"
+#include "../BaseModules/CandleMaker/CandleMaker.h"
+#include "../BaseModules/Indicators/IndicatorEngine.h"
+#include "tickseries.h"
+
+// the ticks and candles of a feed, made once for every tab showing it. the algorithms on
+// an input share its feed and so its tick ring, which only has one reader: this drains it
+// and folds the ticks into candles, and each tab reads what is new since it last looked
+// through its own cursor. a tab opened later starts with the candles made so far
+//
+// the indicators of the feed are computed here too, once per candle for every tab. the tabs
+// don't read them at the same time, so the values after each candle are kept with it
+class SymbolCandles
+{
+public:
+    // a candle and the values of the indicators of the feed after it, indexed by the slot of
+    // their series. see IndicatorEngine::values
+    struct Bar
+    {
+        Candlestick candle;
+        std::vector<double> indicators;
+    };
+
+    // where a tab is in the series
+    struct Cursor
+    {
+        // closed candles and ticks the tab has read, ticks counted whether they were kept or not
+        size_t candles;
+        size_t ticks;
+
+        // time of the candle that was current when the tab last read, 0 before it first did
+        time_t current;
+    };
+
+    // series of the feed the ring belongs to, made by the first tab asking for it and
+    // dropped with the last one holding it
+    static std::shared_ptr<SymbolCandles> acquire(std::shared_ptr<PlotTickRing> ticks);
+
+    explicit SymbolCandles(std::shared_ptr<PlotTickRing> ticks);
+
+    SymbolCandles(const SymbolCandles& other) = delete;
+    SymbolCandles& operator=(const SymbolCandles& other) = delete;
+
+    // takes in the ticks the feed sent since any tab last called it
+    void update();
+
+    // false if no tick came since the cursor. otherwise the candles closed since then,
+    // oldest first, and the current candle, and the cursor is moved past them
+    bool read(Cursor& cursor, std::vector<Bar>& closed, Bar& current);
+
+    // the ticks of the feed, for the plots that draw them. they are only kept while a plot
+    // watches them, from when the first one started to
+    std::shared_ptr<const TickSeries> ticks() const;
+    void watchTicks(bool watch);
+
+    // the indicators of the feed. the plots add theirs here and read the values from the
+    // bars, graphs of the same indicator on any tab share its node
+    IndicatorEngine& indicators();
+
+private:
+    static void appendTicks(const PlotTick& plotTick, std::vector<Tick>& ticks);
+
+    // gives the candle to the indicators, as a new bar unless it is the one they took last
+    void updateIndicators(const Candlestick& candle, Bar& bar);
+
+    std::shared_ptr<PlotTickRing> ring_;
+    std::vector<PlotTick> plotTicks_;
+    std::vector<Tick> tickBuffer_;
+
+    std::shared_ptr<TickSeries> ticks_;
+    size_t tickCount_;
+    int tickWatchers_;
+    CandleMaker candleMaker_;
+    IndicatorEngine indicators_;
+    time_t indicatorsTime_;
+
+    // the latest closed candles, for tabs to catch up from, and the current one. firstCandle_
+    // is the number of candles that closed before the first one kept
+    std::deque<Bar> closed_;
+    Bar current_;
+    size_t firstCandle_;
+};
+
+#endif // SYMBOLCANDLES_H
@@ -22,6 +22,7 @@ TheTradingMachineMainWindow::TheTradingMachineMainWindow(QWidget *parent) :
     // the tab was created in qt designer as a template. we will use the generated code
     // to programmatically add/remove tabs
     ui->tabWidget->removeTab(0);
+    renderScheduler_ = new RenderScheduler(*ui->tabWidget, this);
     this->show();
 
     // We set this attribute because we don't keep a handle to each new window.
@@ -55,7 +56,9 @@ TheTradingMachineMainWindow::~TheTradingMachineMainWindow()
     // (result of FreeLibrary)
 
     // deleting children explicitly is not recommended but necessary here
-    // deleting the tabWidget will remove all the tabs
+    // deleting the tabWidget will remove all the tabs. the scheduler goes
+    // first since it refers to the tabWidget
+    delete renderScheduler_;
     delete ui->tabWidget;
 
     qDebug("window destruct");
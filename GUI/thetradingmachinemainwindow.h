@@ -17,6 +17,7 @@
 // The Trading Machine
 #include "../BaseModules/InteractiveBrokersClient/InteractiveBrokersClient.h"
 #include "thetradingmachinetab.h"
+#include "renderscheduler.h"
 
 
 namespace Ui {
@@ -61,6 +62,9 @@ private:
     // currentTab
     TheTradingMachineTab* currentTab;
 
+    // updates and redraws the tabs of this window
+    RenderScheduler* renderScheduler_;
+
     bool valid_;
 
 // functions
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <algorithm>
 #include "thetradingmachinetab.h"
 #include "playdialog.h"
 #include "../BaseModules/Indicators/SimpleMovingAverage.h"
@@ -7,14 +8,17 @@
 
 TheTradingMachineTab::TheTradingMachineTab(const QString input, bool liveTrading, const AlgorithmApi& api, std::shared_ptr<InteractiveBrokersClient> client, QWidget* parent) :
     QWidget(parent),
-    replotTimer_(new QTimer(this)),
     api_(api),
     client_(client),
-    candleMaker_(60)
+    cursor_{ 0, 0, 0 }
 {
     valid_ = false;
     name_ = formatTabName(input);
 
+    // the window's render scheduler takes in the data and plots it
+    replot_ = true;
+    fullReplot_ = true;
+
     if(name_.size() == 0)
     {
         return;
@@ -27,16 +31,29 @@ TheTradingMachineTab::TheTradingMachineTab(const QString input, bool liveTrading
     {
         // tab should only be valid if play algorithm and getplotdata worked
         valid_ = true;
-        connect(replotTimer_, &QTimer::timeout, this, &TheTradingMachineTab::updatePlot);
     }
 
     // this sets up the widget grid and qcustomplot instance
     layoutSetup();
 
+    // the candles and indicators of the feed are made once for every tab on it
+    if(valid_)
+    {
+        candles_ = SymbolCandles::acquire(plotData_->ticks);
+    }
+
     // create basic plots. 0 and 1 indices are reserved for candle and volume
     // plots
-    plots_[0] = std::make_unique<CandlePlot>(*plot_);
-    plots_[1] = std::make_unique<VolumePlot>(*plot_);
+    plots_[0] = std::make_unique<CandlePlot>(*plot_, candles_);
+    plots_[1] = std::make_unique<VolumePlot>(*plot_, candles_);
+
+    if(valid_)
+    {
+        for(auto plot: plots_)
+        {
+            plot.second->setTicks(candles_->ticks());
+        }
+    }
 
     plot_->setContextMenuPolicy(Qt::CustomContextMenu);
     connect(plot_, &QCustomPlot::customContextMenuRequested, this, &TheTradingMachineTab::menuShowSlot);
@@ -48,12 +65,6 @@ TheTradingMachineTab::TheTradingMachineTab(const QString input, bool liveTrading
     plotActive_ = false;
     lastPlotDataIndex_ = 0;
     lastAnnotationIndex_ = 0;
-
-    // get the time now
-    lastTickReceivedTime = std::chrono::high_resolution_clock::now();
-    // start the plotting
-    replotTimer_->start(30);
-    replotCount_ = 0;
 }
 
 TheTradingMachineTab::~TheTradingMachineTab()
@@ -118,142 +129,157 @@ QString TheTradingMachineTab::formatTabName(const QString &input)
     return inputFormatted;
 }
 
-void TheTradingMachineTab::updatePlotNewCandle(const Candlestick &candle)
+void TheTradingMachineTab::updatePlotNewCandle(const SymbolCandles::Bar &bar)
 {
     for(auto plot: plots_)
     {
-        plot.second->updatePlotAdd(candle);
+        plot.second->updatePlotAdd(bar);
     }
 }
 
-void TheTradingMachineTab::updatePlotReplaceCandle(const Candlestick &candle)
+void TheTradingMachineTab::updatePlotReplaceCandle(const SymbolCandles::Bar &bar)
 {
     for(auto plot: plots_)
     {
-        plot.second->updatePlotReplace(candle);
+        plot.second->updatePlotReplace(bar);
     }
 }
 
-void TheTradingMachineTab::updatePlot(void)
+void TheTradingMachineTab::ingest()
 {
-    std::unique_lock<std::mutex> lock(plotData_->plotDataMtx);
-
-    auto tickBuffer = std::move(plotData_->ticks);
-    auto annotationBuffer = std::move(plotData_->annotations);
+    if(!valid_)
+    {
+        return;
+    }
 
-    plotData_->ticks.clear();
-    plotData_->annotations.clear();
+    auto annotationBuffer = plotData_->annotations.takeAll();
 
-    lock.unlock();
+    // whichever tab on the feed comes first takes in its ticks, the others only read
+    candles_->update();
 
-    // dynamically adjust the refresh rate based on number of ticks received
-    if(tickBuffer.size() > 0)
+    // the plots are updated once for each candle that changed. a closed candle replaces the
+    // candle the tab had as current if it is the same one and is appended otherwise, and
+    // the current candle either is appended after them or replaces the most recent one
+    closedBars_.clear();
+    auto plottedTime = cursor_.current;
+    if(candles_->read(cursor_, closedBars_, currentBar_) && currentBar_.candle.time != 0)
     {
-        replotCount_ = 0;
-        using namespace std::chrono;
-        auto timeNow = high_resolution_clock::now();
-        auto diffTimeMs = duration_cast<milliseconds>(timeNow - lastTickReceivedTime).count();
-        lastTickReceivedTime = timeNow;
-        auto refreshDelayMs = static_cast<int>(static_cast<decltype(tickBuffer.size())>(diffTimeMs)/tickBuffer.size());
-
-        if(refreshDelayMs < 30 && replotTimer_->interval() > 30)
-        {
-            // refresh delay capped at 30ms
-            replotTimer_->setInterval(30);
-        }
-        else if(refreshDelayMs >= 30 && refreshDelayMs < 5000)
+        const auto& currentCandle = currentBar_.candle;
+        auto firstChangedTime = currentCandle.time;
+        for(const auto& bar: closedBars_)
         {
-            replotTimer_->setInterval(refreshDelayMs);
+            if(bar.candle.time == plottedTime)
+            {
+                updatePlotReplaceCandle(bar);
+            }
+            else
+            {
+                updatePlotNewCandle(bar);
+            }
+            firstChangedTime = std::min(firstChangedTime, bar.candle.time);
         }
-    }
-    else
-    {
-        // once the ticks stop getting sent as frequently, set it to 5 seconds refresh rate.
-        // the refresh rate will begin to increase in premarket and ramp up to a faster
-        // rate by the time market starts. use a counter to wait for data at the faster rate
-        // before switching to the slow rate
-        if(replotCount_ < 10)
+
+        if(currentCandle.time != plottedTime)
         {
-            ++replotCount_;
+            updatePlotNewCandle(currentBar_);
+            fullReplot_ = true;
         }
         else
         {
-            replotTimer_->setInterval(5000);
+            updatePlotReplaceCandle(currentBar_);
         }
-    }
-
-    // replot only if there are any visible update in the current view
-    bool replot = false;
-    for(auto& tick: tickBuffer)
-    {
-        candleMaker_.addTick(tick);
-        auto closedCandles = candleMaker_.getClosedCandles();
-        auto currentCandle = candleMaker_.getCurrentCandle();
-
-        // for new closed candles, replaced the most recent candle
-        // with the closed candle
-        if(closedCandles.size() > 0)
-        {
-            // if there are new closed candles, we replace
-            // the most recent candle with the first closed
-            // candle
-            updatePlotReplaceCandle(closedCandles[0]);
-
-            // if there are more closed candles (this is possible
-            // when the refresh rate of the plot is low)
-            for(decltype(closedCandles.size()) i = 1; i < closedCandles.size(); ++i)
-            {
-                updatePlotNewCandle(closedCandles[i]);
-            }
-
-            // finally add in the current candle which will update with each new tick
-            updatePlotNewCandle(currentCandle);
 
-        }
-        else
+        // grab any axisRect and check the key axis range against the candles that changed
+        const auto& keyRange = plot_->axisRect(0)->axis(QCPAxis::AxisType::atBottom)->range();
+        if(currentCandle.time >= keyRange.lower && firstChangedTime <= keyRange.upper)
         {
-            // if there are no new candles, simply update
-            // the most recent candle with the updated tick
-            updatePlotReplaceCandle(currentCandle);
+            replot_ = true;
         }
+    }
 
-        // grab any axisRect and check the key axis range to determine replot
-        const auto& candlePlotKeyAxis = plot_->axisRect(0)->axis(QCPAxis::AxisType::atBottom);
-        // if we toggled replot, no need to keep doing this for every tick
-        if(!replot)
+    // indicators whose past candles were computed since the last frame are swapped in
+    for(auto plot: plots_)
+    {
+        if(plot.second->finishBackfills())
         {
-            if(currentCandle.time >= candlePlotKeyAxis->range().lower && currentCandle.time <= candlePlotKeyAxis->range().upper)
-            {
-                replot = true;
-            }
+            replot_ = true;
+            fullReplot_ = true;
         }
     }
 
-    // add any new annotations from our user to the charts
+    // add any new annotations from our user to the charts. they are only stored
+    // until the tab is rendered
     for(auto& annotation: annotationBuffer)
     {
         if(annotation != nullptr)
         {
             if(plots_.find(annotation->index_) == plots_.end())
             {
-                plots_[annotation->index_] = std::make_unique<AnnotationPlot>(*plot_);
+                plots_[annotation->index_] = std::make_unique<AnnotationPlot>(*plot_, candles_);
             }
             plots_[annotation->index_]->addAnnotation(annotation);
+            replot_ = true;
+            fullReplot_ = true;
         }
     }
+}
+
+void TheTradingMachineTab::render()
+{
+    // replot only if there are any visible update in the current view. as long as
+    // no candle closes, no annotation is added and no axis moves, only the live
+    // layer changed and the closed candles are drawn from its buffered layers
+    if(!replot_)
+    {
+        return;
+    }
+
+    for(auto plot: plots_)
+    {
+        plot.second->refreshAnnotations();
+    }
 
     // rescale all the plots according to their own defined scaling
     // function
+    auto rangesBefore = axisRanges();
     for(auto plot: plots_)
     {
         plot.second->rescalePlot();
     }
+    if(axisRanges() != rangesBefore)
+    {
+        fullReplot_ = true;
+    }
 
-    if(replot)
+    if(fullReplot_)
     {
         plot_->replot();
-        replot = false;
     }
+    else
+    {
+        plot_->layer(LIVE_LAYER_NAME)->replot();
+    }
+    replot_ = false;
+    fullReplot_ = false;
+}
+
+void TheTradingMachineTab::invalidate()
+{
+    replot_ = true;
+    fullReplot_ = true;
+}
+
+std::vector<QCPRange> TheTradingMachineTab::axisRanges() const
+{
+    std::vector<QCPRange> ranges;
+    for(auto axisRect: plot_->axisRects())
+    {
+        for(auto axis: axisRect->axes())
+        {
+            ranges.push_back(axis->range());
+        }
+    }
+    return ranges;
 }
 
 void TheTradingMachineTab::menuShowSlot(QPoint pos)
@@ -4,17 +4,17 @@
 #include <QWidget>
 #include <QtWidgets/QScrollBar>
 #include <QtWidgets/QGridLayout>
-#include <QTimer>
 #include <memory>
 #include <thread>
 #include <unordered_map>
 #include <list>
-#include <chrono>
+#include <vector>
 #include "qcustomplot.h"
 #include "../BaseModules/InteractiveBrokersClient/InteractiveBrokersClient.h"
 #include "../BaseModules/BaseAlgorithm/PlotData.h"
 #include "../BaseModules/CandleMaker/CandleMaker.h"
 #include "candleplot.h"
+#include "symbolcandles.h"
 #include "volumeplot.h"
 
 // this is a tab set up for the tab pages in the trading machine
@@ -41,12 +41,19 @@ public:
     QString tabName() const;
     bool valid() const;
 
+    // called by the window's render scheduler. ingest takes in the new ticks and
+    // annotations and updates the candles and indicators, render rescales and
+    // replots what changed since it last ran. invalidate has the next render redraw
+    // everything, for a tab that was not rendered while hidden
+    void ingest();
+    void render();
+    void invalidate();
+
     TheTradingMachineTab(const QString input, bool liveTrading, const AlgorithmApi &api, std::shared_ptr<InteractiveBrokersClient> client, QWidget *parent);
 private:
     // plot items
     QGridLayout *gridLayout_;
     QCustomPlot *plot_;
-    QTimer* replotTimer_;
     QString name_;
 
     //algorithm api
@@ -54,15 +61,17 @@ private:
     int algorithmHandle_;
     std::shared_ptr<InteractiveBrokersClient> client_;
     std::shared_ptr<PlotData> plotData_;
+    std::vector<SymbolCandles::Bar> closedBars_;
+    SymbolCandles::Bar currentBar_;
 
     // using pointers for polymorphism and vectors because
     // we will be indexing into different plots to add user
     // annotations
     std::unordered_map<int, std::shared_ptr<BasePlot>> plots_;
 
-    // candle data
-    Candlestick currentCandle_;
-    CandleMaker candleMaker_;
+    // candle data, shared with the other tabs on the same feed
+    std::shared_ptr<SymbolCandles> candles_;
+    SymbolCandles::Cursor cursor_;
     std::vector<double>::size_type lastPlotDataIndex_;
     std::vector<double>::size_type lastAnnotationIndex_;
 
@@ -70,9 +79,11 @@ private:
     bool autoScale_;
     bool plotActive_;
     bool valid_;
-    int replotCount_;
 
-    decltype(std::chrono::high_resolution_clock::now()) lastTickReceivedTime;
+    // what the next render has to do. replot_ when something in view changed,
+    // fullReplot_ when more than the live layer did
+    bool replot_;
+    bool fullReplot_;
 
     enum MenuType
     {
@@ -82,11 +93,13 @@ private:
 private:
     void layoutSetup();
     QString formatTabName(const QString& input);
-    void updatePlotNewCandle(const Candlestick &candle);
-    void updatePlotReplaceCandle(const Candlestick &candle);
+    void updatePlotNewCandle(const SymbolCandles::Bar &bar);
+    void updatePlotReplaceCandle(const SymbolCandles::Bar &bar);
+
+    // the ranges of every axis, to tell whether rescaling moved any of them
+    std::vector<QCPRange> axisRanges() const;
 
 private slots:
-    void updatePlot(void);
     void menuShowSlot(QPoint pos);
 
 };
@@ -0,0 +1,119 @@
+#include "tickchart.h"
+#include <cmath>
+
+TickChart::TickChart(QCPAxis* keyAxis, QCPAxis* valueAxis) :
+    QCPAbstractPlottable(keyAxis, valueAxis),
+    series_(std::make_shared<TickSeries>())
+{
+}
+
+void TickChart::setSeries(std::shared_ptr<const TickSeries> series)
+{
+    series_ = series;
+}
+
+const TickSeries& TickChart::series() const
+{
+    return *series_;
+}
+
+double TickChart::selectTest(const QPointF&, bool, QVariant*) const
+{
+    // the ticks are not selectable
+    return -1;
+}
+
+QCPRange TickChart::getKeyRange(bool& foundRange, QCP::SignDomain) const
+{
+    foundRange = !series_->empty();
+    if(!foundRange)
+    {
+        return QCPRange();
+    }
+    return QCPRange(series_->key(0), series_->key(series_->size() - 1));
+}
+
+QCPRange TickChart::getValueRange(bool& foundRange, QCP::SignDomain, const QCPRange& inKeyRange) const
+{
+    // prices are positive, whatever the sign domain
+    size_t begin = 0;
+    size_t end = series_->size();
+    if(inKeyRange != QCPRange())
+    {
+        begin = series_->lowerBound(inKeyRange.lower);
+        end = series_->lowerBound(inKeyRange.upper);
+    }
+
+    foundRange = end > begin;
+    if(!foundRange)
+    {
+        return QCPRange();
+    }
+
+    float low;
+    float high;
+    series_->extremes(begin, end, low, high);
+    return QCPRange(low, high);
+}
+
+void TickChart::draw(QCPPainter* painter)
+{
+    if(!mKeyAxis || !mValueAxis || series_->empty())
+    {
+        return;
+    }
+
+    auto keyRange = mKeyAxis->range();
+    auto pixels = static_cast<int>(std::abs(mKeyAxis->coordToPixel(keyRange.upper) - mKeyAxis->coordToPixel(keyRange.lower)));
+    if(pixels <= 0)
+    {
+        return;
+    }
+    series_->decimate(keyRange.lower, keyRange.upper, pixels, columns_);
+
+    points_.clear();
+    points_.reserve(static_cast<int>(columns_.size()) * 4 + 2);
+
+    // the ticks just outside the view carry the line on to its edges
+    auto first = series_->lowerBound(keyRange.lower);
+    if(first > 0)
+    {
+        points_.append(coordsToPixels(series_->key(first - 1), series_->price(first - 1)));
+    }
+
+    auto width = keyRange.size() / pixels;
+    for(size_t index = 0; index < columns_.size(); ++index)
+    {
+        const auto& column = columns_[index];
+        if(column.count == 0)
+        {
+            continue;
+        }
+
+        auto key = keyRange.lower + width * (static_cast<double>(index) + 0.5);
+        points_.append(coordsToPixels(key, column.first));
+        if(column.count > 1)
+        {
+            points_.append(coordsToPixels(key, column.low));
+            points_.append(coordsToPixels(key, column.high));
+            points_.append(coordsToPixels(key, column.last));
+        }
+    }
+
+    auto next = series_->lowerBound(keyRange.upper);
+    if(next < series_->size())
+    {
+        points_.append(coordsToPixels(series_->key(next), series_->price(next)));
+    }
+
+    applyDefaultAntialiasingHint(painter);
+    painter->setPen(mPen);
+    painter->drawPolyline(points_.constData(), points_.size());
+}
+
+void TickChart::drawLegendIcon(QCPPainter* painter, const QRectF& rect) const
+{
+    applyDefaultAntialiasingHint(painter);
+    painter->setPen(mPen);
+    painter->drawLine(QLineF(rect.left(), rect.center().y(), rect.right(), rect.center().y()));
+}
@@ -0,0 +1,37 @@
+#ifndef TICKCHART_H
+#define TICKCHART_H
+
+#include <memory>
+#include <vector>
+#include "qcustomplot.h"
+#include "tickseries.h"
+
+// draws the ticks of a TickSeries as a line. the view is decimated to one column per
+// pixel, each drawn from its first tick through its lowest and highest to its last, so
+// drawing takes the same time for a second of ticks as for a whole session
+class TickChart : public QCPAbstractPlottable
+{
+public:
+    TickChart(QCPAxis* keyAxis, QCPAxis* valueAxis);
+
+    // the series drawn, which is filled elsewhere and may be drawn by other charts too
+    void setSeries(std::shared_ptr<const TickSeries> series);
+    const TickSeries& series() const;
+
+    double selectTest(const QPointF& pos, bool onlySelectable, QVariant* details = nullptr) const override;
+    QCPRange getKeyRange(bool& foundRange, QCP::SignDomain inSignDomain = QCP::sdBoth) const override;
+    QCPRange getValueRange(bool& foundRange, QCP::SignDomain inSignDomain = QCP::sdBoth, const QCPRange& inKeyRange = QCPRange()) const override;
+
+protected:
+    void draw(QCPPainter* painter) override;
+    void drawLegendIcon(QCPPainter* painter, const QRectF& rect) const override;
+
+private:
+    std::shared_ptr<const TickSeries> series_;
+
+    // reused by every draw
+    std::vector<TickSeries::Column> columns_;
+    QVector<QPointF> points_;
+};
+
+#endif // TICKCHART_H
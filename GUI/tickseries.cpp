@@ -0,0 +1,247 @@
+#include "tickseries.h"
+#include <algorithm>
+#include <limits>
+
+TickSeries::TickSeries(size_t retainedTicks) :
+    retainedTicks_(retainedTicks),
+    lastTime_(0),
+    secondSlot_(0)
+{
+}
+
+void TickSeries::add(const Tick& tick)
+{
+    // the keys stay sorted even if a tick comes with an earlier time than the one before
+    auto time = std::max(tick.time, lastTime_);
+    if(!keys_.empty() && time == lastTime_)
+    {
+        secondSlot_ = std::min(secondSlot_ + 1, SECOND_SLOTS - 1);
+    }
+    else
+    {
+        secondSlot_ = 0;
+    }
+    lastTime_ = time;
+
+    auto price = static_cast<float>(tick.price);
+    keys_.push_back(static_cast<double>(time) + static_cast<double>(secondSlot_) / SECOND_SLOTS);
+    prices_.push_back(price);
+    sizes_.push_back(tick.size);
+
+    // the tick goes into its node on every level, up to the level with a single node
+    auto node = (keys_.size() - 1) / BLOCK_TICKS;
+    for(size_t level = 0; ; ++level)
+    {
+        if(level == levels_.size())
+        {
+            // a new top level, made from the level below which just got its second node
+            std::vector<Extremes> top;
+            if(level > 0)
+            {
+                const auto& below = levels_[level - 1];
+                for(size_t index = 0; index < below.size(); ++index)
+                {
+                    if(index / FANOUT == top.size())
+                    {
+                        top.push_back(below[index]);
+                    }
+                    else
+                    {
+                        merge(top.back(), below[index].low, below[index].high);
+                    }
+                }
+            }
+            levels_.push_back(std::move(top));
+        }
+
+        auto& nodes = levels_[level];
+        if(node == nodes.size())
+        {
+            nodes.push_back(Extremes{ price, price });
+        }
+        else
+        {
+            merge(nodes[node], price, price);
+        }
+
+        if(nodes.size() == 1)
+        {
+            break;
+        }
+        node /= FANOUT;
+    }
+
+    if(keys_.size() > retainedTicks_ + PAGE_TICKS)
+    {
+        trim();
+    }
+}
+
+void TickSeries::clear()
+{
+    keys_.clear();
+    prices_.clear();
+    sizes_.clear();
+    levels_.clear();
+    lastTime_ = 0;
+    secondSlot_ = 0;
+}
+
+size_t TickSeries::size() const
+{
+    return keys_.size();
+}
+
+bool TickSeries::empty() const
+{
+    return keys_.empty();
+}
+
+double TickSeries::key(size_t index) const
+{
+    return keys_[index];
+}
+
+float TickSeries::price(size_t index) const
+{
+    return prices_[index];
+}
+
+int TickSeries::tickSize(size_t index) const
+{
+    return sizes_[index];
+}
+
+size_t TickSeries::lowerBound(double key) const
+{
+    return static_cast<size_t>(std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin());
+}
+
+void TickSeries::extremes(size_t begin, size_t end, float& low, float& high) const
+{
+    Extremes result{ std::numeric_limits<float>::max(), std::numeric_limits<float>::lowest() };
+    auto scanTicks = [this, &result](size_t from, size_t to)
+    {
+        for(auto index = from; index < to; ++index)
+        {
+            merge(result, prices_[index], prices_[index]);
+        }
+    };
+
+    // the ticks before the first whole block and after the last one are looked at
+    // one by one, the whole blocks through the tree
+    auto nodeBegin = (begin + BLOCK_TICKS - 1) / BLOCK_TICKS;
+    auto nodeEnd = end / BLOCK_TICKS;
+    if(nodeBegin >= nodeEnd)
+    {
+        scanTicks(begin, end);
+    }
+    else
+    {
+        scanTicks(begin, nodeBegin * BLOCK_TICKS);
+        scanTicks(nodeEnd * BLOCK_TICKS, end);
+
+        // likewise on every level, the nodes not covered by a whole node of the level
+        // above are looked at on this one
+        for(size_t level = 0; nodeBegin < nodeEnd; ++level)
+        {
+            const auto& nodes = levels_[level];
+            auto upBegin = (nodeBegin + FANOUT - 1) / FANOUT;
+            auto upEnd = nodeEnd / FANOUT;
+            if(upBegin >= upEnd)
+            {
+                upBegin = upEnd = nodeEnd;
+            }
+
+            for(auto index = nodeBegin; index < std::min(upBegin * FANOUT, nodeEnd); ++index)
+            {
+                merge(result, nodes[index].low, nodes[index].high);
+            }
+            for(auto index = std::max(upEnd * FANOUT, nodeBegin); index < nodeEnd; ++index)
+            {
+                merge(result, nodes[index].low, nodes[index].high);
+            }
+            nodeBegin = upBegin;
+            nodeEnd = upEnd;
+        }
+    }
+
+    low = result.low;
+    high = result.high;
+}
+
+void TickSeries::decimate(double lower, double upper, int count, std::vector<Column>& columns) const
+{
+    columns.assign(static_cast<size_t>(std::max(count, 0)), Column{ 0, 0, 0, 0, 0 });
+    if(columns.empty() || keys_.empty())
+    {
+        return;
+    }
+
+    // each column ends where the next one begins, so every boundary is searched once
+    auto width = (upper - lower) / count;
+    auto begin = lowerBound(lower);
+    for(size_t column = 0; column < columns.size(); ++column)
+    {
+        auto boundary = column + 1 == columns.size() ? upper : lower + width * static_cast<double>(column + 1);
+        auto end = static_cast<size_t>(std::lower_bound(keys_.begin() + static_cast<std::ptrdiff_t>(begin), keys_.end(), boundary) - keys_.begin());
+        if(end > begin)
+        {
+            auto& target = columns[column];
+            target.count = end - begin;
+            target.first = prices_[begin];
+            target.last = prices_[end - 1];
+            extremes(begin, end, target.low, target.high);
+        }
+        begin = end;
+    }
+}
+
+void TickSeries::merge(Extremes& extremes, float low, float high)
+{
+    extremes.low = std::min(extremes.low, low);
+    extremes.high = std::max(extremes.high, high);
+}
+
+void TickSeries::trim()
+{
+    auto dropped = static_cast<std::ptrdiff_t>(keys_.size() - retainedTicks_);
+    keys_.erase(keys_.begin(), keys_.begin() + dropped);
+    prices_.erase(prices_.begin(), prices_.begin() + dropped);
+    sizes_.erase(sizes_.begin(), sizes_.begin() + dropped);
+
+    // a node for each block, then each level from the one below until a level has a
+    // single node, the same tree add makes one tick at a time
+    levels_.clear();
+    std::vector<Extremes> blocks;
+    for(size_t index = 0; index < prices_.size(); ++index)
+    {
+        if(index % BLOCK_TICKS == 0)
+        {
+            blocks.push_back(Extremes{ prices_[index], prices_[index] });
+        }
+        else
+        {
+            merge(blocks.back(), prices_[index], prices_[index]);
+        }
+    }
+    levels_.push_back(std::move(blocks));
+
+    while(levels_.back().size() > 1)
+    {
+        std::vector<Extremes> top;
+        const auto& below = levels_.back();
+        for(size_t index = 0; index < below.size(); ++index)
+        {
+            if(index % FANOUT == 0)
+            {
+                top.push_back(below[index]);
+            }
+            else
+            {
+                merge(top.back(), below[index].low, below[index].high);
+            }
+        }
+        levels_.push_back(std::move(top));
+    }
+}
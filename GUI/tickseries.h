@@ -0,0 +1,87 @@
+#ifndef TICKSERIES_H
+#define TICKSERIES_H
+
+#include <ctime>
+#include <vector>
+#include "../BaseModules/InteractiveBrokersApi/Tick.h"
+
+// ticks kept in a series, 16 MB of them
+const size_t DEFAULT_RETAINED_TICKS = 1000000;
+
+// the ticks of a chart in columns, 16 bytes each: the key as a double, the price as a
+// float and the size. the lowest and highest price of every BLOCK_TICKS ticks are kept
+// in a tree of FANOUT children per node, which finds the extremes of any range of ticks
+// in logarithmic time, so a view of millions of ticks is decimated to the pixels of the
+// plot without going through all of them. only a window of the latest ticks is kept,
+// the older ones are dropped a page at a time
+class TickSeries
+{
+public:
+    static const size_t BLOCK_TICKS = 64;
+    static const size_t FANOUT = 8;
+
+    // ticks beyond the window are dropped this many at a time
+    static const size_t PAGE_TICKS = 250000;
+
+    // times only have seconds. the ticks of a second are spread over it in the order
+    // they came, this far apart, so that they can be told apart when zoomed in
+    static const int SECOND_SLOTS = 1024;
+
+    // the ticks falling into one column of a decimated view
+    struct Column
+    {
+        size_t count;
+        float first;
+        float last;
+        float low;
+        float high;
+    };
+
+    explicit TickSeries(size_t retainedTicks = DEFAULT_RETAINED_TICKS);
+
+    void add(const Tick& tick);
+
+    // drops every tick
+    void clear();
+
+    size_t size() const;
+    bool empty() const;
+    double key(size_t index) const;
+    float price(size_t index) const;
+    int tickSize(size_t index) const;
+
+    // index of the first tick whose key is not less than key
+    size_t lowerBound(double key) const;
+
+    // lowest and highest price of the ticks [begin, end), which must not be empty
+    void extremes(size_t begin, size_t end, float& low, float& high) const;
+
+    // splits [lower, upper) into count columns of equal width
+    void decimate(double lower, double upper, int count, std::vector<Column>& columns) const;
+
+private:
+    struct Extremes
+    {
+        float low;
+        float high;
+    };
+
+    static void merge(Extremes& extremes, float low, float high);
+
+    // drops the ticks before the window and makes the tree again from the ones left
+    void trim();
+
+    std::vector<double> keys_;
+    std::vector<float> prices_;
+    std::vector<int> sizes_;
+
+    // levels_[0] has a node for each block of ticks, every level above one for each
+    // FANOUT nodes of the level below. the last node of a level may be partial
+    std::vector<std::vector<Extremes>> levels_;
+    size_t retainedTicks_;
+
+    time_t lastTime_;
+    int secondSlot_;
+};
+
+#endif // TICKSERIES_H
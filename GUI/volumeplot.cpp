@@ -1,15 +1,31 @@
 #include "volumeplot.h"
 
-VolumePlot::VolumePlot(QCustomPlot& t_parentPlot):
-    BasePlot(t_parentPlot)
+VolumePlot::VolumePlot(QCustomPlot& t_parentPlot, std::shared_ptr<SymbolCandles> feed):
+    BasePlot(t_parentPlot, feed)
 {
     volumeBars_ = new QCPBars(axisRect_.axis(QCPAxis::atBottom), axisRect_.axis(QCPAxis::atLeft));
     volumeBars_->setWidthType(QCPBars::WidthType::wtPlotCoords);
-    volumeBars_->setWidth(60);
+
+    // the volume of the candle still forming is drawn by its own bars on the live layer
+    liveBar_ = new QCPBars(axisRect_.axis(QCPAxis::atBottom), axisRect_.axis(QCPAxis::atLeft));
+    liveBar_->setWidthType(QCPBars::WidthType::wtPlotCoords);
+    liveBar_->setLayer(LIVE_LAYER_NAME);
+    liveBar_->setSelectable(QCP::stNone);
+
+    // one container for each level of the pyramid. the bars show one of them at a time
+    for(size_t level = 0; level < pyramid_.levels(); ++level)
+    {
+        levelData_.push_back(QSharedPointer<QCPBarsDataContainer>(new QCPBarsDataContainer));
+        levelHistories_.emplace_back(new BarHistory<QCPBarsData>(levelData_.back()));
+    }
+    level_ = pyramid_.levels();
+    showLevel(0);
 
     // set volume bars color
     volumeBars_->setPen(Qt::NoPen);
     volumeBars_->setBrush(QColor(30, 144, 255));
+    liveBar_->setPen(Qt::NoPen);
+    liveBar_->setBrush(QColor(30, 144, 255));
 
     size_ = 0;
 }
@@ -19,10 +35,13 @@ VolumePlot::~VolumePlot()
 
 }
 
-void VolumePlot::updatePlotAdd(const Candlestick &candle)
+void VolumePlot::updatePlotAdd(const SymbolCandles::Bar &bar)
 {
+    const auto& candle = bar.candle;
+
     // add a new bar volume and candlesticks
-    volumeBars_->addData(candle.time + 30, candle.volume);
+    pyramid_.add(candle);
+    updateLevels();
     ++size_;
 
     // since activeIndicatorPlots_ entries map plottables to
@@ -31,32 +50,42 @@ void VolumePlot::updatePlotAdd(const Candlestick &candle)
     // to the same indicator. we use this unordered_set to mark
     // which has been updated as we traverse our entries
     std::unordered_set<std::shared_ptr<IIndicatorGraph>> updatedIndicators;
+    SamplePoint sample{ candle.open, candle.high, candle.low, candle.close, static_cast<double>(candle.volume) };
+    recordCandle(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, sample, true);
 
     // update all the indicators
+    auto kept = keptRange();
     for(auto& activePlotIt: activeIndicatorPlots_)
     {
         if(updatedIndicators.find(activePlotIt.second) == updatedIndicators.end())
         {
-            activePlotIt.second->updatePlotAdd(candle.time + 30, candle.volume);
+            activePlotIt.second->updatePlotAdd(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, bar.indicators);
+            activePlotIt.second->trimHistory(kept);
             // mark as updated
             updatedIndicators.insert(activePlotIt.second);
         }
     }
 }
 
-void VolumePlot::updatePlotReplace(const Candlestick &candle)
+void VolumePlot::updatePlotReplace(const SymbolCandles::Bar &bar)
 {
+    const auto& candle = bar.candle;
+
     if(size_ > 0)
     {
-        volumeBars_->data()->set(size_ - 1, QCPBarsData(candle.time + 30, candle.volume));
+        pyramid_.replace(candle);
+        updateLevels();
 
         std::unordered_set<std::shared_ptr<IIndicatorGraph>> updatedIndicators;
+        SamplePoint sample{ candle.open, candle.high, candle.low, candle.close, static_cast<double>(candle.volume) };
+        recordCandle(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, sample, false);
+
         // update all the indicators belonging to this plot
         for(auto& activePlotIt: activeIndicatorPlots_)
         {
             if(updatedIndicators.find(activePlotIt.second) == updatedIndicators.end())
             {
-                activePlotIt.second->updatePlotReplace( candle.time + 30, candle.volume);
+                activePlotIt.second->updatePlotReplace(candle.time + CandlePyramid::BASE_TIME_FRAME / 2, bar.indicators);
                 // mark as updated
                 updatedIndicators.insert(activePlotIt.second);
             }
@@ -65,41 +94,80 @@ void VolumePlot::updatePlotReplace(const Candlestick &candle)
     // if there is nothing to replace, add a new one
     else
     {
-        updatePlotAdd(candle);
+        updatePlotAdd(bar);
     }
 }
 
-void VolumePlot::rescalePlot()
+void VolumePlot::updateLevels()
 {
-    volumeBars_->rescaleValueAxis(false, true);
+    // the latest bar of each level only goes into the level's history
+    // once a newer one starts. until then it is the live bar
+    bool hasLive = !liveVolumes_.empty();
+    liveVolumes_.resize(pyramid_.levels());
+    for(size_t level = 0; level < pyramid_.levels(); ++level)
+    {
+        if(hasLive && pyramid_.latestIsNew(level))
+        {
+            levelData_[level]->add(liveVolumes_[level]);
+            levelHistories_[level]->trim(keptRange());
+        }
+        const auto& candle = pyramid_.latest(level);
+        liveVolumes_[level] = QCPBarsData(candle.time + pyramid_.timeFrame(level) / 2, candle.volume);
+    }
+    showLive();
 }
 
-void VolumePlot::pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot)
+void VolumePlot::showLevel(size_t level)
 {
-    for(auto& it: *volumeBars_->data())
+    if(level != level_)
     {
-        iplot->updatePlotAdd( static_cast<time_t>(it.key), it.value);
+        level_ = level;
+        volumeBars_->setData(levelData_[level]);
+        volumeBars_->setWidth(pyramid_.timeFrame(level));
+        liveBar_->setWidth(pyramid_.timeFrame(level));
+        showLive();
     }
 }
 
-void VolumePlot::addIndicator(IndicatorType indicatorType, std::unique_ptr<IIndicatorGraph> indicatorPlot)
+void VolumePlot::showLive()
 {
-    // keep the indicatorPlot up to date with all the candles we currently have
-    for(auto& it: *volumeBars_->data())
+    if(liveVolumes_.empty())
     {
-        indicatorPlot->updatePlotAdd( static_cast<time_t>(it.key), it.value);
+        return;
     }
+
+    if(liveBar_->data()->isEmpty())
+    {
+        liveBar_->data()->add(liveVolumes_[level_]);
+    }
+    else
+    {
+        liveBar_->data()->set(0, liveVolumes_[level_]);
+    }
+}
+
+void VolumePlot::rescalePlot()
+{
+    volumeBars_->rescaleValueAxis(false, true);
+    liveBar_->rescaleValueAxis(true, true);
+}
+
+void VolumePlot::addIndicator(IndicatorType indicatorType, std::unique_ptr<IIndicatorGraph> indicatorPlot)
+{
+    // keep the indicatorPlot up to date with all the candles we currently have
+    pastCandlesPlotUpdate(std::move(indicatorPlot));
 //    activeIndicatorPlots_[indicatorType].push_back(std::move(indicatorPlot));
 }
 
 double VolumePlot::lowerRange()
 {
-    return volumeBars_->data()->at(0)->mainKey();
+    return volumeBars_->data()->isEmpty() ? liveBar_->data()->at(0)->mainKey() : volumeBars_->data()->at(0)->mainKey();
 }
 
 double VolumePlot::upperRange()
 {
-    return volumeBars_->data()->at(volumeBars_->data()->size() - 1)->mainKey();
+    // the live bar is always the latest
+    return liveBar_->data()->at(0)->mainKey();
 }
 
 int VolumePlot::size()
@@ -109,10 +177,16 @@ int VolumePlot::size()
 
 void VolumePlot::xAxisChanged(QCPRange range)
 {
+    // show the timeframe that keeps the number of bars drawn within the width of the plot
+    showLevel(pyramid_.levelFor(range.size(), axisRect_.width()));
+
+    // the bars scrolled to that were paged out are read back before deciding
+    // whether the view holds all of the data
+    levelHistories_[level_]->load(range);
+
     // compare the range of our zoom with our data.
     // if the zoom contains all the data, then autoscale
-    if(floor(range.lower) <= volumeBars_->data()->at(0)->mainKey() &&
-        ceil(range.upper) >= volumeBars_->data()->at(volumeBars_->data()->size() - 1)->mainKey())
+    if(liveBar_->data()->isEmpty() || (floor(range.lower) <= lowerRange() && ceil(range.upper) >= upperRange()))
     {
         autoScaleKeyAxis_ = true;
     }
@@ -153,6 +227,23 @@ void VolumePlot::indicatorSelectionMenu(QPoint pos)
             indicatorLaunch<SimpleMovingAverage>(OhlcType::VOLUME, IndicatorDisplayType::OVERLAY, period);
         }
     });
+    subMenu = menu->addMenu("V");
+    subMenu->addAction("Volume Oscillator", this, [this]()
+    {
+        //prompt user
+        IndicatorDialog diag;
+        diag.addSpinbox("Short Period", 5, 1);
+        diag.addSpinbox("Long Period", 10, 1);
+        diag.exec();
+
+        //if user pressed OK
+        if(diag.valid())
+        {
+            auto shortPeriod = diag.getSpinboxValue("Short Period");
+            auto longPeriod = diag.getSpinboxValue("Long Period");
+            indicatorLaunch<VolumeOscillator>(OhlcType::VOLUME, IndicatorDisplayType::INDICATOR, shortPeriod, longPeriod);
+        }
+    });
 
     menu->popup(parentPlot_.mapToGlobal(pos));
 }
@@ -160,8 +251,8 @@ void VolumePlot::indicatorSelectionMenu(QPoint pos)
 template<typename IndicatorType, typename ... Args>
 void VolumePlot::indicatorLaunch(OhlcType valueType, IndicatorDisplayType displayType, Args... args)
 {
-    auto indicator = std::make_unique<IndicatorType>(args...);
-    auto plot = std::make_shared<IndicatorGraph<IndicatorType>>(axisRect_, std::move(indicator), valueType, displayType);
+    auto handle = addEngineIndicator<IndicatorType>(feed_->indicators(), valueType, 0, args...);
+    auto plot = std::make_shared<IndicatorGraph<IndicatorType>>(axisRect_, feed_->indicators(), handle, valueType, displayType);
     pastCandlesPlotUpdate(plot);
     auto plottables = plot->getPlottables();
 
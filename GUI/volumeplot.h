@@ -4,19 +4,22 @@
 #include "qcustomplot.h"
 #include "indicatorgraph.h"
 #include "baseplot.h"
+#include "candlepyramid.h"
+#include "barhistory.h"
 #include <unordered_map>
 #include <ctime>
+#include <memory>
+#include <vector>
 
 class VolumePlot : public BasePlot
 {
     Q_OBJECT
 public:
-    VolumePlot(QCustomPlot& t_parentPlot);
+    VolumePlot(QCustomPlot& t_parentPlot, std::shared_ptr<SymbolCandles> feed);
     ~VolumePlot() override;
-    void updatePlotAdd(const Candlestick &candle) override;
-    void updatePlotReplace(const Candlestick &candle) override;
+    void updatePlotAdd(const SymbolCandles::Bar &bar) override;
+    void updatePlotReplace(const SymbolCandles::Bar &bar) override;
     void rescalePlot() override;
-    void pastCandlesPlotUpdate(std::shared_ptr<IIndicatorGraph> iplot) override;
     void addIndicator(IndicatorType indicatorType, std::unique_ptr<IIndicatorGraph> indicatorPlot);
 
     double lowerRange();
@@ -27,9 +30,24 @@ private slots:
     void xAxisChanged(QCPRange range) override;
 
 private:
-    // graph
+    // follows the pyramid, closing the live bar of each level into its history when a new one starts
+    void updateLevels();
+    void showLevel(size_t level);
+    void showLive();
+
+    // graph. volumeBars_ has the closed candles and liveBar_, on the live layer, the
+    // candle still forming
     QCPBars* volumeBars_;
+    QCPBars* liveBar_;
     int size_;
+
+    // the volume of every timeframe of the pyramid. volumeBars_ shows levelData_[level_].
+    // each level keeps a window of its latest bars, the older ones are on disk
+    CandlePyramid pyramid_;
+    std::vector<QSharedPointer<QCPBarsDataContainer>> levelData_;
+    std::vector<std::unique_ptr<BarHistory<QCPBarsData>>> levelHistories_;
+    std::vector<QCPBarsData> liveVolumes_;
+    size_t level_;
     void indicatorSelectionMenu(QPoint pos) override;
 
     template<typename IndicatorType, typename... Args>